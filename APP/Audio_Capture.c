@@ -0,0 +1,563 @@
+/**
+ *  @file Audio_Capture.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright Copyright (c) 2021 aron566 <aron566@163.com>.
+ *
+ *  @brief 音频触发抓取，用于观察实时流无法持续发送的多通道瞬态
+ *
+ *  @details 1、布防后各调试通道数据逐帧写入CCM RAM环形缓存，预触发帧数填满后开始判断触发.
+ *           2、触发条件为指定通道的幅度、上升/下降穿越、斜率或外部命令，触发帧计入触发后帧数.
+ *           3、触发后帧缓存完毕即暂停实时发送，按原样点计数及时间戳经Audio_Debug逐帧上传，速率由链路决定.
+ *           4、缓存按帧存放各通道连续数据，可缓存帧数为AUDIO_CAPTURE_BUF_SIZE/(通道数*帧长)，
+ *              8通道时为24帧(192ms@16KHz)，窗口超出时优先保证触发后帧数.
+ *           5、命令：cap [status] / cap trig <ext|level|rise|fall|slope> [<通道> <门限>] /
+ *              cap win <预触发帧数> <触发后帧数> / cap arm / cap fire / cap stop.
+ *           6、所有接口需在主循环中调用.
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+
+/* Private includes ----------------------------------------------------------*/
+#include "Audio_Capture.h"
+#include "Audio_Debug.h"
+#include "Cmd_Port.h"
+
+/** Use C compiler -----------------------------------------------------------*/
+#ifdef __cplusplus ///< use C compiler
+extern "C" {
+#endif
+/** Private typedef ----------------------------------------------------------*/
+/*缓存帧信息*/
+typedef struct
+{
+  uint32_t Sample_Counter;
+  uint32_t Timestamp_Ms;
+}CAPTURE_FRAME_INFO_Typedef_t;
+
+/*触发条件*/
+typedef struct
+{
+  AUDIO_CAPTURE_TRIG_MODE_Typedef_t Mode;
+  uint8_t Channel;
+  int16_t Threshold;
+}CAPTURE_TRIGGER_Typedef_t;
+/** Private macros -----------------------------------------------------------*/
+#define CAPTURE_FRAME_SIZE      AUDIO_DEBUG_FRAME_MONO_SIZE
+/*双通道时可缓存帧数最多*/
+#define CAPTURE_SLOT_MAX        (AUDIO_CAPTURE_BUF_SIZE / ((uint32_t)CHANNEL_2_EN * CAPTURE_FRAME_SIZE))
+#define CAPTURE_NO_TRIGGER      CAPTURE_FRAME_SIZE
+/** Private constants --------------------------------------------------------*/
+static const char * const Trig_Mode_Name[] = {"ext", "level", "rise", "fall", "slope"};
+static const char * const State_Name[] = {"idle", "armed", "triggered", "uploading"};
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/*抓取缓存仅由CPU访问，放置于CCM RAM*/
+#if defined(__ICCARM__)
+#pragma location = ".ccmram"
+static __no_init int16_t Capture_Buf[AUDIO_CAPTURE_BUF_SIZE];
+#elif defined(__GNUC__)
+static int16_t Capture_Buf[AUDIO_CAPTURE_BUF_SIZE] __attribute__((section(".ccmram")));
+#else
+static int16_t Capture_Buf[AUDIO_CAPTURE_BUF_SIZE];
+#endif
+static CAPTURE_FRAME_INFO_Typedef_t Slot_Info[CAPTURE_SLOT_MAX];
+
+static AUDIO_CAPTURE_STATE_Typedef_t Capture_State = AUDIO_CAPTURE_IDLE;
+static CAPTURE_TRIGGER_Typedef_t Trigger = {AUDIO_CAPTURE_TRIG_EXTERNAL, 0, 0};
+static bool Force_Trigger = false;
+/*设置窗口及按通道数调整后的窗口*/
+static uint32_t Set_Pre_Frames = AUDIO_CAPTURE_PRE_FRAMES_DEFAULT;
+static uint32_t Set_Post_Frames = AUDIO_CAPTURE_POST_FRAMES_DEFAULT;
+static uint32_t Pre_Frames = 0;
+static uint32_t Post_Frames = 0;
+/*缓存*/
+static uint8_t Capture_Channel_Total = 0;
+static uint32_t Slot_Num = 0;
+static uint32_t Write_Slot = 0;
+static uint32_t Filled = 0;
+static uint32_t Post_Left = 0;
+static int16_t Last_Sample = 0;
+static bool Last_Sample_Valid = false;
+static uint32_t Trigger_Sample_Counter = 0;
+/*上传*/
+static uint32_t Upload_Slot = 0;
+static uint32_t Upload_Left = 0;
+/** Private function prototypes ----------------------------------------------*/
+
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   按通道数重新划分缓存并清空
+  * @param   [in]Channel_Total 通道数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Capture_Layout(uint8_t Channel_Total)
+{
+  Capture_Channel_Total = Channel_Total;
+  Slot_Num = AUDIO_CAPTURE_BUF_SIZE / ((uint32_t)Channel_Total * CAPTURE_FRAME_SIZE);
+  /*优先保证触发后帧数*/
+  Post_Frames = (Set_Post_Frames < Slot_Num)?Set_Post_Frames:Slot_Num;
+  Pre_Frames = (Set_Pre_Frames < Slot_Num - Post_Frames)?Set_Pre_Frames:(Slot_Num - Post_Frames);
+  Write_Slot = 0;
+  Filled = 0;
+  Last_Sample_Valid = false;
+}
+
+/**
+  ******************************************************************
+  * @brief   判断一帧数据是否满足触发条件
+  * @param   [in]Data 触发通道数据，CAPTURE_FRAME_SIZE点.
+  * @return  触发点在帧内的序号，未触发返回CAPTURE_NO_TRIGGER.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t Audio_Capture_Check_Trigger(const int16_t *Data)
+{
+  int32_t Prev = (Last_Sample_Valid == true)?Last_Sample:Data[0];
+  int32_t Thr = Trigger.Threshold;
+  int32_t X = 0;
+  bool Hit = false;
+  uint32_t Offset = CAPTURE_NO_TRIGGER;
+
+  for(uint32_t i = 0; i < CAPTURE_FRAME_SIZE; i++)
+  {
+    X = Data[i];
+    switch(Trigger.Mode)
+    {
+      case AUDIO_CAPTURE_TRIG_LEVEL:
+        Hit = (X >= Thr || X <= -Thr);
+        break;
+      case AUDIO_CAPTURE_TRIG_RISE:
+        Hit = (Prev < Thr && X >= Thr);
+        break;
+      case AUDIO_CAPTURE_TRIG_FALL:
+        Hit = (Prev > Thr && X <= Thr);
+        break;
+      case AUDIO_CAPTURE_TRIG_SLOPE:
+        Hit = (X - Prev >= Thr || X - Prev <= -Thr);
+        break;
+      default:
+        Hit = false;
+        break;
+    }
+    if(Hit == true)
+    {
+      Offset = i;
+      break;
+    }
+    Prev = X;
+  }
+  Last_Sample = Data[CAPTURE_FRAME_SIZE - 1U];
+  Last_Sample_Valid = true;
+  return Offset;
+}
+
+/**
+  ******************************************************************
+  * @brief   触发后帧缓存完毕，开始上传
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Capture_Begin_Upload(void)
+{
+  Upload_Left = Pre_Frames + Post_Frames;
+  Upload_Slot = (Write_Slot + Slot_Num - Upload_Left) % Slot_Num;
+  Capture_State = AUDIO_CAPTURE_UPLOADING;
+  printf("cap: %lu frames x %u ch captured, trigger at sample %lu, uploading\r\n",
+         (unsigned long)Upload_Left, (unsigned)Capture_Channel_Total, (unsigned long)Trigger_Sample_Counter);
+}
+
+/**
+  ******************************************************************
+  * @brief   解析整数参数
+  * @param   [in]Str 字符串.
+  * @param   [out]Value 数值.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Audio_Capture_Parse_Int(const char *Str, long *Value)
+{
+  char *End = NULL;
+
+  *Value = strtol(Str, &End, 0);
+  return (End != Str && *End == '\0');
+}
+
+/**
+  ******************************************************************
+  * @brief   打印抓取状态
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Capture_Status(void)
+{
+  printf("cap: %s, trig %s ch%u thr %d, win %lu/%lu frames\r\n", State_Name[Capture_State],
+         Trig_Mode_Name[Trigger.Mode], (unsigned)Trigger.Channel, (int)Trigger.Threshold,
+         (unsigned long)Set_Pre_Frames, (unsigned long)Set_Post_Frames);
+  if(Capture_Channel_Total != 0U)
+  {
+    printf("cap: %u ch, %lu slots, using %lu/%lu, filled %lu, upload left %lu\r\n",
+           (unsigned)Capture_Channel_Total, (unsigned long)Slot_Num, (unsigned long)Pre_Frames,
+           (unsigned long)Post_Frames, (unsigned long)Filled, (unsigned long)Upload_Left);
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   cap命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Capture_Cmd(int Argc, char *Argv[])
+{
+  long Channel = 0;
+  long Threshold = 0;
+  long Pre = 0;
+  long Post = 0;
+  bool Ok = false;
+
+  if(Argc < 2 || strcmp(Argv[1], "status") == 0)
+  {
+    Audio_Capture_Status();
+    return;
+  }
+
+  if(strcmp(Argv[1], "arm") == 0)
+  {
+    Ok = Audio_Capture_Arm();
+  }
+  else if(strcmp(Argv[1], "fire") == 0)
+  {
+    Audio_Capture_Fire();
+    Ok = true;
+  }
+  else if(strcmp(Argv[1], "stop") == 0)
+  {
+    Audio_Capture_Stop();
+    Ok = true;
+  }
+  else if(strcmp(Argv[1], "win") == 0 && Argc == 4)
+  {
+    Ok = Audio_Capture_Parse_Int(Argv[2], &Pre) && Audio_Capture_Parse_Int(Argv[3], &Post)
+         && Pre >= 0 && Post > 0 && Audio_Capture_Set_Window((uint32_t)Pre, (uint32_t)Post);
+  }
+  else if(strcmp(Argv[1], "trig") == 0 && Argc == 3 && strcmp(Argv[2], "ext") == 0)
+  {
+    Ok = Audio_Capture_Set_Trigger(AUDIO_CAPTURE_TRIG_EXTERNAL, 0, 0);
+  }
+  else if(strcmp(Argv[1], "trig") == 0 && Argc == 5)
+  {
+    for(uint32_t Mode = (uint32_t)AUDIO_CAPTURE_TRIG_LEVEL; Mode <= (uint32_t)AUDIO_CAPTURE_TRIG_SLOPE; Mode++)
+    {
+      if(strcmp(Argv[2], Trig_Mode_Name[Mode]) == 0)
+      {
+        Ok = Audio_Capture_Parse_Int(Argv[3], &Channel) && Audio_Capture_Parse_Int(Argv[4], &Threshold)
+             && Channel >= 0 && Channel < (long)CHANNEL_8_EN && Threshold >= INT16_MIN && Threshold <= INT16_MAX
+             && Audio_Capture_Set_Trigger((AUDIO_CAPTURE_TRIG_MODE_Typedef_t)Mode, (uint8_t)Channel, (int16_t)Threshold);
+        break;
+      }
+    }
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: cap [status] | cap trig <ext|level|rise|fall|slope> [<ch> <thr>] | cap win <pre> <post> | cap arm | cap fire | cap stop");
+}
+
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+  ******************************************************************
+  * @brief   设置触发条件
+  * @param   [in]Mode 触发方式.
+  * @param   [in]Channel 触发通道，0起.
+  * @param   [in]Threshold 门限，幅度及斜率触发时需大于0.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Capture_Set_Trigger(AUDIO_CAPTURE_TRIG_MODE_Typedef_t Mode, uint8_t Channel, int16_t Threshold)
+{
+  if(Capture_State != AUDIO_CAPTURE_IDLE || Mode > AUDIO_CAPTURE_TRIG_SLOPE || Channel >= (uint8_t)CHANNEL_8_EN)
+  {
+    return false;
+  }
+  if((Mode == AUDIO_CAPTURE_TRIG_LEVEL || Mode == AUDIO_CAPTURE_TRIG_SLOPE) && Threshold <= 0)
+  {
+    return false;
+  }
+  Trigger.Mode = Mode;
+  Trigger.Channel = Channel;
+  Trigger.Threshold = Threshold;
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   设置预触发及触发后帧数，通道数较多时按缓存大小缩减
+  * @param   [in]Pre_Frame_Num 预触发帧数.
+  * @param   [in]Post_Frame_Num 触发后帧数，含触发帧，至少为1.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Capture_Set_Window(uint32_t Pre_Frame_Num, uint32_t Post_Frame_Num)
+{
+  if(Capture_State != AUDIO_CAPTURE_IDLE || Post_Frame_Num == 0U
+     || Post_Frame_Num > CAPTURE_SLOT_MAX || Pre_Frame_Num > CAPTURE_SLOT_MAX - Post_Frame_Num)
+  {
+    return false;
+  }
+  Set_Pre_Frames = Pre_Frame_Num;
+  Set_Post_Frames = Post_Frame_Num;
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   开始预触发缓存
+  * @param   [in]None.
+  * @return  true 成功，上传中返回false.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Capture_Arm(void)
+{
+  if(Capture_State == AUDIO_CAPTURE_UPLOADING)
+  {
+    return false;
+  }
+  /*首帧到达时按通道数划分缓存*/
+  Capture_Channel_Total = 0;
+  Force_Trigger = false;
+  Upload_Left = 0;
+  Capture_State = AUDIO_CAPTURE_ARMED;
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   外部触发，预触发帧数未满时在填满后触发
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Capture_Fire(void)
+{
+  if(Capture_State == AUDIO_CAPTURE_ARMED)
+  {
+    Force_Trigger = true;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   停止抓取及上传，恢复实时发送
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Capture_Stop(void)
+{
+  Capture_State = AUDIO_CAPTURE_IDLE;
+  Force_Trigger = false;
+  Upload_Left = 0;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取抓取状态
+  * @param   [in]None.
+  * @return  状态.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+AUDIO_CAPTURE_STATE_Typedef_t Audio_Capture_Get_State(void)
+{
+  return Capture_State;
+}
+
+/**
+  ******************************************************************
+  * @brief   加入一帧各通道数据
+  * @param   [in]Channel_Data 各通道数据地址，每通道AUDIO_DEBUG_FRAME_MONO_SIZE点.
+  * @param   [in]Channel_Total 通道总数，2-8，变化时重新开始缓存.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Capture_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total)
+{
+  int16_t *Slot = NULL;
+  uint32_t Offset = CAPTURE_NO_TRIGGER;
+
+  if(Capture_State != AUDIO_CAPTURE_ARMED && Capture_State != AUDIO_CAPTURE_TRIGGERED)
+  {
+    return;
+  }
+  if(Channel_Data == NULL || Channel_Total < (uint8_t)CHANNEL_2_EN)
+  {
+    return;
+  }
+  Channel_Total = (Channel_Total > (uint8_t)CHANNEL_8_EN)?(uint8_t)CHANNEL_8_EN:Channel_Total;
+  if(Channel_Total != Capture_Channel_Total)
+  {
+    /*触发后通道数变化，已缓存数据无效，重新布防*/
+    Capture_State = AUDIO_CAPTURE_ARMED;
+    Audio_Capture_Layout(Channel_Total);
+  }
+
+  /*写入一帧*/
+  Slot = &Capture_Buf[Write_Slot * Channel_Total * CAPTURE_FRAME_SIZE];
+  for(uint32_t Channel = 0; Channel < Channel_Total; Channel++)
+  {
+    memcpy(&Slot[Channel * CAPTURE_FRAME_SIZE], Channel_Data[Channel], CAPTURE_FRAME_SIZE * sizeof(int16_t));
+  }
+  Slot_Info[Write_Slot].Sample_Counter = Audio_Debug_Get_Sample_Counter();
+  Slot_Info[Write_Slot].Timestamp_Ms = HAL_GetTick();
+  Write_Slot = (Write_Slot + 1U) % Slot_Num;
+  Filled = (Filled < Slot_Num)?(Filled + 1U):Slot_Num;
+
+  if(Capture_State == AUDIO_CAPTURE_ARMED)
+  {
+    if(Trigger.Channel < Channel_Total)
+    {
+      Offset = Audio_Capture_Check_Trigger(&Slot[Trigger.Channel * CAPTURE_FRAME_SIZE]);
+    }
+    /*预触发帧数填满前不触发*/
+    if(Filled <= Pre_Frames)
+    {
+      return;
+    }
+    Offset = (Force_Trigger == true)?0U:Offset;
+    if(Offset == CAPTURE_NO_TRIGGER)
+    {
+      return;
+    }
+    Trigger_Sample_Counter = Slot_Info[(Write_Slot + Slot_Num - 1U) % Slot_Num].Sample_Counter + Offset;
+    Post_Left = Post_Frames;
+    Force_Trigger = false;
+    Capture_State = AUDIO_CAPTURE_TRIGGERED;
+  }
+
+  /*触发帧计入触发后帧数*/
+  Post_Left--;
+  if(Post_Left == 0U)
+  {
+    Audio_Capture_Begin_Upload();
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   上传已抓取数据，Audio_Debug缓冲区有空间时逐帧加入
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Capture_Start(void)
+{
+  const int16_t *Channel_Data[CHANNEL_8_EN];
+  const int16_t *Slot = NULL;
+
+  if(Capture_State != AUDIO_CAPTURE_UPLOADING)
+  {
+    return;
+  }
+  while(Upload_Left > 0U && Audio_Debug_Is_Put_Ready(Capture_Channel_Total) == true)
+  {
+    Slot = &Capture_Buf[Upload_Slot * Capture_Channel_Total * CAPTURE_FRAME_SIZE];
+    for(uint32_t Channel = 0; Channel < Capture_Channel_Total; Channel++)
+    {
+      Channel_Data[Channel] = &Slot[Channel * CAPTURE_FRAME_SIZE];
+    }
+    Audio_Debug_Put_Channel_Data_At(Channel_Data, Capture_Channel_Total,
+                                    Slot_Info[Upload_Slot].Sample_Counter, Slot_Info[Upload_Slot].Timestamp_Ms);
+    Upload_Slot = (Upload_Slot + 1U) % Slot_Num;
+    Upload_Left--;
+  }
+  if(Upload_Left == 0U)
+  {
+    Capture_State = AUDIO_CAPTURE_IDLE;
+    printf("cap: upload done\r\n");
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   触发抓取初始化
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Capture_Init(void)
+{
+  Capture_State = AUDIO_CAPTURE_IDLE;
+  Capture_Channel_Total = 0;
+  Cmd_Port_Register("cap", "triggered capture: status | trig | win | arm | fire | stop", Audio_Capture_Cmd);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
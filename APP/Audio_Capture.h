@@ -0,0 +1,79 @@
+/**
+ *  @file Audio_Capture.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 音频触发抓取，预触发缓存至RAM后经Audio_Debug上传
+ *
+ *  @version V1.0
+ */
+#ifndef AUDIO_CAPTURE_H
+#define AUDIO_CAPTURE_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define AUDIO_CAPTURE_BUF_SIZE            (24U*1024U) /**< 抓取缓存点数，位于CCM RAM，48KB*/
+#define AUDIO_CAPTURE_PRE_FRAMES_DEFAULT  8U          /**< 默认预触发帧数*/
+#define AUDIO_CAPTURE_POST_FRAMES_DEFAULT 16U         /**< 默认触发后帧数(含触发帧)*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/*抓取状态*/
+typedef enum
+{
+  AUDIO_CAPTURE_IDLE = 0,         /**< 空闲，实时发送*/
+  AUDIO_CAPTURE_ARMED,            /**< 预触发缓存中，等待触发*/
+  AUDIO_CAPTURE_TRIGGERED,        /**< 已触发，缓存触发后数据*/
+  AUDIO_CAPTURE_UPLOADING,        /**< 上传中，暂停实时发送*/
+}AUDIO_CAPTURE_STATE_Typedef_t;
+
+/*触发方式*/
+typedef enum
+{
+  AUDIO_CAPTURE_TRIG_EXTERNAL = 0,/**< 仅外部命令触发*/
+  AUDIO_CAPTURE_TRIG_LEVEL,       /**< 幅度绝对值达到门限*/
+  AUDIO_CAPTURE_TRIG_RISE,        /**< 上升穿越门限*/
+  AUDIO_CAPTURE_TRIG_FALL,        /**< 下降穿越门限*/
+  AUDIO_CAPTURE_TRIG_SLOPE,       /**< 相邻点差值绝对值达到门限*/
+}AUDIO_CAPTURE_TRIG_MODE_Typedef_t;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*触发抓取初始化，注册cap命令，需在Cmd_Port_Init之后调用*/
+void Audio_Capture_Init(void);
+/*设置触发条件，仅空闲时可设置*/
+bool Audio_Capture_Set_Trigger(AUDIO_CAPTURE_TRIG_MODE_Typedef_t Mode, uint8_t Channel, int16_t Threshold);
+/*设置预触发及触发后帧数，仅空闲时可设置*/
+bool Audio_Capture_Set_Window(uint32_t Pre_Frames, uint32_t Post_Frames);
+/*开始预触发缓存*/
+bool Audio_Capture_Arm(void);
+/*外部触发*/
+void Audio_Capture_Fire(void);
+/*停止抓取及上传*/
+void Audio_Capture_Stop(void);
+/*获取抓取状态*/
+AUDIO_CAPTURE_STATE_Typedef_t Audio_Capture_Get_State(void);
+/*加入一帧各通道数据，空闲及上传时忽略*/
+void Audio_Capture_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total);
+/*上传已抓取数据，Audio_Debug缓冲区有空间时加入，主循环中调用*/
+void Audio_Capture_Start(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -14,6 +14,16 @@
  *           3、最大支持8通道数据传输，发送缓冲区必须随之增大 8*AUDIO_DEBUG_FRAME_MONO_SIZE.
  *           4、数据格式：LEFT RIGHT LEFT RIGHT......
  *           5、多通道下数据格式：CH1 CH2 CH3 .... CH1 CH2 CH3 ....
+ *           6、帧在环形区内连续时直接以环形区地址调用发送接口，接口返回后该区域即被释放.
+ *           7、分帧模式下每帧加入帧头(同步字、通道映射、样点计数、时间戳)及硬件CRC，格式见AudioFrame.h，
+ *              发送区大小应满足AUDIO_DEBUG_SEND_BUF_SIZE，加入与发送需在同一上下文中调用.
+ *           8、分帧模式下可启用无损压缩(RiceCodec)，于发送前逐帧压缩，DWT统计压缩耗时.
+ *           9、分帧模式下各通道可设置2的幂次抽取倍数，加入时经半带FIR(arm_fir_decimate_q15)逐级2倍抽取，
+ *              存在抽取通道时帧内数据按通道依次存放，帧头附分频表，格式见AudioFrame.h.
+ *           10、环形区拷贝至发送区经DMA_Copy_Port异步进行，完成中断中释放环形区，拷贝完成的帧于下次
+ *              Audio_Debug_Start时先行发送(延迟一帧)；加入前等待拷贝完成，覆盖写入不会移动正被拷贝的出口.
+ *           11、命令dbg frame <on|off>切换分帧模式，于下次加入数据时生效，按原格式缓存的数据及待发送帧丢弃；
+ *              dbg rice <on|off>切换压缩，dbg codec打印压缩率及每帧周期数，测量正弦可选gen抓取点，语音选mic抓取点.
  *
  *  @version V1.0
  */
@@ -22,6 +32,12 @@
 /* Private includes ----------------------------------------------------------*/
 #include "Audio_Debug.h"
 #include "CircularQueue.h"
+#include "DMA_Copy_Port.h"
+#include "Cmd_Port.h"
+#include "RiceCodec.h"
+#include "DspTables.h"
+#include "main.h"
+#include "arm_math.h"
 
 /** Use C compiler -----------------------------------------------------------*/
 #ifdef __cplusplus ///< use C compiler
@@ -35,9 +51,41 @@ typedef struct
   SEND_DATA_FUNC_PORT_Typedef_t Send_Audio_Data;
   GET_IDEL_STATE_PORT_Typedef_t Get_Idel_State;
 }SEND_BUF_Typedef_t;
+
+/*缓冲区内各帧信息*/
+typedef struct
+{
+  uint32_t Sample_Counter;
+  uint32_t Timestamp_Ms;
+}FRAME_INFO_Typedef_t;
+
+/*发送区中等待拷贝完成的帧*/
+typedef struct
+{
+  volatile bool Copy_Done;      /**< 拷贝完成回调置位*/
+  bool Pending;                 /**< 发送区有待发送的帧*/
+  bool Frame_Mode;              /**< 启动拷贝时的发送模式*/
+  uint32_t Send_Size;           /**< 非分帧模式发送字节数*/
+  uint32_t Header_Size;
+  AF_HeaderTypeDef Header;      /**< 启动拷贝时填写的帧头*/
+}SEND_PENDING_Typedef_t;
+
+/*单通道抽取器，半带FIR逐级2倍抽取*/
+typedef struct
+{
+  uint8_t Factor;
+  uint8_t Stage_Num;
+  arm_fir_decimate_instance_q15 Stage[DECIM_STAGE_MAX];
+  q15_t State[DECIM_STATE_SIZE];
+}DECIMATOR_Typedef_t;
                                                      
 /** Private macros -----------------------------------------------------------*/
 #define AUDIO_DATA_BUF_SIZE CQ_BUF_2KB//(CHANNEL_8_EN*AUDIO_DEBUG_FRAME_MONO_SIZE)/**< 环形缓冲区大小 取2K*/                                                                                 
+#define FRAME_INFO_NUM      (AUDIO_DATA_BUF_SIZE/AUDIO_DEBUG_FRAME_STEREO_SIZE)/**< 缓冲区内最多帧数*/
+/*半带低通系数DT_Halfband_q15，通带0-0.21fs平坦，0.29fs以上衰减不小于60dB*/
+#if DECIM_TAPS != DT_HALFBAND_TAPS
+  #error "DECIM_TAPS must match DT_HALFBAND_TAPS, regenerate DspTables with Tools/gen_tables.py."
+#endif
 /** Private constants --------------------------------------------------------*/
 /** Public variables ---------------------------------------------------------*/
 /** Private variables --------------------------------------------------------*/
@@ -47,9 +95,27 @@ static CQ_handleTypeDef CQ_Audio_Data_Handle;
 
 /*发送设置*/
 static AUDIO_DEBUG_CHANNEL_SEL_Typedef_t Current_Channel_Sel = CHANNEL_2_EN;
+static uint32_t Current_Channel_Number = CHANNEL_2_EN;
 static uint32_t Current_Send_Size = AUDIO_DEBUG_FRAME_STEREO_SIZE;
+static bool Current_Planar = false;         /**< 帧内数据按通道依次存放*/
+static uint32_t Frame_Drop_Count = 0;       /**< 帧信息不足时丢弃的点数*/
 /*发送区*/
 static SEND_BUF_Typedef_t Send_Region;
+static SEND_PENDING_Typedef_t Send_Pending;
+/*分帧模式*/
+static bool Frame_Mode_En = (AUDIO_DEBUG_FRAME_MODE_DEFAULT != 0);
+static bool Frame_Mode_Req = (AUDIO_DEBUG_FRAME_MODE_DEFAULT != 0);/**< 下次加入数据时切换*/
+static FRAME_INFO_Typedef_t Frame_Info[FRAME_INFO_NUM];
+static uint32_t Put_Frame_Count = 0;
+static uint32_t Sample_Counter = 0;
+/*压缩模式*/
+static bool Compress_En = (AUDIO_DEBUG_COMPRESS_DEFAULT != 0);
+static int16_t Codec_Pcm_Buf[CHANNEL_8_EN][AUDIO_DEBUG_FRAME_MONO_SIZE];
+static AUDIO_DEBUG_CODEC_STATS_Typedef_t Codec_Stats;
+/*分通道抽取*/
+static uint8_t Channel_Decimation[CHANNEL_8_EN] = {1, 1, 1, 1, 1, 1, 1, 1};
+static DECIMATOR_Typedef_t Decimator[CHANNEL_8_EN];
+static q15_t Decim_Buf[2][AUDIO_DEBUG_FRAME_MONO_SIZE/2U];
 /** Private function prototypes ----------------------------------------------*/
                                                                                 
 /** Private user code --------------------------------------------------------*/
@@ -63,25 +129,367 @@ static SEND_BUF_Typedef_t Send_Region;
 */                                                                              
 /**
   ******************************************************************
-  * @brief   音频调试通道使能
-  * @param   [in]Ch_Sel 使能通道. 
+  * @brief   抽取器初始化，清空滤波器状态
+  * @param   [in]Decim 抽取器.
+  * @param   [in]Factor 抽取倍数，2的幂次.
   * @return  None.
   * @author  aron566
   * @version V1.0
-  * @date    2021-09-28
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Decimator_Init(DECIMATOR_Typedef_t *Decim, uint8_t Factor)
+{
+  uint32_t Block = AUDIO_DEBUG_FRAME_MONO_SIZE;
+  q15_t *State = Decim->State;
+  
+  Decim->Factor = Factor;
+  Decim->Stage_Num = 0;
+  while(Factor > 1U)
+  {
+    arm_fir_decimate_init_q15(&Decim->Stage[Decim->Stage_Num], DECIM_TAPS, 2, (q15_t *)DT_Halfband_q15, State, Block);
+    State += DECIM_TAPS - 1U + Block;
+    Block >>= 1;
+    Factor >>= 1;
+    Decim->Stage_Num++;
+  }
+}
+/**
+  ******************************************************************
+  * @brief   抽取一帧单通道数据
+  * @param   [in]Decim 抽取器.
+  * @param   [in]Data AUDIO_DEBUG_FRAME_MONO_SIZE点数据.
+  * @return  抽取后数据，保持有效至下次调用.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static const int16_t *Audio_Debug_Decimate(DECIMATOR_Typedef_t *Decim, const int16_t *Data)
+{
+  const q15_t *Src = Data;
+  uint32_t Block = AUDIO_DEBUG_FRAME_MONO_SIZE;
+  
+  for(uint32_t i = 0; i < Decim->Stage_Num; i++)
+  {
+    arm_fir_decimate_q15(&Decim->Stage[i], (q15_t *)Src, Decim_Buf[i & 1U], Block);
+    Src = Decim_Buf[i & 1U];
+    Block >>= 1;
+  }
+  return Src;
+}
+/**
+  ******************************************************************
+  * @brief   音频调试通道使能，并按分帧模式及各通道抽取倍数确定帧结构
+  * @param   [in]Ch_Sel 使能通道. 
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
   ******************************************************************
   */
 static void Audio_Debug_Channel_Set(AUDIO_DEBUG_CHANNEL_SEL_Typedef_t Ch_Sel)
 {
-  if(Current_Channel_Sel == Ch_Sel || Ch_Sel == CHANNEL_0_NONE)
+  uint32_t Number = 0;
+  uint32_t Size = 0;
+  uint8_t Factor = 1;
+  bool Planar = false;
+  
+  if(Ch_Sel == CHANNEL_0_NONE)
+  {
+    return;
+  }
+  Number = (uint32_t)Ch_Sel > (uint32_t)CHANNEL_2_EN?(uint32_t)Ch_Sel:(uint32_t)CHANNEL_2_EN;
+  /*抽取仅分帧模式下生效，由帧头分频表描述*/
+  for(uint32_t i = 0; i < Number; i++)
+  {
+    Factor = (Frame_Mode_En == true)?Channel_Decimation[i]:1U;
+    if(Decimator[i].Factor != Factor)
+    {
+      Audio_Debug_Decimator_Init(&Decimator[i], Factor);
+    }
+    Planar = (Factor > 1U)?true:Planar;
+    Size += AUDIO_DEBUG_FRAME_MONO_SIZE / Factor;
+  }
+  if(Current_Channel_Sel == Ch_Sel && Current_Send_Size == Size && Current_Planar == Planar)
   {
     return;
   }
   Current_Channel_Sel = Ch_Sel;
-  uint32_t Number = (uint32_t)Current_Channel_Sel > (uint32_t)CHANNEL_2_EN?(uint32_t)Current_Channel_Sel:(uint32_t)CHANNEL_2_EN;
-  Current_Send_Size = Number * AUDIO_DEBUG_FRAME_MONO_SIZE;
+  Current_Channel_Number = Number;
+  Current_Send_Size = Size;
+  Current_Planar = Planar;
   CQ_emptyData(&CQ_Audio_Data_Handle);
+  /*按新帧长丢弃最旧数据*/
+  CQ_setPolicy(&CQ_Audio_Data_Handle, CQ_POLICY_OVERWRITE_OLDEST, Current_Send_Size);
+}
+/**
+  ******************************************************************
+  * @brief   取出一帧压缩至发送区
+  * @param   [in]Payload 发送区数据起始地址
+  * @param   [in]Number 通道数
+  * @return  压缩后字节数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t Audio_Debug_Compress_Frame(uint16_t *Payload, uint32_t Number)
+{
+  uint16_t *Channel_Ptr[CHANNEL_8_EN];
+  uint16_t Samples[CHANNEL_8_EN];
+  uint32_t Start = 0;
+  uint32_t Cycles = 0;
+  uint32_t Size = 0;
+  
+  for(uint32_t i = 0; i < Number; i++)
+  {
+    Channel_Ptr[i] = (uint16_t *)Codec_Pcm_Buf[i];
+    Samples[i] = (Current_Planar == true)?(uint16_t)(AUDIO_DEBUG_FRAME_MONO_SIZE / Decimator[i].Factor):AUDIO_DEBUG_FRAME_MONO_SIZE;
+  }
+  if(Current_Planar == true)
+  {
+    for(uint32_t i = 0; i < Number; i++)
+    {
+      CQ_16getData(&CQ_Audio_Data_Handle, Channel_Ptr[i], Samples[i]);
+    }
+  }
+  else
+  {
+    CQ_16getDeinterleaved(&CQ_Audio_Data_Handle, Channel_Ptr, Number, 1, AUDIO_DEBUG_FRAME_MONO_SIZE);
+  }
+  
+  Start = DWT->CYCCNT;
+  Size = RC_encodeChannels((const int16_t * const *)Channel_Ptr, Samples, Number,
+                           (uint8_t *)Payload, RC_FRAME_SIZE_MAX(Number, AUDIO_DEBUG_FRAME_MONO_SIZE));
+  Cycles = DWT->CYCCNT - Start;
+  
+  Codec_Stats.Frames++;
+  Codec_Stats.Pcm_Bytes += Current_Send_Size * sizeof(int16_t);
+  Codec_Stats.Coded_Bytes += Size;
+  Codec_Stats.Cycles += Cycles;
+  Codec_Stats.Max_Cycles = (Cycles > Codec_Stats.Max_Cycles)?Cycles:Codec_Stats.Max_Cycles;
+  return Size;
 }
+
+/**
+  ******************************************************************
+  * @brief   发送区拷贝完成回调，DMA完成中断中调用
+  * @param   [in]User_Data 未使用.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Copy_Done(void *User_Data)
+{
+  (void)User_Data;
+  Send_Pending.Copy_Done = true;
+}
+
+/**
+  ******************************************************************
+  * @brief   由环形区取出一帧至发送区，完成后于下次调用时发送
+  * @param   [out]Dst 目标区.
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Ring_Copy_Start(uint16_t *Dst)
+{
+  Send_Pending.Copy_Done = false;
+  Send_Pending.Pending = true;
+  /*小于阈值时由CPU拷贝并直接回调*/
+  if(DMA_Copy_Port_CQ_Get(&CQ_Audio_Data_Handle, Dst, Current_Send_Size, sizeof(uint16_t), Audio_Debug_Copy_Done, NULL) == 0U)
+  {
+    /*拷贝队列满*/
+    CQ_16getData(&CQ_Audio_Data_Handle, Dst, Current_Send_Size);
+    Send_Pending.Copy_Done = true;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   填写帧头，帧信息取缓冲区内最旧一帧
+  * @param   [out]Header 帧头.
+  * @param   [in]Header_Size 帧头字节数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Fill_Header(AF_HeaderTypeDef *Header, uint32_t Header_Size)
+{
+  uint32_t Number = Current_Channel_Number;
+  /*最旧一帧的序号：已加入帧数减去缓冲区内帧数*/
+  uint32_t Queued = CQ_getLength(&CQ_Audio_Data_Handle) / Current_Send_Size;
+  const FRAME_INFO_Typedef_t *Info = &Frame_Info[(Put_Frame_Count - Queued) % FRAME_INFO_NUM];
+  
+  Header->sync = AF_SYNC_WORD;
+  Header->version = AF_VERSION;
+  Header->codec = AF_CODEC_PCM;
+  Header->channel_number = (uint8_t)Number;
+  Header->channel_map = (uint16_t)((1U << Number) - 1U);
+  Header->frame_samples = AUDIO_DEBUG_FRAME_MONO_SIZE;
+  Header->header_size = (uint16_t)Header_Size;
+  Header->sample_counter = Info->Sample_Counter;
+  Header->timestamp_ms = Info->Timestamp_Ms;
+  Header->drop_count = CQ_getDropCount(&CQ_Audio_Data_Handle) + Frame_Drop_Count;
+  Header->decimation = 1;
+  Header->payload_size = (uint16_t)(Current_Send_Size * sizeof(int16_t));
+  for(uint32_t i = 0; i < AF_CHANNEL_MAX; i++)
+  {
+    Header->channel_decimation[i] = (i < Number)?Decimator[i].Factor:1U;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   写入帧头及CRC后发送，数据已位于帧头之后
+  * @param   [in]Header 帧头.
+  * @param   [in]Header_Size 帧头字节数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Finish_Frame(const AF_HeaderTypeDef *Header, uint32_t Header_Size)
+{
+  uint16_t *Ptr = Send_Region.Send_Buf_Ptr;
+  uint32_t Size = (Header_Size + Header->payload_size)/2U;
+  uint32_t Crc = 0;
+  
+  memcpy(Ptr, Header, Header_Size);
+  Crc = Audio_Debug_Crc32(Ptr, Size/2U);
+  Ptr[Size] = (uint16_t)Crc;
+  Ptr[Size + 1U] = (uint16_t)(Crc >> 16);
+  
+  Send_Region.Send_Audio_Data((uint8_t *)Ptr, (Size + AF_CRC_SIZE/2U) * sizeof(int16_t));
+}
+
+/**
+  ******************************************************************
+  * @brief   发送发送区中已拷贝完成的帧
+  * @param   [in]None.
+  * @return  true 发送区空闲，false 拷贝未完成.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Audio_Debug_Send_Pending(void)
+{
+  if(Send_Pending.Pending == false)
+  {
+    return true;
+  }
+  if(Send_Pending.Copy_Done == false)
+  {
+    return false;
+  }
+  Send_Pending.Pending = false;
+  if(Send_Pending.Frame_Mode == true)
+  {
+    Audio_Debug_Finish_Frame(&Send_Pending.Header, Send_Pending.Header_Size);
+  }
+  else
+  {
+    Send_Region.Send_Audio_Data((uint8_t *)Send_Region.Send_Buf_Ptr, Send_Pending.Send_Size);
+  }
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   分帧发送：帧头+数据+CRC，PCM数据经DMA拷贝时于下次调用发送
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.2
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Send_Frame(void)
+{
+  AF_HeaderTypeDef Header;
+  uint16_t *Ptr = Send_Region.Send_Buf_Ptr;
+  /*存在抽取通道时帧头附分频表*/
+  uint32_t Header_Size = (Current_Planar == true)?AF_HEADER_SIZE_MAX:AF_HEADER_SIZE;
+  
+  /*帧信息须在取出数据前读取*/
+  Audio_Debug_Fill_Header(&Header, Header_Size);
+  
+  /*数据写入帧头之后*/
+  if(Compress_En == true)
+  {
+    Header.payload_size = (uint16_t)Audio_Debug_Compress_Frame(Ptr + Header_Size/2U, Current_Channel_Number);
+    Header.codec = AF_CODEC_RICE;
+    Audio_Debug_Finish_Frame(&Header, Header_Size);
+    return;
+  }
+  Send_Pending.Frame_Mode = true;
+  Send_Pending.Header = Header;
+  Send_Pending.Header_Size = Header_Size;
+  Audio_Debug_Ring_Copy_Start(Ptr + Header_Size/2U);
+  Audio_Debug_Send_Pending();
+}
+
+/**
+  ******************************************************************
+  * @brief   dbg命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Debug_Cmd(int Argc, char *Argv[])
+{
+  bool Ok = false;
+
+  if(Argc < 2)
+  {
+    printf("dbg: frame %s%s, rice %s, %lu ch, drop %lu samples\r\n", (Frame_Mode_En == true)?"on":"off",
+           (Frame_Mode_En != Frame_Mode_Req)?" (switching)":"", (Compress_En == true)?"on":"off",
+           (unsigned long)Current_Channel_Number, (unsigned long)Audio_Debug_Get_Drop_Count());
+    return;
+  }
+  if(strcmp(Argv[1], "codec") == 0 && Argc == 2)
+  {
+    if(Codec_Stats.Frames == 0U)
+    {
+      printf("dbg: no compressed frames, needs dbg frame on and dbg rice on\r\n");
+      return;
+    }
+    Audio_Debug_Codec_Report();
+    return;
+  }
+  if(strcmp(Argv[1], "rice") == 0 && Argc == 3)
+  {
+    Ok = (strcmp(Argv[2], "on") == 0 || strcmp(Argv[2], "off") == 0);
+    if(Ok == true)
+    {
+      Audio_Debug_Set_Compress(strcmp(Argv[2], "on") == 0);
+    }
+  }
+  else if(strcmp(Argv[1], "frame") == 0 && Argc == 3)
+  {
+    Ok = (strcmp(Argv[2], "on") == 0 || strcmp(Argv[2], "off") == 0);
+    if(Ok == true)
+    {
+      Audio_Debug_Set_Frame_Mode(strcmp(Argv[2], "on") == 0);
+    }
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: dbg | dbg frame <on|off> | dbg rice <on|off> | dbg codec");
+}
+
 /** Public application code --------------------------------------------------*/
 /*******************************************************************************
 *                                                                               
@@ -90,6 +498,28 @@ static void Audio_Debug_Channel_Set(AUDIO_DEBUG_CHANNEL_SEL_Typedef_t Ch_Sel)
 ********************************************************************************
 */
 
+/**
+  ******************************************************************
+  * @brief   硬件CRC计算，与AF_crc32一致
+  * @param   [in]Data 数据
+  * @param   [in]Words 32位字数
+  * @return  CRC.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t Audio_Debug_Crc32(const uint16_t *Data, uint32_t Words)
+{
+  CRC->CR = CRC_CR_RESET;
+  /*按半字读取，发送区无需4字节对齐*/
+  for(uint32_t i = 0; i < Words; i++)
+  {
+    CRC->DR = (uint32_t)Data[2U*i] | ((uint32_t)Data[2U*i + 1U] << 16);
+  }
+  return CRC->DR;
+}
+
 /**
   ******************************************************************
   * @brief   音频调试启动
@@ -102,17 +532,40 @@ static void Audio_Debug_Channel_Set(AUDIO_DEBUG_CHANNEL_SEL_Typedef_t Ch_Sel)
   */
 bool Audio_Debug_Start(void)
 {
-  uint32_t Len = CQ_getLength(&CQ_Audio_Data_Handle);
-  if(Len < Current_Send_Size)
+  CQ_SpanTypeDef Span;
+  uint32_t Len = 0;
+  
+  if(Send_Region.Get_Idel_State() == false)
   {
     return false;
   }
-  if(Send_Region.Get_Idel_State() == false)
+  /*先发送上次已拷贝完成的帧，拷贝未完成时本次不再取出*/
+  if(Audio_Debug_Send_Pending() == false)
   {
     return false;
   }
-  CQ_16getData(&CQ_Audio_Data_Handle, Send_Region.Send_Buf_Ptr, Current_Send_Size);
-  Send_Region.Send_Audio_Data((uint8_t *)Send_Region.Send_Buf_Ptr, Current_Send_Size * sizeof(int16_t));
+  Len = CQ_16_peekRead(&CQ_Audio_Data_Handle, Current_Send_Size, &Span);
+  if(Len < Current_Send_Size)
+  {
+    return false;
+  }
+  if(Frame_Mode_En == true)
+  {
+    Audio_Debug_Send_Frame();
+    return true;
+  }
+  /*帧数据连续，直接由环形区发送*/
+  if(Span.first_len == Current_Send_Size)
+  {
+    Send_Region.Send_Audio_Data((uint8_t *)Span.first, Current_Send_Size * sizeof(int16_t));
+    CQ_consumeRead(&CQ_Audio_Data_Handle, Current_Send_Size);
+    return true;
+  }
+  /*数据回绕，拼接到发送区*/
+  Send_Pending.Frame_Mode = false;
+  Send_Pending.Send_Size = Current_Send_Size * sizeof(int16_t);
+  Audio_Debug_Ring_Copy_Start(Send_Region.Send_Buf_Ptr);
+  Audio_Debug_Send_Pending();
   return true;
 }
 
@@ -121,62 +574,176 @@ bool Audio_Debug_Start(void)
   * @brief   音频数据打包发送
   * @param   [in]Left_Audio_Data 左音频数据
   * @param   [in]Right_Audio_Data 右音频数据
-  * @param   [in]Channel_Number 其他通道总数
-  * @param   [in]... 其他通道数据
+  * @param   [in]Channel_Number 其他通道总数，最多6个
+  * @param   [in]... 其他通道数据(int16_t *)
   * @return  None.
   * @author  aron566
-  * @version V1.0
-  * @date    2021-09-28
+  * @version V1.1
+  * @date    2026-10-17
   ******************************************************************
   */
 void Audio_Debug_Put_Data(const int16_t *Left_Audio_Data, const int16_t *Right_Audio_Data, uint8_t Channel_Number, ...)
 {
-  int16_t Audio_Data[8*AUDIO_DEBUG_FRAME_MONO_SIZE];
-  
+  const int16_t *Channel_Data[CHANNEL_8_EN];
+  uint32_t Channel_Total = 0;
   va_list args;
   
-  uint32_t index = 0;
-  /*更新当前通道*/
-  Audio_Debug_Channel_Set((AUDIO_DEBUG_CHANNEL_SEL_Typedef_t) Channel_Number);
+  /*总通道数为左右通道加其他通道*/
+  if(Channel_Number > (uint8_t)(CHANNEL_8_EN - CHANNEL_2_EN))
+  {
+    Channel_Number = (uint8_t)(CHANNEL_8_EN - CHANNEL_2_EN);
+  }
+  Channel_Total = (uint32_t)Channel_Number + (uint32_t)CHANNEL_2_EN;
   
-  for(uint32_t i = 0; i < AUDIO_DEBUG_FRAME_MONO_SIZE; i++)
+  Channel_Data[0] = Left_Audio_Data;
+  Channel_Data[1] = Right_Audio_Data;
+  
+  /* args point to the first variable parameter */
+  va_start(args, Channel_Number);
+  for(uint32_t Channel_Index = (uint32_t)CHANNEL_2_EN; Channel_Index < Channel_Total; Channel_Index++)
   {
-    switch(Current_Channel_Sel)
-    {
-      case CHANNEL_1_EN:
-        Audio_Data[index++] = Left_Audio_Data[i];
-        Audio_Data[index++] = Left_Audio_Data[i];
-        break;
-      case CHANNEL_2_EN:
-        Audio_Data[index++] = Left_Audio_Data[i];
-        Audio_Data[index++] = Right_Audio_Data[i];
-        break;
-      case CHANNEL_3_EN:
-      case CHANNEL_4_EN:
-      case CHANNEL_5_EN:
-      case CHANNEL_6_EN:
-      case CHANNEL_7_EN:
-      case CHANNEL_8_EN:
-      {
-        Audio_Data[index++] = Left_Audio_Data[i];
-        Audio_Data[index++] = Right_Audio_Data[i];
-        
-        /* args point to the first variable parameter */
-        va_start(args, Channel_Number);
-        for(uint8_t Channel_Index = 0; Channel_Index < Channel_Number; Channel_Index++)
-        {
-          Audio_Data[index++] = (va_arg(args, uint16_t *))[i];
-        }
-        break; 
-      }
-      default:
-        Audio_Data[index++] = 0;
-        Audio_Data[index++] = 0;
-        break;
-    }
+    Channel_Data[Channel_Index] = va_arg(args, const int16_t *);
   }
   va_end(args);
-  CQ_16putData(&CQ_Audio_Data_Handle, (const uint16_t *)Audio_Data, (2 + Channel_Number) * AUDIO_DEBUG_FRAME_MONO_SIZE);
+  
+  Audio_Debug_Put_Channel_Data(Channel_Data, (uint8_t)Channel_Total);
+}
+
+/**
+  ******************************************************************
+  * @brief   多通道音频数据打包发送
+  * @param   [in]Channel_Data 各通道数据地址，每通道AUDIO_DEBUG_FRAME_MONO_SIZE点
+  * @param   [in]Channel_Total 通道总数，2-8
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total)
+{
+  if(Channel_Data == NULL || Channel_Total < (uint8_t)CHANNEL_2_EN)
+  {
+    return;
+  }
+  Audio_Debug_Put_Channel_Data_At(Channel_Data, Channel_Total, Sample_Counter, HAL_GetTick());
+  
+  /*缓冲区满时由环形区整帧丢弃，样点计数照常累加以便上位机检测丢帧*/
+  Sample_Counter += AUDIO_DEBUG_FRAME_MONO_SIZE;
+}
+/**
+  ******************************************************************
+  * @brief   以指定样点计数及时间戳加入一帧，用于回放已缓存的数据
+  * @param   [in]Channel_Data 各通道数据地址，每通道AUDIO_DEBUG_FRAME_MONO_SIZE点
+  * @param   [in]Channel_Total 通道总数，2-8
+  * @param   [in]Frame_Sample_Counter 帧首点样点计数
+  * @param   [in]Timestamp_Ms 帧时间戳
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Put_Channel_Data_At(const int16_t * const *Channel_Data, uint8_t Channel_Total,
+                                     uint32_t Frame_Sample_Counter, uint32_t Timestamp_Ms)
+{
+  if(Channel_Data == NULL || Channel_Total < (uint8_t)CHANNEL_2_EN)
+  {
+    return;
+  }
+  if(Channel_Total > (uint8_t)CHANNEL_8_EN)
+  {
+    Channel_Total = (uint8_t)CHANNEL_8_EN;
+  }
+  
+  /*覆盖写入、清空及丢弃均会移动出口，先等待发送区拷贝完成，通常已完成*/
+  DMA_Copy_Port_CQ_Wait(&CQ_Audio_Data_Handle);
+  
+  /*切换分帧模式，按原格式缓存的数据不再发送*/
+  if(Frame_Mode_En != Frame_Mode_Req)
+  {
+    Frame_Mode_En = Frame_Mode_Req;
+    Send_Pending.Pending = false;
+    CQ_emptyData(&CQ_Audio_Data_Handle);
+  }
+  
+  /*更新当前通道*/
+  Audio_Debug_Channel_Set((AUDIO_DEBUG_CHANNEL_SEL_Typedef_t)Channel_Total);
+  
+  /*抽取后帧长较小，缓冲区内帧数可超出帧信息记录数，此时丢弃最旧帧*/
+  if(CQ_getLength(&CQ_Audio_Data_Handle) / Current_Send_Size >= FRAME_INFO_NUM)
+  {
+    CQ_consumeRead(&CQ_Audio_Data_Handle, Current_Send_Size);
+    Frame_Drop_Count += Current_Send_Size;
+  }
+  
+  /*记录帧信息*/
+  Frame_Info[Put_Frame_Count % FRAME_INFO_NUM].Sample_Counter = Frame_Sample_Counter;
+  Frame_Info[Put_Frame_Count % FRAME_INFO_NUM].Timestamp_Ms = Timestamp_Ms;
+  Put_Frame_Count++;
+  
+  if(Current_Planar == false)
+  {
+    /*直接交织写入环形区：CH1 CH2 CH3 .... CH1 CH2 CH3 ....*/
+    CQ_16putInterleaved(&CQ_Audio_Data_Handle, (const uint16_t * const *)Channel_Data, Channel_Total, 1, AUDIO_DEBUG_FRAME_MONO_SIZE);
+    return;
+  }
+  /*各通道抽取后依次写入：CH1 CH1 .... CH2 CH2 ....*/
+  for(uint32_t i = 0; i < Channel_Total; i++)
+  {
+    const int16_t *Data = (Decimator[i].Factor > 1U)?Audio_Debug_Decimate(&Decimator[i], Channel_Data[i]):Channel_Data[i];
+    CQ_16putData(&CQ_Audio_Data_Handle, (const uint16_t *)Data, AUDIO_DEBUG_FRAME_MONO_SIZE / Decimator[i].Factor);
+  }
+}
+/**
+  ******************************************************************
+  * @brief   跳过一帧，调用方丢弃实时数据时保持样点计数连续
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Skip_Frame(void)
+{
+  Sample_Counter += AUDIO_DEBUG_FRAME_MONO_SIZE;
+}
+/**
+  ******************************************************************
+  * @brief   获取下一实时帧的样点计数
+  * @param   [in]None.
+  * @return  样点计数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t Audio_Debug_Get_Sample_Counter(void)
+{
+  return Sample_Counter;
+}
+/**
+  ******************************************************************
+  * @brief   缓冲区能否无丢弃地加入一帧
+  * @param   [in]Channel_Total 通道总数.
+  * @return  true 可加入.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Debug_Is_Put_Ready(uint8_t Channel_Total)
+{
+  uint32_t Number = (Channel_Total > (uint8_t)CHANNEL_2_EN)?(uint32_t)Channel_Total:(uint32_t)CHANNEL_2_EN;
+  uint32_t Len = CQ_getLength(&CQ_Audio_Data_Handle);
+  
+  /*通道数变化时缓冲区被清空，需等待已有数据发送完毕*/
+  if(Number != Current_Channel_Number)
+  {
+    return (Len == 0U);
+  }
+  return (CQ_Audio_Data_Handle.size - Len >= Current_Send_Size && Len / Current_Send_Size + 1U < FRAME_INFO_NUM);
 }
 
 /**
@@ -200,6 +767,187 @@ void Audio_Debug_Init(uint16_t *Send_Buf, SEND_DATA_FUNC_PORT_Typedef_t Send_Dat
 
   /*初始化缓冲区*/
   CQ_16_init(&CQ_Audio_Data_Handle, Audio_Data_Buf, AUDIO_DATA_BUF_SIZE);
+  /*实时音频，缓冲区满时整帧丢弃最旧数据*/
+  CQ_setPolicy(&CQ_Audio_Data_Handle, CQ_POLICY_OVERWRITE_OLDEST, Current_Send_Size);
+  CQ_registerStats(&CQ_Audio_Data_Handle, "audio_debug");
+  
+  /*分帧模式使用硬件CRC*/
+  __HAL_RCC_CRC_CLK_ENABLE();
+  
+  /*压缩耗时统计使用DWT周期计数器*/
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  
+  Cmd_Port_Register("dbg", "audio debug output: [frame <on|off> | rice <on|off> | codec]", Audio_Debug_Cmd);
+}
+
+/**
+  ******************************************************************
+  * @brief   设置分帧模式，下次加入数据时生效并丢弃按原格式缓存的数据
+  * @param   [in]Enable true发送带帧头及CRC的数据帧，false发送原始交织数据.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Set_Frame_Mode(bool Enable)
+{
+  Frame_Mode_Req = Enable;
+}
+
+/**
+  ******************************************************************
+  * @brief   是否为分帧模式
+  * @param   [in]None.
+  * @return  true 分帧模式.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Debug_Get_Frame_Mode(void)
+{
+  return Frame_Mode_En;
+}
+
+/**
+  ******************************************************************
+  * @brief   设置无损压缩
+  * @param   [in]Enable true压缩后发送，仅分帧模式下生效.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Set_Compress(bool Enable)
+{
+  Compress_En = Enable;
+}
+
+/**
+  ******************************************************************
+  * @brief   是否启用无损压缩
+  * @param   [in]None.
+  * @return  true 启用.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Debug_Get_Compress(void)
+{
+  return Compress_En;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取压缩统计
+  * @param   [in]None.
+  * @return  统计信息.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+const AUDIO_DEBUG_CODEC_STATS_Typedef_t *Audio_Debug_Get_Codec_Stats(void)
+{
+  return &Codec_Stats;
+}
+
+/**
+  ******************************************************************
+  * @brief   打印压缩率及每帧周期数并清零统计，需与发送在同一上下文调用
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Debug_Codec_Report(void)
+{
+  uint32_t Ratio_x100 = 0;
+  
+  if(Codec_Stats.Frames == 0U || Codec_Stats.Coded_Bytes == 0U)
+  {
+    return;
+  }
+  /*压缩比，保留两位小数*/
+  Ratio_x100 = (uint32_t)((uint64_t)Codec_Stats.Pcm_Bytes * 100U / Codec_Stats.Coded_Bytes);
+  printf("audio codec: %lu frames, %lu B -> %lu B (ratio %lu.%02lu)\r\n",
+         (unsigned long)Codec_Stats.Frames, (unsigned long)Codec_Stats.Pcm_Bytes,
+         (unsigned long)Codec_Stats.Coded_Bytes,
+         (unsigned long)(Ratio_x100 / 100U), (unsigned long)(Ratio_x100 % 100U));
+  printf("audio codec: %lu cyc/frame avg, %lu cyc max\r\n",
+         (unsigned long)(Codec_Stats.Cycles / Codec_Stats.Frames), (unsigned long)Codec_Stats.Max_Cycles);
+  memset(&Codec_Stats, 0, sizeof(Codec_Stats));
+}
+
+/**
+  ******************************************************************
+  * @brief   获取发送数据通道数
+  * @param   [in]None.
+  * @return  通道数，至少为2.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t Audio_Debug_Get_Channel_Number(void)
+{
+  return (uint8_t)Current_Channel_Number;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取缓冲区满时丢弃的音频点数
+  * @param   [in]None.
+  * @return  丢弃点数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t Audio_Debug_Get_Drop_Count(void)
+{
+  return CQ_getDropCount(&CQ_Audio_Data_Handle) + Frame_Drop_Count;
+}
+/**
+  ******************************************************************
+  * @brief   设置通道抽取倍数
+  * @param   [in]Channel 通道，0起.
+  * @param   [in]Factor 抽取倍数，1至AUDIO_DEBUG_DECIMATION_MAX的2的幂次，仅分帧模式下生效.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Debug_Set_Channel_Decimation(uint8_t Channel, uint8_t Factor)
+{
+  if(Channel >= (uint8_t)CHANNEL_8_EN || Factor == 0U || Factor > AUDIO_DEBUG_DECIMATION_MAX
+     || (Factor & (Factor - 1U)) != 0U)
+  {
+    return false;
+  }
+  Channel_Decimation[Channel] = Factor;
+  return true;
+}
+/**
+  ******************************************************************
+  * @brief   获取通道抽取倍数
+  * @param   [in]Channel 通道，0起.
+  * @return  抽取倍数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t Audio_Debug_Get_Channel_Decimation(uint8_t Channel)
+{
+  return (Channel < (uint8_t)CHANNEL_8_EN)?Channel_Decimation[Channel]:1U;
 }
 #ifdef __cplusplus ///<end extern c                                             
 }                                                                               
@@ -22,11 +22,17 @@
 #include <stdarg.h>                         
 /** Private includes ---------------------------------------------------------*/
 #include "User_Main.h"                                                                     
+#include "AudioFrame.h"
 /** Use C compiler -----------------------------------------------------------*/
 #ifdef __cplusplus ///< use C compiler                                          
 extern "C" {                                                                  
 #endif                                                                          
 /** Private defines ----------------------------------------------------------*/
+#define AUDIO_DEBUG_DECIMATION_MAX    64U     /**< 单通道最大抽取倍数，每帧至少2点*/
+#define DECIM_STAGE_MAX               6U      /**< 2倍抽取级数，log2(AUDIO_DEBUG_DECIMATION_MAX)*/
+#define DECIM_TAPS                    47U     /**< 半带滤波器阶数*/
+/*各级滤波器状态之和：(DECIM_TAPS - 1 + 各级输入点数)*/
+#define DECIM_STATE_SIZE              (DECIM_STAGE_MAX * (DECIM_TAPS - 1U) + 2U * MONO_FRAME_SIZE)
                                                                         
 /** Exported typedefines -----------------------------------------------------*/
 /*通道使能*/
@@ -44,13 +50,30 @@ typedef enum
   CHANNEL_NUMBER_MAX
 }AUDIO_DEBUG_CHANNEL_SEL_Typedef_t;
 
+/*发送接口，返回后数据所在区域即被复用，异步发送需自行拷贝*/
 typedef uint32_t (*SEND_DATA_FUNC_PORT_Typedef_t)(uint8_t *, uint32_t);
 typedef bool (*GET_IDEL_STATE_PORT_Typedef_t)(void);
+
+/*压缩统计*/
+typedef struct
+{
+  uint32_t Frames;              /**< 压缩帧数*/
+  uint32_t Pcm_Bytes;           /**< 压缩前字节数*/
+  uint32_t Coded_Bytes;         /**< 压缩后字节数*/
+  uint32_t Cycles;              /**< 压缩累计CPU周期*/
+  uint32_t Max_Cycles;          /**< 单帧最大CPU周期*/
+}AUDIO_DEBUG_CODEC_STATS_Typedef_t;
 /** Exported constants -------------------------------------------------------*/
                                                                                 
 /** Exported macros-----------------------------------------------------------*/
 #define AUDIO_DEBUG_FRAME_MONO_SIZE   MONO_FRAME_SIZE   /**< 单通道数据每帧点数*/
 #define AUDIO_DEBUG_FRAME_STEREO_SIZE STEREO_FRAME_SIZE /**< 双通道数据每帧点数*/
+/*发送区大小(点数)，满足8通道分帧及压缩模式*/
+#define AUDIO_DEBUG_SEND_BUF_SIZE     (AF_CODED_FRAME_SIZE_MAX(CHANNEL_8_EN, AUDIO_DEBUG_FRAME_MONO_SIZE) / 2U)
+/*默认不分帧，发送原始交织数据*/
+#define AUDIO_DEBUG_FRAME_MODE_DEFAULT  0
+/*默认不压缩*/
+#define AUDIO_DEBUG_COMPRESS_DEFAULT    0
 /** Exported variables -------------------------------------------------------*/
 /** Exported functions prototypes --------------------------------------------*/
 
@@ -60,6 +83,39 @@ void Audio_Debug_Init(uint16_t *Send_Buf, SEND_DATA_FUNC_PORT_Typedef_t Send_Dat
 bool Audio_Debug_Start(void);
 /*音频数据打包发送*/
 void Audio_Debug_Put_Data(const int16_t *Left_Audio_Data, const int16_t *Right_Audio_Data, uint8_t Channel_Number, ...);
+/*多通道音频数据打包发送，以通道地址数组传入*/
+void Audio_Debug_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total);
+/*以指定样点计数及时间戳加入一帧，不影响实时帧计数*/
+void Audio_Debug_Put_Channel_Data_At(const int16_t * const *Channel_Data, uint8_t Channel_Total,
+                                     uint32_t Frame_Sample_Counter, uint32_t Timestamp_Ms);
+/*跳过一帧实时数据，保持样点计数连续*/
+void Audio_Debug_Skip_Frame(void);
+/*获取下一实时帧的样点计数*/
+uint32_t Audio_Debug_Get_Sample_Counter(void);
+/*缓冲区能否无丢弃地加入一帧*/
+bool Audio_Debug_Is_Put_Ready(uint8_t Channel_Total);
+/*设置分帧模式，true发送带帧头及CRC的数据帧，下次加入数据时生效*/
+void Audio_Debug_Set_Frame_Mode(bool Enable);
+/*是否为分帧模式*/
+bool Audio_Debug_Get_Frame_Mode(void);
+/*设置无损压缩，仅分帧模式下生效*/
+void Audio_Debug_Set_Compress(bool Enable);
+/*是否启用无损压缩*/
+bool Audio_Debug_Get_Compress(void);
+/*获取压缩统计*/
+const AUDIO_DEBUG_CODEC_STATS_Typedef_t *Audio_Debug_Get_Codec_Stats(void);
+/*打印压缩率及每帧周期数并清零统计*/
+void Audio_Debug_Codec_Report(void);
+/*获取发送数据通道数*/
+uint8_t Audio_Debug_Get_Channel_Number(void);
+/*硬件CRC计算，与AF_crc32一致，需在同一上下文中调用*/
+uint32_t Audio_Debug_Crc32(const uint16_t *Data, uint32_t Words);
+/*获取缓冲区满时丢弃的音频点数*/
+uint32_t Audio_Debug_Get_Drop_Count(void);
+/*设置通道抽取倍数(1/2/4/.../64)，仅分帧模式下生效，下次加入数据时应用*/
+bool Audio_Debug_Set_Channel_Decimation(uint8_t Channel, uint8_t Factor);
+/*获取通道抽取倍数*/
+uint8_t Audio_Debug_Get_Channel_Decimation(uint8_t Channel);
 
 #ifdef __cplusplus ///<end extern c                                             
 }                                                                               
@@ -0,0 +1,367 @@
+/**
+ *  @file Audio_Tap.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright Copyright (c) 2021 aron566 <aron566@163.com>.
+ *
+ *  @brief 音频调试抓取点，运行时选择各调试通道发送的信号
+ *
+ *  @details 1、各处理环节注册命名抓取点，以AUDIO_TAP_PUBLISH发布每通道AUDIO_DEBUG_FRAME_MONO_SIZE点数据.
+ *           2、发布仅记录数据地址，数据拷贝只在Audio_Debug交织写入时发生一次，未选中的抓取点仅一次位判断.
+ *           3、通道映射由tap命令修改：tap list / tap set <通道> <名称> / tap clear <通道|all>，
+ *              tap dec <通道> <倍数>设置该通道抽取倍数，分帧模式(dbg frame on)下生效，非分帧模式时保存并提示.
+ *           4、通道数为已映射的最大通道号加1，至少为2，未映射或本周期未发布的通道发送静音.
+ *           5、注册、发布、映射及获取需在同一上下文(主循环)中调用.
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+
+/* Private includes ----------------------------------------------------------*/
+#include "Audio_Tap.h"
+#include "Audio_Debug.h"
+#include "Cmd_Port.h"
+
+/** Use C compiler -----------------------------------------------------------*/
+#ifdef __cplusplus ///< use C compiler
+extern "C" {
+#endif
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+#if AUDIO_TAP_NUM_MAX > 32U
+  #error "AUDIO_TAP_NUM_MAX must not exceed 32."
+#endif
+/** Private constants --------------------------------------------------------*/
+static const int16_t Silence_Buf[AUDIO_DEBUG_FRAME_MONO_SIZE] = {0};
+/** Public variables ---------------------------------------------------------*/
+uint32_t Audio_Tap_Selected_Mask = 0;
+/** Private variables --------------------------------------------------------*/
+/*抓取点*/
+static const char *Tap_Name[AUDIO_TAP_NUM_MAX];
+static const int16_t *Tap_Data[AUDIO_TAP_NUM_MAX];
+static uint8_t Tap_Num = 0;
+static uint32_t Published_Mask = 0;
+/*调试通道映射*/
+static uint8_t Channel_Map[AUDIO_TAP_CHANNEL_MAX];
+static const int16_t *Channel_Ptr[AUDIO_TAP_CHANNEL_MAX];
+/** Private function prototypes ----------------------------------------------*/
+
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   按名称查找抓取点
+  * @param   [in]Name 名称.
+  * @return  Id，未找到返回AUDIO_TAP_INVALID.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint8_t Audio_Tap_Find(const char *Name)
+{
+  for(uint8_t Id = 0; Id < Tap_Num; Id++)
+  {
+    if(strcmp(Tap_Name[Id], Name) == 0)
+    {
+      return Id;
+    }
+  }
+  return AUDIO_TAP_INVALID;
+}
+
+/**
+  ******************************************************************
+  * @brief   由通道映射更新选中掩码
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Tap_Update_Mask(void)
+{
+  uint32_t Mask = 0;
+
+  for(uint8_t Channel = 0; Channel < AUDIO_TAP_CHANNEL_MAX; Channel++)
+  {
+    if(Channel_Map[Channel] != AUDIO_TAP_INVALID)
+    {
+      Mask |= 1UL << Channel_Map[Channel];
+    }
+  }
+  Audio_Tap_Selected_Mask = Mask;
+}
+
+/**
+  ******************************************************************
+  * @brief   打印抓取点及通道映射
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Tap_List(void)
+{
+  for(uint8_t Id = 0; Id < Tap_Num; Id++)
+  {
+    printf("tap %2u %s\r\n", (unsigned)Id, Tap_Name[Id]);
+  }
+  for(uint8_t Channel = 0; Channel < AUDIO_TAP_CHANNEL_MAX; Channel++)
+  {
+    if(Channel_Map[Channel] != AUDIO_TAP_INVALID)
+    {
+      printf("ch%u <- %s /%u\r\n", (unsigned)Channel, Tap_Name[Channel_Map[Channel]],
+             (unsigned)Audio_Debug_Get_Channel_Decimation(Channel));
+    }
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   tap命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Audio_Tap_Cmd(int Argc, char *Argv[])
+{
+  unsigned long Channel = AUDIO_TAP_CHANNEL_MAX;
+  unsigned long Factor = 0;
+  char *End = NULL;
+  bool Ok = false;
+
+  if(Argc < 2 || strcmp(Argv[1], "list") == 0)
+  {
+    Audio_Tap_List();
+    return;
+  }
+  if(Argc >= 3)
+  {
+    Channel = strtoul(Argv[2], &End, 10);
+    Channel = (End == Argv[2] || *End != '\0')?AUDIO_TAP_CHANNEL_MAX:Channel;
+  }
+
+  if(strcmp(Argv[1], "clear") == 0 && Argc == 3 && strcmp(Argv[2], "all") == 0)
+  {
+    for(uint8_t i = 0; i < AUDIO_TAP_CHANNEL_MAX; i++)
+    {
+      Audio_Tap_Map(i, NULL);
+    }
+    Ok = true;
+  }
+  else if(strcmp(Argv[1], "clear") == 0 && Argc == 3 && Channel < AUDIO_TAP_CHANNEL_MAX)
+  {
+    Ok = Audio_Tap_Map((uint8_t)Channel, NULL);
+  }
+  else if(strcmp(Argv[1], "set") == 0 && Argc == 4 && Channel < AUDIO_TAP_CHANNEL_MAX)
+  {
+    Ok = Audio_Tap_Map((uint8_t)Channel, Argv[3]);
+  }
+  else if(strcmp(Argv[1], "dec") == 0 && Argc == 4 && Channel < AUDIO_TAP_CHANNEL_MAX)
+  {
+    Factor = strtoul(Argv[3], &End, 10);
+    Ok = (End != Argv[3] && *End == '\0' && Factor <= UINT8_MAX)
+         && Audio_Debug_Set_Channel_Decimation((uint8_t)Channel, (uint8_t)Factor);
+    /*抽取仅分帧模式下生效，非分帧模式保存设置并提示*/
+    if(Ok == true && Factor > 1U && Audio_Debug_Get_Frame_Mode() == false)
+    {
+      printf("tap: decimation takes effect after dbg frame on\r\n");
+    }
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: tap list | tap set <ch> <name> | tap clear <ch|all> | tap dec <ch> <1|2|4|..|64>");
+}
+
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+  ******************************************************************
+  * @brief   注册抓取点，同名时返回已有Id
+  * @param   [in]Name 名称，常量字符串.
+  * @return  Id，失败返回AUDIO_TAP_INVALID.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t Audio_Tap_Register(const char *Name)
+{
+  uint8_t Id = 0;
+
+  if(Name == NULL)
+  {
+    return AUDIO_TAP_INVALID;
+  }
+  Id = Audio_Tap_Find(Name);
+  if(Id != AUDIO_TAP_INVALID)
+  {
+    return Id;
+  }
+  if(Tap_Num >= AUDIO_TAP_NUM_MAX)
+  {
+    return AUDIO_TAP_INVALID;
+  }
+  Tap_Name[Tap_Num] = Name;
+  return Tap_Num++;
+}
+
+/**
+  ******************************************************************
+  * @brief   抓取点是否被选中
+  * @param   [in]Id 抓取点.
+  * @return  true 已映射到调试通道.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Tap_Is_Selected(uint8_t Id)
+{
+  if(Id >= AUDIO_TAP_NUM_MAX)
+  {
+    return false;
+  }
+  return (((Audio_Tap_Selected_Mask >> Id) & 1U) != 0U);
+}
+
+/**
+  ******************************************************************
+  * @brief   发布抓取点数据
+  * @param   [in]Id 抓取点.
+  * @param   [in]Data 数据，AUDIO_DEBUG_FRAME_MONO_SIZE点.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Tap_Publish(uint8_t Id, const int16_t *Data)
+{
+  if(Id >= Tap_Num || Data == NULL)
+  {
+    return;
+  }
+  Tap_Data[Id] = Data;
+  Published_Mask |= 1UL << Id;
+}
+
+/**
+  ******************************************************************
+  * @brief   映射调试通道
+  * @param   [in]Channel 调试通道，0起.
+  * @param   [in]Name 抓取点名称，NULL清除映射.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Audio_Tap_Map(uint8_t Channel, const char *Name)
+{
+  uint8_t Id = AUDIO_TAP_INVALID;
+
+  if(Channel >= AUDIO_TAP_CHANNEL_MAX)
+  {
+    return false;
+  }
+  if(Name != NULL)
+  {
+    Id = Audio_Tap_Find(Name);
+    if(Id == AUDIO_TAP_INVALID)
+    {
+      return false;
+    }
+  }
+  Channel_Map[Channel] = Id;
+  Audio_Tap_Update_Mask();
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取本周期各调试通道数据地址，并开始新的发布周期
+  * @param   [out]Channel_Data 各通道数据地址，保持有效至下次调用.
+  * @return  通道数，未映射任何通道时为0.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t Audio_Tap_Get_Channel_Data(const int16_t * const **Channel_Data)
+{
+  uint8_t Channel_Total = 0;
+  uint8_t Id = 0;
+
+  for(uint8_t Channel = 0; Channel < AUDIO_TAP_CHANNEL_MAX; Channel++)
+  {
+    Id = Channel_Map[Channel];
+    if(Id == AUDIO_TAP_INVALID)
+    {
+      Channel_Ptr[Channel] = Silence_Buf;
+      continue;
+    }
+    Channel_Ptr[Channel] = (((Published_Mask >> Id) & 1U) != 0U)?Tap_Data[Id]:Silence_Buf;
+    Channel_Total = Channel + 1U;
+  }
+  Published_Mask = 0;
+
+  /*调试接口至少双通道*/
+  if(Channel_Total > 0U && Channel_Total < (uint8_t)CHANNEL_2_EN)
+  {
+    Channel_Total = (uint8_t)CHANNEL_2_EN;
+  }
+  *Channel_Data = Channel_Ptr;
+  return Channel_Total;
+}
+
+/**
+  ******************************************************************
+  * @brief   抓取点初始化，需在Cmd_Port_Init之后调用
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Audio_Tap_Init(void)
+{
+  Tap_Num = 0;
+  Published_Mask = 0;
+  for(uint8_t Channel = 0; Channel < AUDIO_TAP_CHANNEL_MAX; Channel++)
+  {
+    Channel_Map[Channel] = AUDIO_TAP_INVALID;
+    Channel_Ptr[Channel] = Silence_Buf;
+  }
+  Audio_Tap_Update_Mask();
+
+  Cmd_Port_Register("tap", "audio debug taps: list | set <ch> <name> | clear <ch|all> | dec <ch> <n>", Audio_Tap_Cmd);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
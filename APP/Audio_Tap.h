@@ -0,0 +1,66 @@
+/**
+ *  @file Audio_Tap.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 音频调试抓取点
+ *
+ *  @version V1.0
+ */
+#ifndef AUDIO_TAP_H
+#define AUDIO_TAP_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define AUDIO_TAP_NUM_MAX         16U     /**< 最大抓取点数，不超过32*/
+#define AUDIO_TAP_CHANNEL_MAX     8U      /**< 调试通道数*/
+#define AUDIO_TAP_INVALID         0xFFU
+
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*发布抓取点数据，未被选中时仅一次位判断，不产生拷贝；注册失败的Id(AUDIO_TAP_INVALID)被忽略*/
+#define AUDIO_TAP_PUBLISH(Id, Data) \
+  do \
+  { \
+    if((uint32_t)(Id) < AUDIO_TAP_NUM_MAX && ((Audio_Tap_Selected_Mask >> (uint32_t)(Id)) & 1U) != 0U) \
+    { \
+      Audio_Tap_Publish((Id), (Data)); \
+    } \
+  }while(0)
+/** Exported variables -------------------------------------------------------*/
+/*已映射到调试通道的抓取点，bit n对应Id n*/
+extern uint32_t Audio_Tap_Selected_Mask;
+/** Exported functions prototypes --------------------------------------------*/
+
+/*抓取点初始化，注册tap命令*/
+void Audio_Tap_Init(void);
+/*注册抓取点，Name需为常量字符串，返回Id，失败返回AUDIO_TAP_INVALID*/
+uint8_t Audio_Tap_Register(const char *Name);
+/*抓取点是否被选中，用于跳过仅为抓取准备数据的处理*/
+bool Audio_Tap_Is_Selected(uint8_t Id);
+/*发布抓取点数据，数据保持有效至Audio_Tap_Get_Channel_Data调用，建议使用AUDIO_TAP_PUBLISH*/
+void Audio_Tap_Publish(uint8_t Id, const int16_t *Data);
+/*映射调试通道，Name为NULL时清除*/
+bool Audio_Tap_Map(uint8_t Channel, const char *Name);
+/*获取本周期各调试通道数据地址，未发布的通道为静音，返回通道数*/
+uint8_t Audio_Tap_Get_Channel_Data(const int16_t * const **Channel_Data);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
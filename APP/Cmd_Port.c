@@ -0,0 +1,285 @@
+/**
+ *  @file Cmd_Port.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright Copyright (c) 2021 aron566 <aron566@163.com>.
+ *
+ *  @brief 串口命令行，由UART1(及USB CDC)接收行命令并分发至已注册的处理函数
+ *
+ *  @details 1、以回车或换行结束一行，参数以空格分隔，超长行被丢弃.
+ *           2、回复经printf输出至UART1.
+ *           3、命令在主循环中执行，处理函数与音频处理处于同一上下文.
+ *           4、内置help列出全部命令，cq打印已注册环形缓冲区统计，cq reset打印后清零.
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+
+/* Private includes ----------------------------------------------------------*/
+#include "Cmd_Port.h"
+#include "UART_Port.h"
+
+/** Use C compiler -----------------------------------------------------------*/
+#ifdef __cplusplus ///< use C compiler
+extern "C" {
+#endif
+/** Private typedef ----------------------------------------------------------*/
+/*命令*/
+typedef struct
+{
+  const char *Name;
+  const char *Help;
+  CMD_PORT_HANDLER_Typedef_t Handler;
+}CMD_PORT_ITEM_Typedef_t;
+
+/*输入源*/
+typedef struct
+{
+  UART_NUM_Typedef_t Uart_Num;
+  char Line[CMD_PORT_LINE_MAX];
+  uint32_t Len;
+  bool Overflow;                /**< 本行超长，丢弃至行尾*/
+}CMD_PORT_SOURCE_Typedef_t;
+/** Private macros -----------------------------------------------------------*/
+#define CMD_PORT_READ_SIZE      16U   /**< 每次由环形区读取字节数*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static CMD_PORT_ITEM_Typedef_t Cmd_Table[CMD_PORT_NUM_MAX];
+static uint32_t Cmd_Num = 0;
+
+static CMD_PORT_SOURCE_Typedef_t Cmd_Source[] =
+{
+  {UART_NUM_1, {0}, 0, false},
+#if USE_USB_CDC
+  {UART_NUM_0, {0}, 0, false},
+#endif
+};
+/** Private function prototypes ----------------------------------------------*/
+
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   列出全部命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Cmd_Port_Help(int Argc, char *Argv[])
+{
+  (void)Argc;
+  (void)Argv;
+  for(uint32_t i = 0; i < Cmd_Num; i++)
+  {
+    printf("%-8s %s\r\n", Cmd_Table[i].Name, Cmd_Table[i].Help);
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   打印环形缓冲区统计，可选打印后清零
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Cmd_Port_CQ_Stats(int Argc, char *Argv[])
+{
+  if(Argc > 2 || (Argc == 2 && strcmp(Argv[1], "reset") != 0))
+  {
+    printf("usage: cq [reset]\r\n");
+    return;
+  }
+  CQ_dumpStats();
+  if(Argc == 2)
+  {
+    CQ_resetAllStats();
+    printf("ok\r\n");
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   拆分参数并执行一行命令
+  * @param   [in]Line 命令行，拆分时被修改.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Cmd_Port_Execute(char *Line)
+{
+  char *Argv[CMD_PORT_ARGC_MAX];
+  int Argc = 0;
+  char *Ptr = Line;
+
+  while(*Ptr != '\0' && Argc < (int)CMD_PORT_ARGC_MAX)
+  {
+    while(*Ptr == ' ' || *Ptr == '\t')
+    {
+      *Ptr++ = '\0';
+    }
+    if(*Ptr == '\0')
+    {
+      break;
+    }
+    Argv[Argc++] = Ptr;
+    while(*Ptr != '\0' && *Ptr != ' ' && *Ptr != '\t')
+    {
+      Ptr++;
+    }
+  }
+  if(Argc == 0)
+  {
+    return;
+  }
+
+  for(uint32_t i = 0; i < Cmd_Num; i++)
+  {
+    if(strcmp(Argv[0], Cmd_Table[i].Name) == 0)
+    {
+      Cmd_Table[i].Handler(Argc, Argv);
+      return;
+    }
+  }
+  printf("unknown command: %s, try help\r\n", Argv[0]);
+}
+
+/**
+  ******************************************************************
+  * @brief   读取输入源数据，组成整行后执行
+  * @param   [in]Source 输入源.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Cmd_Port_Poll_Source(CMD_PORT_SOURCE_Typedef_t *Source)
+{
+  Uart_Dev_Handle_t *Uart_Handle = Uart_Port_Get_Handle(Source->Uart_Num);
+  uint8_t Buf[CMD_PORT_READ_SIZE];
+  uint32_t Len = 0;
+
+  if(Uart_Handle == NULL || Uart_Handle->cb == NULL)
+  {
+    return;
+  }
+
+  while((Len = CQ_getData(Uart_Handle->cb, Buf, CMD_PORT_READ_SIZE)) > 0U)
+  {
+    for(uint32_t i = 0; i < Len; i++)
+    {
+      if(Buf[i] == '\r' || Buf[i] == '\n')
+      {
+        if(Source->Overflow == false && Source->Len > 0U)
+        {
+          Source->Line[Source->Len] = '\0';
+          Cmd_Port_Execute(Source->Line);
+        }
+        Source->Len = 0;
+        Source->Overflow = false;
+        continue;
+      }
+      /*预留结束符*/
+      if(Source->Len + 1U >= CMD_PORT_LINE_MAX)
+      {
+        Source->Overflow = true;
+        continue;
+      }
+      Source->Line[Source->Len++] = (char)Buf[i];
+    }
+  }
+}
+
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+  ******************************************************************
+  * @brief   注册命令
+  * @param   [in]Name 命令名.
+  * @param   [in]Help 帮助信息.
+  * @param   [in]Handler 处理函数.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool Cmd_Port_Register(const char *Name, const char *Help, CMD_PORT_HANDLER_Typedef_t Handler)
+{
+  if(Name == NULL || Handler == NULL || Cmd_Num >= CMD_PORT_NUM_MAX)
+  {
+    return false;
+  }
+  Cmd_Table[Cmd_Num].Name = Name;
+  Cmd_Table[Cmd_Num].Help = (Help == NULL)?"":Help;
+  Cmd_Table[Cmd_Num].Handler = Handler;
+  Cmd_Num++;
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   读取并执行命令
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Cmd_Port_Start(void)
+{
+  for(uint32_t i = 0; i < sizeof(Cmd_Source) / sizeof(Cmd_Source[0]); i++)
+  {
+    Cmd_Port_Poll_Source(&Cmd_Source[i]);
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   命令行接口初始化
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Cmd_Port_Init(void)
+{
+  Cmd_Num = 0;
+  Cmd_Port_Register("help", "list commands", Cmd_Port_Help);
+  Cmd_Port_Register("cq", "queue stats: [reset]", Cmd_Port_CQ_Stats);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,51 @@
+/**
+ *  @file Cmd_Port.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 串口命令行接口
+ *
+ *  @version V1.0
+ */
+#ifndef CMD_PORT_H
+#define CMD_PORT_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define CMD_PORT_LINE_MAX       64U   /**< 单行最大字符数*/
+#define CMD_PORT_ARGC_MAX       8U    /**< 最大参数个数(含命令名)*/
+#define CMD_PORT_NUM_MAX        12U   /**< 最大命令数*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/*命令处理函数，Argv[0]为命令名*/
+typedef void (*CMD_PORT_HANDLER_Typedef_t)(int Argc, char *Argv[]);
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*命令行接口初始化，需在Uart_Port_Init之后调用*/
+void Cmd_Port_Init(void);
+/*注册命令，Name及Help需为常量字符串*/
+bool Cmd_Port_Register(const char *Name, const char *Help, CMD_PORT_HANDLER_Typedef_t Handler);
+/*读取并执行命令，主循环中调用*/
+void Cmd_Port_Start(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
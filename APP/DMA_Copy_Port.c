@@ -0,0 +1,871 @@
+/**
+ *  @file DMA_Copy_Port.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief DMA内存拷贝接口
+ *
+ *  @details 1、使用DMA2_Stream1(DMA2 Stream0已用于SPI1 RX)进行存储器到存储器传输，仅DMA2支持该模式
+ *           2、小于DMA_COPY_PORT_THRESHOLD字节、位于CCM RAM或超出单次传输长度的拷贝由CPU完成
+ *           3、请求按顺序执行，完成回调在DMA中断中调用，回调中可再次发起拷贝
+ *           4、环形缓冲区拷贝在完成后才释放/发布空间，完成前同一端再次取出/加入返回0，
+ *              需要数据时由DMA_Copy_Port_CQ_Wait等待完成或使用完成回调；
+ *              覆盖写入(CQ_POLICY_OVERWRITE_OLDEST)会移动出口，此类缓冲区可取出，但取出完成前生产者不可写入，
+ *              写入前需DMA_Copy_Port_CQ_Wait；加入仅支持默认写入策略CQ_POLICY_DROP_NEWEST
+ *           5、使用DWT周期计数器统计DMA开销及等待耗时，与初始化时测得的CPU拷贝耗时比较得出节省的CPU周期，
+ *              主循环中按周期打印，命令dma可立即打印或修改周期，dma bench打印实测开销及按帧长折算的节省
+ *           6、初始化时实测单次DMA传输开销，DMA拷贝最小字节数取DMA_COPY_PORT_THRESHOLD与盈亏点中较大者
+ *
+ *  @version V1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "DMA_Copy_Port.h"
+#include "Cmd_Port.h"
+#include "main.h"
+/** Private typedef ----------------------------------------------------------*/
+/*传输完成后对环形缓冲区的操作*/
+typedef enum
+{
+  DMA_COPY_RELEASE_NONE = 0,    /**< 无操作*/
+  DMA_COPY_RELEASE_CONSUME,     /**< 释放已读取数据*/
+  DMA_COPY_RELEASE_COMMIT,      /**< 发布已写入数据*/
+}DMA_COPY_RELEASE_Typedef_t;
+
+/*拷贝请求*/
+typedef struct
+{
+  void *Dst;
+  const void *Src;
+  uint32_t Size;                                /**< 字节数*/
+  DMA_COPY_DONE_CALLBACK_Typedef_t Callback;    /**< 为NULL时不回调*/
+  void *User_Data;
+  CQ_handleTypeDef *Ring;                       /**< 完成后操作的环形缓冲区*/
+  uint32_t Release_Len;                         /**< 释放/发布的元素个数*/
+  DMA_COPY_RELEASE_Typedef_t Release;
+}DMA_COPY_REQUEST_Typedef_t;
+/** Private macros -----------------------------------------------------------*/
+#define DMA_COPY_PORT_STREAM        DMA2_Stream1
+#define DMA_COPY_PORT_IRQn          DMA2_Stream1_IRQn
+#define DMA_COPY_PORT_IRQ_PRIORITY  5U      /**< 低于音频及USB中断*/
+#define DMA_COPY_PORT_MAX_ITEMS     0xFFFFU /**< NDTR最大传输次数*/
+#define DMA_COPY_PORT_CALIB_SIZE    256U    /**< CPU拷贝耗时测量长度*/
+#define DMA_COPY_PORT_BENCH_FPS     125U    /**< 16kHz每帧128点，每秒帧数*/
+
+/*DMA无法访问CCM RAM*/
+#define IS_CCM_ADDR(Addr)           (((uintptr_t)(Addr) & 0xFFFF0000U) == CCMDATARAM_BASE)
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static DMA_HandleTypeDef hdma_memtomem;
+static DMA_COPY_REQUEST_Typedef_t Copy_Queue[DMA_COPY_PORT_QUEUE_SIZE];
+static volatile uint32_t Copy_Head = 0;   /**< 下一个写入位置*/
+static volatile uint32_t Copy_Tail = 0;   /**< 当前传输位置*/
+static volatile uint32_t Copy_Count = 0;
+static volatile bool Copy_Busy = false;
+static DMA_COPY_STATS_Typedef_t Copy_Stats;
+static uint32_t Callback_Cycles = 0;      /**< 本次中断内用户回调耗时，不计入DMA开销*/
+static uint32_t Report_Period_Ms = DMA_COPY_PORT_REPORT_PERIOD * 1000U;
+static uint32_t Report_Tick = 0;          /**< 上次打印时刻*/
+static uint32_t Copy_Threshold = DMA_COPY_PORT_THRESHOLD;
+/** Private function prototypes ----------------------------------------------*/
+static void DMA_Copy_Port_Cplt_Callback(DMA_HandleTypeDef *hdma);
+static void DMA_Copy_Port_Error_Callback(DMA_HandleTypeDef *hdma);
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   CPU拷贝耗时测量
+  * @param   [in]None
+  * @return  拷贝DMA_COPY_PORT_CALIB_SIZE字节的最少周期数
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t DMA_Copy_Port_Calibrate(void)
+{
+  uint32_t Buf[DMA_COPY_PORT_CALIB_SIZE * 2U / sizeof(uint32_t)];
+  uint32_t Min_Cycles = UINT32_MAX;
+  uint32_t Start = 0;
+  uint32_t Cycles = 0;
+
+  memset(Buf, 0x5A, sizeof(Buf));
+  for(uint32_t i = 0; i < 4U; i++)
+  {
+    Start = DWT->CYCCNT;
+    memcpy(Buf + DMA_COPY_PORT_CALIB_SIZE / sizeof(uint32_t), Buf, DMA_COPY_PORT_CALIB_SIZE);
+    Cycles = DWT->CYCCNT - Start;
+    Min_Cycles = (Cycles < Min_Cycles)?Cycles:Min_Cycles;
+  }
+  return Min_Cycles;
+}
+
+/**
+  ******************************************************************
+  * @brief   完成请求：操作环形缓冲区并回调
+  * @param   [in]Req 请求
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Finish(const DMA_COPY_REQUEST_Typedef_t *Req)
+{
+  uint32_t Start = 0;
+
+  if(Req->Release == DMA_COPY_RELEASE_CONSUME)
+  {
+    CQ_consumeRead(Req->Ring, Req->Release_Len);
+  }
+  else if(Req->Release == DMA_COPY_RELEASE_COMMIT)
+  {
+    CQ_commitWrite(Req->Ring, Req->Release_Len);
+  }
+
+  if(Req->Callback != NULL)
+  {
+    Start = DWT->CYCCNT;
+    Req->Callback(Req->User_Data);
+    Callback_Cycles += DWT->CYCCNT - Start;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   环形缓冲区是否有未完成的拷贝
+  * @param   [in]cb 环形缓冲区句柄
+  * @param   [in]Release 缓冲区操作，为DMA_COPY_RELEASE_NONE时不区分读写端
+  * @return  true 有未完成的拷贝
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool DMA_Copy_Port_Ring_Pending(const CQ_handleTypeDef *cb, DMA_COPY_RELEASE_Typedef_t Release)
+{
+  const DMA_COPY_REQUEST_Typedef_t *Req = NULL;
+  uint32_t Primask = __get_PRIMASK();
+  bool Pending = false;
+
+  /*传输中的请求在完成中断内操作缓冲区后才移出队列*/
+  __disable_irq();
+  for(uint32_t i = 0; i < Copy_Count && Pending == false; i++)
+  {
+    Req = &Copy_Queue[(Copy_Tail + i) % DMA_COPY_PORT_QUEUE_SIZE];
+    Pending = (Req->Ring == cb && (Release == DMA_COPY_RELEASE_NONE || Req->Release == Release));
+  }
+  __set_PRIMASK(Primask);
+  return Pending;
+}
+
+/**
+  ******************************************************************
+  * @brief   CPU拷贝
+  * @param   [in]Req 请求
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Cpu_Copy(const DMA_COPY_REQUEST_Typedef_t *Req)
+{
+  memcpy(Req->Dst, Req->Src, Req->Size);
+  Copy_Stats.Cpu_Bytes += Req->Size;
+  Copy_Stats.Cpu_Count++;
+}
+
+/**
+  ******************************************************************
+  * @brief   启动队列中下一个请求，需在关中断或DMA中断中调用
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Start_Next(void)
+{
+  DMA_COPY_REQUEST_Typedef_t Req;
+  uint32_t Align = 0;
+  uint32_t Width = 0;
+  uint32_t Shift = 0;
+  uint32_t Start = 0;
+
+  while(Copy_Count > 0U)
+  {
+    Req = Copy_Queue[Copy_Tail];
+
+    /*按源、目标地址及长度共同对齐情况选择传输位宽*/
+    Align = (uint32_t)((uintptr_t)Req.Dst | (uintptr_t)Req.Src) | Req.Size;
+    if((Align & 3U) == 0U)
+    {
+      Width = DMA_PDATAALIGN_WORD | DMA_MDATAALIGN_WORD;
+      Shift = 2;
+    }
+    else if((Align & 1U) == 0U)
+    {
+      Width = DMA_PDATAALIGN_HALFWORD | DMA_MDATAALIGN_HALFWORD;
+      Shift = 1;
+    }
+    else
+    {
+      Width = DMA_PDATAALIGN_BYTE | DMA_MDATAALIGN_BYTE;
+      Shift = 0;
+    }
+
+    if((Req.Size >> Shift) <= DMA_COPY_PORT_MAX_ITEMS)
+    {
+      Start = DWT->CYCCNT;
+      MODIFY_REG(hdma_memtomem.Instance->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE, Width);
+      /*存储器到存储器模式下外设端口为源*/
+      if(HAL_DMA_Start_IT(&hdma_memtomem, (uint32_t)(uintptr_t)Req.Src, (uint32_t)(uintptr_t)Req.Dst, Req.Size >> Shift) == HAL_OK)
+      {
+        Copy_Stats.Overhead_Cycles += DWT->CYCCNT - Start;
+        Copy_Busy = true;
+        return;
+      }
+    }
+
+    /*超出单次传输长度或启动失败*/
+    DMA_Copy_Port_Cpu_Copy(&Req);
+    Copy_Tail = (Copy_Tail + 1U) % DMA_COPY_PORT_QUEUE_SIZE;
+    Copy_Count--;
+    DMA_Copy_Port_Finish(&Req);
+  }
+  Copy_Busy = false;
+}
+
+/**
+  ******************************************************************
+  * @brief   加入一组请求，空间不足时不加入
+  * @param   [in]Req 请求数组
+  * @param   [in]Num 请求个数
+  * @return  true 成功
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool DMA_Copy_Port_Enqueue(const DMA_COPY_REQUEST_Typedef_t *Req, uint32_t Num)
+{
+  uint32_t Primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(DMA_COPY_PORT_QUEUE_SIZE - Copy_Count < Num)
+  {
+    __set_PRIMASK(Primask);
+    return false;
+  }
+  for(uint32_t i = 0; i < Num; i++)
+  {
+    Copy_Queue[Copy_Head] = Req[i];
+    Copy_Head = (Copy_Head + 1U) % DMA_COPY_PORT_QUEUE_SIZE;
+  }
+  Copy_Count += Num;
+
+  /*传输中则由完成中断继续启动*/
+  if(Copy_Busy == false)
+  {
+    DMA_Copy_Port_Start_Next();
+  }
+  __set_PRIMASK(Primask);
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   DMA传输开销测量，需在空闲时调用，不计入拷贝统计
+  * @param   [in]None
+  * @return  单次传输DMA_COPY_PORT_CALIB_SIZE字节的最少CPU周期数(启动+完成中断)
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t DMA_Copy_Port_Measure_Xfer(void)
+{
+  uint32_t Buf[DMA_COPY_PORT_CALIB_SIZE * 2U / sizeof(uint32_t)];
+  DMA_COPY_REQUEST_Typedef_t Req = {Buf + DMA_COPY_PORT_CALIB_SIZE / sizeof(uint32_t), Buf, DMA_COPY_PORT_CALIB_SIZE,
+                                    NULL, NULL, NULL, 0, DMA_COPY_RELEASE_NONE};
+  DMA_COPY_STATS_Typedef_t Saved_Stats;
+  uint32_t Min_Cycles = UINT32_MAX;
+  uint32_t Cycles = 0;
+
+  /*调用方与拷贝请求同在主循环，等待已有请求完成后不会有新请求加入*/
+  while(DMA_Copy_Port_Is_Idle() == false)
+  {
+  }
+  Saved_Stats = Copy_Stats;
+  memset(Buf, 0x5A, sizeof(Buf));
+  for(uint32_t i = 0; i < 4U; i++)
+  {
+    Cycles = Copy_Stats.Overhead_Cycles;
+    if(DMA_Copy_Port_Enqueue(&Req, 1) == false)
+    {
+      break;
+    }
+    while(DMA_Copy_Port_Is_Idle() == false)
+    {
+    }
+    Cycles = Copy_Stats.Overhead_Cycles - Cycles;
+    Min_Cycles = (Cycles < Min_Cycles)?Cycles:Min_Cycles;
+  }
+  Copy_Stats = Saved_Stats;
+  return Min_Cycles;
+}
+
+/**
+  ******************************************************************
+  * @brief   按实测开销更新DMA拷贝最小字节数：DMA开销低于同长度CPU拷贝耗时才使用DMA
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Update_Threshold(void)
+{
+  uint32_t Break_Even = 0;
+
+  Copy_Stats.Xfer_Cycles = DMA_Copy_Port_Measure_Xfer();
+  if(Copy_Stats.Memcpy_Cycles_256B == 0U || Copy_Stats.Xfer_Cycles == UINT32_MAX)
+  {
+    return;
+  }
+  Break_Even = (uint32_t)((uint64_t)Copy_Stats.Xfer_Cycles * DMA_COPY_PORT_CALIB_SIZE / Copy_Stats.Memcpy_Cycles_256B) + 1U;
+  Copy_Threshold = (Break_Even > DMA_COPY_PORT_THRESHOLD)?Break_Even:DMA_COPY_PORT_THRESHOLD;
+}
+
+/**
+  ******************************************************************
+  * @brief   打印实测开销及按音频帧长折算的每秒节省周期
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Bench(void)
+{
+  /*16kHz立体声及8通道调试帧，每通道128点*/
+  static const uint32_t Frame_Bytes[] = {512U, 2048U};
+  int64_t Saved = 0;
+
+  DMA_Copy_Port_Update_Threshold();
+  printf("dma bench: memcpy %lu cyc/256B, dma %lu cyc/xfer, threshold %lu B\r\n",
+         (unsigned long)Copy_Stats.Memcpy_Cycles_256B, (unsigned long)Copy_Stats.Xfer_Cycles,
+         (unsigned long)Copy_Threshold);
+  for(uint32_t i = 0; i < sizeof(Frame_Bytes) / sizeof(Frame_Bytes[0]); i++)
+  {
+    /*负值表示DMA开销大于CPU拷贝，此时由CPU拷贝*/
+    Saved = ((int64_t)Frame_Bytes[i] * Copy_Stats.Memcpy_Cycles_256B / DMA_COPY_PORT_CALIB_SIZE
+             - (int64_t)Copy_Stats.Xfer_Cycles) * DMA_COPY_PORT_BENCH_FPS;
+    printf("dma bench: %lu B x %u/s saved %ld cyc/s by dma (%s)\r\n", (unsigned long)Frame_Bytes[i],
+           DMA_COPY_PORT_BENCH_FPS, (long)Saved, (Frame_Bytes[i] >= Copy_Threshold)?"dma":"cpu");
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   提交一组请求，总长度小于阈值或地址DMA不可访问时由CPU拷贝
+  * @param   [in]Req 请求数组，仅最后一个请求携带回调及缓冲区操作
+  * @param   [in]Num 请求个数
+  * @return  true 成功
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool DMA_Copy_Port_Submit(const DMA_COPY_REQUEST_Typedef_t *Req, uint32_t Num)
+{
+  uint32_t Total = 0;
+  bool Use_Cpu = false;
+
+  for(uint32_t i = 0; i < Num; i++)
+  {
+    Total += Req[i].Size;
+    Use_Cpu |= IS_CCM_ADDR(Req[i].Dst) || IS_CCM_ADDR(Req[i].Src);
+  }
+
+  if(Total >= Copy_Threshold && Use_Cpu == false)
+  {
+    return DMA_Copy_Port_Enqueue(Req, Num);
+  }
+
+  for(uint32_t i = 0; i < Num; i++)
+  {
+    DMA_Copy_Port_Cpu_Copy(&Req[i]);
+  }
+  DMA_Copy_Port_Finish(&Req[Num - 1U]);
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   DMA传输完成回调
+  * @param   [in]hdma DMA句柄
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Cplt_Callback(DMA_HandleTypeDef *hdma)
+{
+  DMA_COPY_REQUEST_Typedef_t Req = Copy_Queue[Copy_Tail];
+
+  Copy_Stats.Dma_Bytes += Req.Size;
+  Copy_Stats.Dma_Count++;
+  Copy_Tail = (Copy_Tail + 1U) % DMA_COPY_PORT_QUEUE_SIZE;
+  Copy_Count--;
+  DMA_Copy_Port_Finish(&Req);
+  DMA_Copy_Port_Start_Next();
+}
+
+/**
+  ******************************************************************
+  * @brief   统计命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Cmd(int Argc, char *Argv[])
+{
+  uint32_t Now = HAL_GetTick();
+  char *End = NULL;
+  unsigned long Sec = 0;
+
+  if(Argc < 2)
+  {
+    DMA_Copy_Port_Report(Now - Report_Tick);
+    Report_Tick = Now;
+    return;
+  }
+  if(Argc == 2 && strcmp(Argv[1], "bench") == 0)
+  {
+    DMA_Copy_Port_Bench();
+    return;
+  }
+  Sec = strtoul(Argv[1], &End, 10);
+  if(Argc != 2 || End == Argv[1] || *End != '\0' || Sec > UINT32_MAX / 1000U)
+  {
+    printf("usage: dma | dma <report period s, 0 off> | dma bench\r\n");
+    return;
+  }
+  Report_Period_Ms = (uint32_t)Sec * 1000U;
+  Report_Tick = Now;
+  printf("ok\r\n");
+}
+
+/**
+  ******************************************************************
+  * @brief   DMA传输错误回调，改由CPU完成当前请求
+  * @param   [in]hdma DMA句柄
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void DMA_Copy_Port_Error_Callback(DMA_HandleTypeDef *hdma)
+{
+  DMA_COPY_REQUEST_Typedef_t Req = Copy_Queue[Copy_Tail];
+
+  DMA_Copy_Port_Cpu_Copy(&Req);
+  Copy_Tail = (Copy_Tail + 1U) % DMA_COPY_PORT_QUEUE_SIZE;
+  Copy_Count--;
+  DMA_Copy_Port_Finish(&Req);
+  DMA_Copy_Port_Start_Next();
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   DMA2 Stream1中断
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void DMA2_Stream1_IRQHandler(void)
+{
+  uint32_t Start = DWT->CYCCNT;
+
+  Callback_Cycles = 0;
+  HAL_DMA_IRQHandler(&hdma_memtomem);
+  Copy_Stats.Overhead_Cycles += DWT->CYCCNT - Start - Callback_Cycles;
+}
+
+/**
+  ******************************************************************
+  * @brief   拷贝数据
+  * @param   [in]Dst 目标地址
+  * @param   [in]Src 源地址
+  * @param   [in]Size 字节数
+  * @param   [in]Callback 完成回调，可为NULL
+  * @param   [in]User_Data 回调参数
+  * @return  true 已完成或已加入队列，false 队列满
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool DMA_Copy_Port_Start(void *Dst, const void *Src, uint32_t Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data)
+{
+  DMA_COPY_REQUEST_Typedef_t Req = {Dst, Src, Size, Callback, User_Data, NULL, 0, DMA_COPY_RELEASE_NONE};
+
+  if(Dst == NULL || Src == NULL || Size == 0U)
+  {
+    return false;
+  }
+  return DMA_Copy_Port_Submit(&Req, 1);
+}
+
+/**
+  ******************************************************************
+  * @brief   由环形缓冲区取出数据，传输完成后释放缓冲区空间
+  * @param   [in]cb 环形缓冲区句柄
+  * @param   [in]Dst 目标地址
+  * @param   [in]Len 最多取出的元素个数
+  * @param   [in]Elem_Size 元素字节数1/2/4
+  * @param   [in]Callback 完成回调，可为NULL
+  * @param   [in]User_Data 回调参数
+  * @return  取出的元素个数，队列满或上次取出未完成返回0
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t DMA_Copy_Port_CQ_Get(CQ_handleTypeDef *cb, void *Dst, uint32_t Len, uint32_t Elem_Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data)
+{
+  DMA_COPY_REQUEST_Typedef_t Req[2];
+  CQ_SpanTypeDef Span;
+  uint32_t Num = 0;
+
+  /*完成前出口未更新，再次读取会取到同一段数据*/
+  if(DMA_Copy_Port_Ring_Pending(cb, DMA_COPY_RELEASE_CONSUME) == true)
+  {
+    return 0;
+  }
+  switch(Elem_Size)
+  {
+    case 1:
+      Len = CQ_peekRead(cb, Len, &Span);
+      break;
+    case 2:
+      Len = CQ_16_peekRead(cb, Len, &Span);
+      break;
+    case 4:
+      Len = CQ_32_peekRead(cb, Len, &Span);
+      break;
+    default:
+      return 0;
+  }
+  if(Len == 0U)
+  {
+    return 0;
+  }
+
+  memset(Req, 0, sizeof(Req));
+  Req[Num].Dst = Dst;
+  Req[Num].Src = Span.first;
+  Req[Num].Size = Span.first_len * Elem_Size;
+  Num++;
+  if(Span.second_len > 0U)
+  {
+    Req[Num].Dst = (uint8_t *)Dst + Span.first_len * Elem_Size;
+    Req[Num].Src = Span.second;
+    Req[Num].Size = Span.second_len * Elem_Size;
+    Num++;
+  }
+  Req[Num - 1U].Callback = Callback;
+  Req[Num - 1U].User_Data = User_Data;
+  Req[Num - 1U].Ring = cb;
+  Req[Num - 1U].Release_Len = Len;
+  Req[Num - 1U].Release = DMA_COPY_RELEASE_CONSUME;
+
+  return (DMA_Copy_Port_Submit(Req, Num) == true)?Len:0;
+}
+
+/**
+  ******************************************************************
+  * @brief   向环形缓冲区加入数据，传输完成后发布数据
+  * @param   [in]cb 环形缓冲区句柄
+  * @param   [in]Src 源地址
+  * @param   [in]Len 元素个数，空间不足时加入可容纳的部分
+  * @param   [in]Elem_Size 元素字节数1/2/4
+  * @param   [in]Callback 完成回调，可为NULL
+  * @param   [in]User_Data 回调参数
+  * @return  加入的元素个数，队列满、上次加入未完成或为覆盖写入策略返回0
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t DMA_Copy_Port_CQ_Put(CQ_handleTypeDef *cb, const void *Src, uint32_t Len, uint32_t Elem_Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data)
+{
+  DMA_COPY_REQUEST_Typedef_t Req[2];
+  CQ_SpanTypeDef Span;
+  uint32_t Num = 0;
+
+  /*完成前入口未更新，再次预留会得到同一段空间；覆盖写入预留时移动出口，与消费者冲突*/
+  if(cb->policy == (uint8_t)CQ_POLICY_OVERWRITE_OLDEST || DMA_Copy_Port_Ring_Pending(cb, DMA_COPY_RELEASE_COMMIT) == true)
+  {
+    return 0;
+  }
+  switch(Elem_Size)
+  {
+    case 1:
+      Len = CQ_reserveWrite(cb, Len, &Span);
+      break;
+    case 2:
+      Len = CQ_16_reserveWrite(cb, Len, &Span);
+      break;
+    case 4:
+      Len = CQ_32_reserveWrite(cb, Len, &Span);
+      break;
+    default:
+      return 0;
+  }
+  if(Len == 0U)
+  {
+    return 0;
+  }
+
+  memset(Req, 0, sizeof(Req));
+  Req[Num].Dst = Span.first;
+  Req[Num].Src = Src;
+  Req[Num].Size = Span.first_len * Elem_Size;
+  Num++;
+  if(Span.second_len > 0U)
+  {
+    Req[Num].Dst = Span.second;
+    Req[Num].Src = (const uint8_t *)Src + Span.first_len * Elem_Size;
+    Req[Num].Size = Span.second_len * Elem_Size;
+    Num++;
+  }
+  Req[Num - 1U].Callback = Callback;
+  Req[Num - 1U].User_Data = User_Data;
+  Req[Num - 1U].Ring = cb;
+  Req[Num - 1U].Release_Len = Len;
+  Req[Num - 1U].Release = DMA_COPY_RELEASE_COMMIT;
+
+  return (DMA_Copy_Port_Submit(Req, Num) == true)?Len:0;
+}
+
+/**
+  ******************************************************************
+  * @brief   等待环形缓冲区的拷贝全部完成，不可在优先级不低于DMA_COPY_PORT_IRQ_PRIORITY的中断中调用
+  * @param   [in]cb 环形缓冲区句柄
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void DMA_Copy_Port_CQ_Wait(CQ_handleTypeDef *cb)
+{
+  uint32_t Start = DWT->CYCCNT;
+
+  if(DMA_Copy_Port_Ring_Pending(cb, DMA_COPY_RELEASE_NONE) == false)
+  {
+    return;
+  }
+  /*DMA出错时由错误中断改用CPU完成，不会一直等待*/
+  while(DMA_Copy_Port_Ring_Pending(cb, DMA_COPY_RELEASE_NONE) == true)
+  {
+  }
+  Copy_Stats.Wait_Cycles += DWT->CYCCNT - Start;
+}
+
+/**
+  ******************************************************************
+  * @brief   是否所有拷贝均已完成
+  * @param   [in]None
+  * @return  true 空闲
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool DMA_Copy_Port_Is_Idle(void)
+{
+  return (Copy_Count == 0U)?true:false;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取拷贝统计
+  * @param   [in]None
+  * @return  统计信息
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+const DMA_COPY_STATS_Typedef_t *DMA_Copy_Port_Get_Stats(void)
+{
+  return &Copy_Stats;
+}
+
+/**
+  ******************************************************************
+  * @brief   打印统计周期内每秒节省的CPU周期并清零计数
+  * @param   [in]Elapsed_Ms 统计周期
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void DMA_Copy_Port_Report(uint32_t Elapsed_Ms)
+{
+  int64_t Saved = 0;
+  int64_t Saved_Per_Sec = 0;
+  int64_t Load_x100 = 0;
+  uint32_t Primask = 0;
+  DMA_COPY_STATS_Typedef_t Stats;
+
+  if(Elapsed_Ms == 0U)
+  {
+    return;
+  }
+
+  Primask = __get_PRIMASK();
+  __disable_irq();
+  Stats = Copy_Stats;
+  Copy_Stats.Dma_Bytes = 0;
+  Copy_Stats.Dma_Count = 0;
+  Copy_Stats.Cpu_Bytes = 0;
+  Copy_Stats.Cpu_Count = 0;
+  Copy_Stats.Overhead_Cycles = 0;
+  Copy_Stats.Wait_Cycles = 0;
+  __set_PRIMASK(Primask);
+
+  /*DMA拷贝字节数按CPU拷贝耗时折算，减去启动、中断开销及等待完成的空转*/
+  Saved = (int64_t)Stats.Dma_Bytes * Stats.Memcpy_Cycles_256B / DMA_COPY_PORT_CALIB_SIZE
+          - (int64_t)Stats.Overhead_Cycles - (int64_t)Stats.Wait_Cycles;
+  Saved_Per_Sec = Saved * 1000 / Elapsed_Ms;
+  /*占CPU百分比，保留两位小数*/
+  Load_x100 = Saved_Per_Sec * 10000 / (int64_t)SystemCoreClock;
+
+  printf("dma copy: %lu B in %lu xfers, cpu %lu B in %lu copies, memcpy %lu cyc/256B\r\n",
+         (unsigned long)Stats.Dma_Bytes, (unsigned long)Stats.Dma_Count,
+         (unsigned long)Stats.Cpu_Bytes, (unsigned long)Stats.Cpu_Count,
+         (unsigned long)Stats.Memcpy_Cycles_256B);
+  printf("dma copy: overhead %lu cyc, wait %lu cyc, saved %ld cyc/s (%s%ld.%02ld%% cpu)\r\n",
+         (unsigned long)Stats.Overhead_Cycles, (unsigned long)Stats.Wait_Cycles, (long)Saved_Per_Sec,
+         (Load_x100 < 0)?"-":"",
+         (long)(((Load_x100 < 0)?-Load_x100:Load_x100) / 100),
+         (long)(((Load_x100 < 0)?-Load_x100:Load_x100) % 100));
+}
+
+/**
+  ******************************************************************
+  * @brief   按周期打印统计
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void DMA_Copy_Port_Poll(void)
+{
+  uint32_t Elapsed = HAL_GetTick() - Report_Tick;
+
+  if(Report_Period_Ms == 0U || Elapsed < Report_Period_Ms)
+  {
+    return;
+  }
+  DMA_Copy_Port_Report(Elapsed);
+  Report_Tick += Elapsed;
+}
+
+/**
+  ******************************************************************
+  * @brief   DMA拷贝接口初始化，需在Cmd_Port_Init之后调用
+  * @param   [in]None
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void DMA_Copy_Port_Init(void)
+{
+  /*启用DWT周期计数器*/
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(&Copy_Stats, 0, sizeof(Copy_Stats));
+  Copy_Stats.Memcpy_Cycles_256B = DMA_Copy_Port_Calibrate();
+
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  hdma_memtomem.Instance = DMA_COPY_PORT_STREAM;
+  hdma_memtomem.Init.Channel = DMA_CHANNEL_0;
+  hdma_memtomem.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hdma_memtomem.Init.PeriphInc = DMA_PINC_ENABLE;
+  hdma_memtomem.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_memtomem.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdma_memtomem.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+  hdma_memtomem.Init.Mode = DMA_NORMAL;
+  hdma_memtomem.Init.Priority = DMA_PRIORITY_LOW;
+  hdma_memtomem.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_memtomem.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_memtomem.Init.MemBurst = DMA_MBURST_SINGLE;
+  hdma_memtomem.Init.PeriphBurst = DMA_PBURST_SINGLE;
+  if(HAL_DMA_Init(&hdma_memtomem) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  hdma_memtomem.XferCpltCallback = DMA_Copy_Port_Cplt_Callback;
+  hdma_memtomem.XferErrorCallback = DMA_Copy_Port_Error_Callback;
+
+  HAL_NVIC_SetPriority(DMA_COPY_PORT_IRQn, DMA_COPY_PORT_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMA_COPY_PORT_IRQn);
+
+  /*DMA开销高于CPU拷贝的长度不使用DMA*/
+  DMA_Copy_Port_Update_Threshold();
+
+  Report_Tick = HAL_GetTick();
+  Cmd_Port_Register("dma", "dma copy stats: [<report period s, 0 off> | bench]", DMA_Copy_Port_Cmd);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
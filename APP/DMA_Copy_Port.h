@@ -0,0 +1,78 @@
+/**
+ *  @file DMA_Copy_Port.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief DMA内存拷贝接口
+ *
+ *  @version V1.0
+ */
+#ifndef DMA_COPY_PORT_H
+#define DMA_COPY_PORT_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+#include "CircularQueue.h"
+/** Private defines ----------------------------------------------------------*/
+#define DMA_COPY_PORT_THRESHOLD     128U  /**< 小于该字节数由CPU直接拷贝，初始化时按实测盈亏点上调*/
+#define DMA_COPY_PORT_QUEUE_SIZE    8U    /**< 等待传输的请求数*/
+#define DMA_COPY_PORT_REPORT_PERIOD 10U   /**< 默认统计打印周期(s)，为0时不打印*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/*拷贝完成回调，DMA完成时于中断中调用，CPU拷贝时直接调用*/
+typedef void (*DMA_COPY_DONE_CALLBACK_Typedef_t)(void *User_Data);
+
+/*拷贝统计*/
+typedef struct
+{
+  uint32_t Dma_Bytes;           /**< DMA拷贝字节数*/
+  uint32_t Dma_Count;           /**< DMA拷贝次数*/
+  uint32_t Cpu_Bytes;           /**< CPU拷贝字节数*/
+  uint32_t Cpu_Count;           /**< CPU拷贝次数*/
+  uint32_t Overhead_Cycles;     /**< DMA启动及完成中断耗费的CPU周期*/
+  uint32_t Wait_Cycles;         /**< 等待拷贝完成耗费的CPU周期*/
+  uint32_t Memcpy_Cycles_256B;  /**< 初始化时测得CPU拷贝256字节周期数*/
+  uint32_t Xfer_Cycles;         /**< 初始化时测得单次DMA传输的CPU开销(启动+完成中断)*/
+}DMA_COPY_STATS_Typedef_t;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*DMA拷贝接口初始化*/
+void DMA_Copy_Port_Init(void);
+/*拷贝数据，源、目标在完成回调前不可改动，队列满返回false*/
+bool DMA_Copy_Port_Start(void *Dst, const void *Src, uint32_t Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data);
+/*由环形缓冲区取出数据，完成后释放缓冲区空间，上次取出未完成时返回0；
+  覆盖写入策略的缓冲区在完成前生产者不可写入，写入前需DMA_Copy_Port_CQ_Wait*/
+uint32_t DMA_Copy_Port_CQ_Get(CQ_handleTypeDef *cb, void *Dst, uint32_t Len, uint32_t Elem_Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data);
+/*向环形缓冲区加入数据，完成后发布数据，上次加入未完成或为覆盖写入策略时返回0*/
+uint32_t DMA_Copy_Port_CQ_Put(CQ_handleTypeDef *cb, const void *Src, uint32_t Len, uint32_t Elem_Size, DMA_COPY_DONE_CALLBACK_Typedef_t Callback, void *User_Data);
+/*等待环形缓冲区的拷贝全部完成*/
+void DMA_Copy_Port_CQ_Wait(CQ_handleTypeDef *cb);
+/*是否所有拷贝均已完成*/
+bool DMA_Copy_Port_Is_Idle(void);
+/*获取拷贝统计*/
+const DMA_COPY_STATS_Typedef_t *DMA_Copy_Port_Get_Stats(void);
+/*打印每秒节省的CPU周期*/
+void DMA_Copy_Port_Report(uint32_t Elapsed_Ms);
+/*按周期打印统计，主循环中调用*/
+void DMA_Copy_Port_Poll(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -14,11 +14,17 @@
  *  @version v1.0
  */
 /** Includes -----------------------------------------------------------------*/
-#include <math.h>
 /* Private includes ----------------------------------------------------------*/
 #include "I2S_Audio_Port.h"
 #include "USB_Audio_Port.h"
 #include "Audio_Debug.h"
+#include "UART_Audio_Port.h"
+#include "Audio_Tap.h"
+#include "Audio_Capture.h"
+#include "Signal_Gen.h"
+#include "Cmd_Port.h"
+#include "CircularQueue.h"
+#include "Nco.h"
 #include "main.h"
 /* Use C compiler ------------------------------------------------------------*/
 #ifdef __cplusplus ///< use C compiler
@@ -27,24 +33,54 @@ extern "C" {
 /** Private typedef ----------------------------------------------------------*/
 /** Private macros -----------------------------------------------------------*/
 #define SIN_WAVE_SAMPLE_RATE	16000 /**< 16K采样*/
-#define SIN_WAVE_FQ				    250   /**< 100Hz正弦*/
-#define SIN_WAVE_MAX_POINTS		SIN_WAVE_SAMPLE_RATE/SIN_WAVE_FQ
-#define SIN_WAVE_DB_VAL 		  60.l
+#define SIN_WAVE_FQ				    250   /**< 默认250Hz正弦*/
+#define SIN_WAVE_DB_VAL 		  60.f  /**< 默认声压级dB SPL，94dB SPL对应0dBFS*/
+#define SIN_WAVE_DBFS         (SIN_WAVE_DB_VAL - 94.f)
+
+/*录音每点DMA半字数，24位数据帧先高半字后低半字*/
+#if I2S_AUDIO_PORT_SAMPLE_BITS == 24U
+  #define I2S_REC_HALFWORDS     2U
+#elif I2S_AUDIO_PORT_SAMPLE_BITS == 16U
+  #define I2S_REC_HALFWORDS     1U
+#else
+  #error "I2S_AUDIO_PORT_SAMPLE_BITS must be 16 or 24."
+#endif
+#define I2S_REC_FRAME_HALFWORDS (2U*I2S_REC_HALFWORDS)  /**< 一个立体声帧的半字数*/
+#define I2S_REC_BLOCK_HALFWORDS (STEREO_FRAME_SIZE*I2S_REC_HALFWORDS)  /**< 每处理帧读取的半字数*/
+/*录音环形区为每节拍读取量的倍数，节拍与I2S时钟漂移或主循环延迟时不丢数据，读取不追及DMA写位置*/
+#define I2S_REC_RING_TICKS      4U
+#define I2S_REC_RING_POINTS     (STEREO_FRAME_SIZE*I2S_REC_RING_TICKS)          /**< DMA循环传输点数*/
+#define I2S_REC_RING_HALFWORDS  (I2S_REC_RING_POINTS*I2S_REC_HALFWORDS)         /**< 录音环形区半字数*/
   
 /** Private constants --------------------------------------------------------*/
 /** Public variables ---------------------------------------------------------*/
 extern I2S_HandleTypeDef hi2s2;  
 /** Private variables --------------------------------------------------------*/
-/*音频缓冲区*/
-static int16_t Audio_Data_Rec_Buf[STEREO_FRAME_SIZE];
-/*测试音频缓冲区*/
-static int16_t Sin_Wave_PCM_Buf[SIN_WAVE_MAX_POINTS];
+/*音频缓冲区，DMA循环写入*/
+static int16_t Audio_Data_Rec_Buf[I2S_REC_RING_HALFWORDS];
+static CQ_DMA_handleTypeDef Audio_Rec_Handle;
+#if I2S_REC_HALFWORDS == 2U
+/*24-in-32录音帧*/
+static int32_t Rec_Frame_Buf[STEREO_FRAME_SIZE];
+#endif
+/*录音以完整精度直接输出至USB，调试数据不再写入USB*/
+static bool Rec_To_USB = false;
+/*测试正弦，左右通道独立*/
+static NCO_StateTypeDef Sine_Nco[2];
+static const char * const Sine_Name[2] = {"l", "r"};
 /*音频发送区*/
 static int16_t Audio_Data_Send_Buf[STEREO_FRAME_SIZE];
+/*录音分通道数据，仅抓取点选中时读取*/
+static int16_t Rec_Left_Buf[MONO_FRAME_SIZE];
+static int16_t Rec_Right_Buf[MONO_FRAME_SIZE];
+/*调试抓取点*/
+static uint8_t Tap_Sine_L = AUDIO_TAP_INVALID;
+static uint8_t Tap_Sine_R = AUDIO_TAP_INVALID;
+static uint8_t Tap_Mic_L = AUDIO_TAP_INVALID;
+static uint8_t Tap_Mic_R = AUDIO_TAP_INVALID;
 /*音频调试缓冲区*/
-static int16_t Debug_Auido_Buf[STEREO_FRAME_SIZE];
+static int16_t Debug_Auido_Buf[AUDIO_DEBUG_SEND_BUF_SIZE];
 /*音频标志位*/
-static volatile int16_t *Current_Opt_Rec_Buf_Sel = Audio_Data_Rec_Buf;
 static volatile uint8_t Received_Ok_Flag = 0;
 /** Private function prototypes ----------------------------------------------*/
 /** Private user code --------------------------------------------------------*/
@@ -62,65 +98,128 @@ static volatile uint8_t Received_Ok_Flag = 0;
   * @param   [in]None.
   * @return  None.
   * @author  aron566
-  * @version V1.0
-  * @date    2021-06-01
+  * @version V1.1
+  * @date    2026-10-17
   ******************************************************************
   */
 static void Sin_Audio_Init(void)
 {  
-  float Average_Range = (float)pow(10.L, (double)((double)SIN_WAVE_DB_VAL - 94.f) / 20.L)*32767.f;
-  for(int i = 0; i < SIN_WAVE_MAX_POINTS; i++)
+  for(uint8_t Ch = 0; Ch < 2U; Ch++)
   {
-    Sin_Wave_PCM_Buf[i] = (int16_t)(Average_Range * sin(2.f*3.14f * SIN_WAVE_FQ / SIN_WAVE_SAMPLE_RATE * i));
+    NCO_init(&Sine_Nco[Ch], SIN_WAVE_SAMPLE_RATE);
+    NCO_setFrequency(&Sine_Nco[Ch], (float)SIN_WAVE_FQ);
+    NCO_setLevel(&Sine_Nco[Ch], SIN_WAVE_DBFS);
   }
 }
 
 /**
   ******************************************************************
-  * @brief   测试USB音频数据
-  * @param   None.
+  * @brief   sine命令，改频相位连续
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
   * @return  None.
   * @author  aron566
   * @version V1.0
-  * @date    2021-06-01
+  * @date    2026-10-17
   ******************************************************************
   */
-static void Test_Audio_Port_Put_Data(void)
+static void Sine_Cmd(int Argc, char *Argv[])
 {
-  /*更新USB音频数据*/
-  static int index = 0;
-  for(int i = 0; i < MONO_FRAME_SIZE; i++)
+  uint32_t Freq_mHz = 0;
+  uint8_t First = 0;
+  uint8_t Last = 1;
+  float Freq = 0;
+  float Level = 0;
+  char *End = NULL;
+  bool Ok = false;
+  
+  if(Argc < 2)
   {
-    Audio_Data_Send_Buf[i] = Sin_Wave_PCM_Buf[index];/**< TO USB LEFT*/
-    Audio_Data_Send_Buf[MONO_FRAME_SIZE+i] = Sin_Wave_PCM_Buf[index];/**< TO USB RIGHT*/
-    index = ((index+1)%(SIN_WAVE_MAX_POINTS));
+    for(uint8_t Ch = 0; Ch < 2U; Ch++)
+    {
+      Freq_mHz = (uint32_t)(NCO_getFrequency(&Sine_Nco[Ch]) * 1000.f + 0.5f);
+      printf("sine %s %lu.%03luHz gain %ld/32767\r\n", Sine_Name[Ch], (unsigned long)(Freq_mHz / 1000U),
+             (unsigned long)(Freq_mHz % 1000U), (long)Sine_Nco[Ch].gain);
+    }
+    return;
+  }
+  
+  if(strcmp(Argv[1], "l") == 0)
+  {
+    Last = 0;
   }
+  else if(strcmp(Argv[1], "r") == 0)
+  {
+    First = 1;
+  }
+  else if(strcmp(Argv[1], "all") != 0)
+  {
+    Argc = 0;
+  }
+  
+  if(Argc == 3 || Argc == 4)
+  {
+    Freq = strtof(Argv[2], &End);
+    Ok = (End != Argv[2] && *End == '\0');
+    if(Argc == 4)
+    {
+      Level = strtof(Argv[3], &End);
+      Ok = Ok && (End != Argv[3] && *End == '\0');
+    }
+  }
+  for(uint8_t Ch = First; Ok == true && Ch <= Last; Ch++)
+  {
+    Ok = NCO_setFrequency(&Sine_Nco[Ch], Freq);
+    if(Ok == true && Argc == 4)
+    {
+      NCO_setLevel(&Sine_Nco[Ch], Level);
+    }
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: sine | sine <l|r|all> <hz> [dBFS]");
+}
+
+/**
+  ******************************************************************
+  * @brief   测试USB音频数据
+  * @param   None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Test_Audio_Port_Put_Data(void)
+{
+  /*整块生成，TO USB LEFT / TO USB RIGHT*/
+  NCO_render(&Sine_Nco[0], Audio_Data_Send_Buf, 1, MONO_FRAME_SIZE);
+  NCO_render(&Sine_Nco[1], &Audio_Data_Send_Buf[MONO_FRAME_SIZE], 1, MONO_FRAME_SIZE);
 }
 
 /**
   ******************************************************************
   * @brief   发送数据接口
-  * @param   Data 数据.
+  * @param   Data 多通道交织数据.
   * @param   Len 数据字节数.
   * @return  已发送长度.
   * @author  aron566
-  * @version V1.0
-  * @date    2021-10-02
+  * @version V1.2
+  * @date    2026-10-17
   ******************************************************************
   */
 static uint32_t Send_Data_Func_Port(uint8_t *Data, uint32_t Len)
 {
-  int16_t *Ptr = (int16_t *)Data;
-  /*分离左右通道数据*/
-  int16_t Left_Audio[MONO_FRAME_SIZE], Right_Audio[MONO_FRAME_SIZE];
-  int index = 0;
-  for(int i = 0; i < MONO_FRAME_SIZE; i++)
+  /*分帧数据按原始字流经USB传输，由上位机按同步字解析*/
+  if(Audio_Debug_Get_Frame_Mode() == true)
+  {
+    USB_Audio_Port_Put_Raw_Data((const uint16_t *)Data, Len/sizeof(int16_t));
+    return Len;
+  }
+  if(Rec_To_USB == true)
   {
-    Left_Audio[i] = Ptr[index++];
-    Right_Audio[i] = Ptr[index++];
+    return Len;
   }
-  /*发送音频数据到USB*/ 
-  USB_Audio_Port_Put_Data(Left_Audio, Right_Audio, Len/sizeof(int16_t));
+  /*调试数据与USB同为CH1 CH2 ...交织，按USB当前通道数直接写入*/
+  USB_Audio_Port_Put_Interleaved_Data((const int16_t *)Data, Len/sizeof(int16_t), Audio_Debug_Get_Channel_Number());
   return Len;
 }
 
@@ -143,6 +242,107 @@ static bool Get_Idel_State_Port(void)
   return true;
 }
 
+/**
+  ******************************************************************
+  * @brief   同步录音写位置，出口对齐至立体声帧起点
+  * @param   None.
+  * @return  可读半字数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t I2S_Audio_Port_Rec_Sync(void)
+{
+  uint32_t Len = CQ_DMA_sync(&Audio_Rec_Handle);
+  /*读取滞后被覆盖时出口可能落在帧中间，跳至下一帧起点，避免左右及高低半字错位*/
+  uint32_t Skip = (0U - Audio_Rec_Handle.cq.exit) & (I2S_REC_FRAME_HALFWORDS - 1U);
+  
+  Skip = GET_MIN(Skip, Len);
+  CQ_consumeRead(&Audio_Rec_Handle.cq, Skip);
+  return Len - Skip;
+}
+
+/**
+  ******************************************************************
+  * @brief   处理一帧：读取一块录音，发布抓取点并送至各输出
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void I2S_Audio_Port_Frame_Process(void)
+{
+  const int16_t * const *Channel_Data = NULL;
+  uint8_t Channel_Total = 0;
+  
+  /*发布抓取点，仅为抓取准备的数据在选中时生成*/
+  if(Audio_Tap_Is_Selected(Tap_Sine_L) == true || Audio_Tap_Is_Selected(Tap_Sine_R) == true)
+  {
+    Test_Audio_Port_Put_Data();
+    AUDIO_TAP_PUBLISH(Tap_Sine_L, Audio_Data_Send_Buf);
+    AUDIO_TAP_PUBLISH(Tap_Sine_R, &Audio_Data_Send_Buf[MONO_FRAME_SIZE]);
+  }
+#if I2S_REC_HALFWORDS == 2U
+  /*24位录音：抓取点取高16位；USB为24/32位备用设置且非分帧模式时以完整精度直接输出*/
+  Rec_To_USB = (USB_Audio_Port_Get_Subframe_Size() > sizeof(int16_t) && Audio_Debug_Get_Frame_Mode() == false);
+  if(I2S_Audio_Port_Get_Rec_Data_32(Rec_Frame_Buf, STEREO_FRAME_SIZE) == STEREO_FRAME_SIZE)
+  {
+    if(Audio_Tap_Is_Selected(Tap_Mic_L) == true || Audio_Tap_Is_Selected(Tap_Mic_R) == true)
+    {
+      for(uint32_t i = 0; i < MONO_FRAME_SIZE; i++)
+      {
+        Rec_Left_Buf[i] = (int16_t)(Rec_Frame_Buf[2U*i] >> 16);
+        Rec_Right_Buf[i] = (int16_t)(Rec_Frame_Buf[2U*i + 1U] >> 16);
+      }
+      AUDIO_TAP_PUBLISH(Tap_Mic_L, Rec_Left_Buf);
+      AUDIO_TAP_PUBLISH(Tap_Mic_R, Rec_Right_Buf);
+    }
+    if(Rec_To_USB == true)
+    {
+      USB_Audio_Port_Put_Interleaved_Data_32(Rec_Frame_Buf, STEREO_FRAME_SIZE, 2U);
+    }
+  }
+#else
+  if(Audio_Tap_Is_Selected(Tap_Mic_L) == true || Audio_Tap_Is_Selected(Tap_Mic_R) == true)
+  {
+    if(I2S_Audio_Port_Get_Rec_Planar_Data(Rec_Left_Buf, Rec_Right_Buf, MONO_FRAME_SIZE) == MONO_FRAME_SIZE)
+    {
+      AUDIO_TAP_PUBLISH(Tap_Mic_L, Rec_Left_Buf);
+      AUDIO_TAP_PUBLISH(Tap_Mic_R, Rec_Right_Buf);
+    }
+  }
+  else
+  {
+    /*未选中时直接释放本块，保持读位置跟随*/
+    CQ_consumeRead(&Audio_Rec_Handle.cq, I2S_REC_BLOCK_HALFWORDS);
+  }
+#endif
+  /*测试信号发生器*/
+  Signal_Gen_Start();
+  Channel_Total = Audio_Tap_Get_Channel_Data(&Channel_Data);
+  
+  /*触发抓取，上传期间暂停实时发送*/
+  Audio_Capture_Put_Channel_Data(Channel_Data, Channel_Total);
+  if(Audio_Capture_Get_State() == AUDIO_CAPTURE_UPLOADING)
+  {
+    Audio_Debug_Skip_Frame();
+  }
+  else
+  {
+    /*加入音频到调试接口 -> USB，缓冲区满时由环形区丢弃最旧数据*/
+    Audio_Debug_Put_Channel_Data(Channel_Data, Channel_Total);
+  }
+  Audio_Capture_Start();
+  Audio_Debug_Start();
+  
+  /*串口低带宽输出，未选择通道时无开销*/
+  UART_Audio_Port_Put_Channel_Data(Channel_Data, Channel_Total, MONO_FRAME_SIZE);
+  UART_Audio_Port_Start();
+}
+
 /** Public application code --------------------------------------------------*/
 /*******************************************************************************
 *
@@ -152,36 +352,100 @@ static bool Get_Idel_State_Port(void)
 */
 /**
   ******************************************************************
-  * @brief   音频半传输完成中断
-  * @param   [in]hi2s 句柄
-  * @return  None.
+  * @brief   读取I2S录音数据，写位置由DMA剩余计数得出，可按点读取
+  * @param   [out]Data 交织数据LEFT RIGHT LEFT RIGHT......
+  * @param   [in]Size 期望读取点数，按左右声道成对取整
+  * @return  实际读取点数.
   * @author  aron566
   * @version v1.0
-  * @date    2021/10/1
+  * @date    2026-10-17
   ******************************************************************
   */
-void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
+uint32_t I2S_Audio_Port_Get_Rec_Data(int16_t *Data, uint32_t Size)
 {
-  (void)(hi2s);
-  Current_Opt_Rec_Buf_Sel = Audio_Data_Rec_Buf;
-  Received_Ok_Flag = 1;
+  uint32_t Len = I2S_Audio_Port_Rec_Sync() / I2S_REC_HALFWORDS;
+  Size = GET_MIN(Size, Len) & ~1U;
+#if I2S_REC_HALFWORDS == 2U
+  /*24位数据帧仅取各点高半字*/
+  uint16_t * const Channel_Data[I2S_REC_FRAME_HALFWORDS] = {(uint16_t *)Data, NULL, (uint16_t *)Data + 1, NULL};
+  return CQ_16getDeinterleaved(&Audio_Rec_Handle.cq, Channel_Data, I2S_REC_FRAME_HALFWORDS, 2, Size/2U) * 2U;
+#else
+  return CQ_16getData(&Audio_Rec_Handle.cq, (uint16_t *)Data, Size);
+#endif
 }
 
 /**
   ******************************************************************
-  * @brief   音频传输完成中断
-  * @param   [in]hi2s 句柄
+  * @brief   读取I2S录音数据，24-in-32左对齐，16位数据帧时扩展至高16位
+  * @param   [out]Data 交织数据LEFT RIGHT LEFT RIGHT......
+  * @param   [in]Size 期望读取点数，按左右声道成对取整
+  * @return  实际读取点数.
+  * @author  aron566
+  * @version v1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t I2S_Audio_Port_Get_Rec_Data_32(int32_t *Data, uint32_t Size)
+{
+  uint32_t Len = I2S_Audio_Port_Rec_Sync() / I2S_REC_HALFWORDS;
+  Size = GET_MIN(Size, Len) & ~1U;
+  Size = CQ_16getData(&Audio_Rec_Handle.cq, (uint16_t *)Data, Size * I2S_REC_HALFWORDS) / I2S_REC_HALFWORDS;
+#if I2S_REC_HALFWORDS == 2U
+  /*DMA先写高半字，交换为左对齐int32*/
+  for(uint32_t i = 0; i < Size; i++)
+  {
+    Data[i] = (int32_t)__ROR((uint32_t)Data[i], 16U);
+  }
+#else
+  /*由尾部向前扩展，避免覆盖未转换的数据*/
+  for(uint32_t i = Size; i > 0U; i--)
+  {
+    Data[i - 1U] = (int32_t)((uint32_t)((uint16_t *)Data)[i - 1U] << 16);
+  }
+#endif
+  return Size;
+}
+
+/**
+  ******************************************************************
+  * @brief   按通道读取I2S录音数据
+  * @param   [out]Left_Data 左通道数据，为NULL时丢弃
+  * @param   [out]Right_Data 右通道数据，为NULL时丢弃
+  * @param   [in]Frames 期望读取每通道点数
+  * @return  实际读取每通道点数.
+  * @author  aron566
+  * @version v1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t I2S_Audio_Port_Get_Rec_Planar_Data(int16_t *Left_Data, int16_t *Right_Data, uint32_t Frames)
+{
+#if I2S_REC_HALFWORDS == 2U
+  /*24位数据帧仅取各点高半字*/
+  uint16_t * const Channel_Data[I2S_REC_FRAME_HALFWORDS] = {(uint16_t *)Left_Data, NULL, (uint16_t *)Right_Data, NULL};
+#else
+  uint16_t * const Channel_Data[I2S_REC_FRAME_HALFWORDS] = {(uint16_t *)Left_Data, (uint16_t *)Right_Data};
+#endif
+  I2S_Audio_Port_Rec_Sync();
+  return CQ_16getDeinterleaved(&Audio_Rec_Handle.cq, Channel_Data, I2S_REC_FRAME_HALFWORDS, 1, Frames);
+}
+
+/**
+  ******************************************************************
+  * @brief   I2S接收DMA传输完成，录音环形区写满一圈
+  * @param   [in]hi2s I2S句柄.
   * @return  None.
   * @author  aron566
   * @version v1.0
-  * @date    2021/10/1
+  * @date    2026-10-17
   ******************************************************************
   */
 void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
-  (void)(hi2s);
-  Current_Opt_Rec_Buf_Sel = &Audio_Data_Rec_Buf[MONO_FRAME_SIZE];
-  Received_Ok_Flag = 1;
+  if(hi2s == &hi2s2)
+  {
+    CQ_DMA_lapComplete(&Audio_Rec_Handle);
+  }
 }
 
 /**
@@ -215,14 +479,14 @@ void I2S_Audio_Port_Start(void)
   {
     return;
   }
-  /*加入音频到调试接口 -> USB*/
-  if(USB_Audio_Port_Can_Put_Data() == false)
+  /*I2S时钟(约16.13kHz)与TIM1节拍存在偏差，每节拍处理全部整块录音，帧节拍跟随录音时钟；
+    不足一块的数据留待下一节拍，积压不超过一块*/
+  uint32_t Blocks = I2S_Audio_Port_Rec_Sync() / I2S_REC_BLOCK_HALFWORDS;
+  
+  for(; Blocks > 0U; Blocks--)
   {
-    return;
+    I2S_Audio_Port_Frame_Process();
   }
-  Test_Audio_Port_Put_Data();
-  Audio_Debug_Put_Data(Audio_Data_Send_Buf, &Audio_Data_Send_Buf[MONO_FRAME_SIZE], 0);
-  Audio_Debug_Start();
   
   /*取出音频数据给USB*/
 //  Test_Audio_Port_Put_Data();
@@ -245,12 +509,32 @@ void I2S_Audio_Port_Init(void)
 {
   /*正弦音频*/
   Sin_Audio_Init();
+  Cmd_Port_Register("sine", "test sine: [<l|r|all> <hz> [dBFS]]", Sine_Cmd);
   
   /*初始化音频调试接口*/
   Audio_Debug_Init((uint16_t *)Debug_Auido_Buf, Send_Data_Func_Port, Get_Idel_State_Port);
   
-  /*启动接收*/
-  HAL_I2S_Receive_DMA(&hi2s2, (uint16_t *)Audio_Data_Rec_Buf, STEREO_FRAME_SIZE);
+  /*注册抓取点，默认发送正弦测试音*/
+  Tap_Sine_L = Audio_Tap_Register("sine_l");
+  Tap_Sine_R = Audio_Tap_Register("sine_r");
+  Tap_Mic_L = Audio_Tap_Register("mic_l");
+  Tap_Mic_R = Audio_Tap_Register("mic_r");
+  Audio_Tap_Map(0, "sine_l");
+  Audio_Tap_Map(1, "sine_r");
+  
+#if I2S_REC_HALFWORDS == 2U
+  /*24位数据帧(24-in-32)，DMA仍按半字传输*/
+  hi2s2.Init.DataFormat = I2S_DATAFORMAT_24B;
+  HAL_I2S_Init(&hi2s2);
+#endif
+  
+  /*录音环形区，入口跟随DMA剩余计数(半字)*/
+  CQ_DMA_16_init(&Audio_Rec_Handle, (uint16_t *)Audio_Data_Rec_Buf, I2S_REC_RING_HALFWORDS, &hi2s2.hdmarx->Instance->NDTR);
+  CQ_registerStats(&Audio_Rec_Handle.cq, "i2s_rec");
+  
+  /*启动接收，数据由DMA写位置读取，节拍由TIM1提供；传输完成中断仅计圈数；24位时Size为点数，HAL按半字加倍*/
+  HAL_I2S_Receive_DMA(&hi2s2, (uint16_t *)Audio_Data_Rec_Buf, I2S_REC_RING_POINTS);
+  __HAL_DMA_DISABLE_IT(hi2s2.hdmarx, DMA_IT_HT);
 }
 
 #ifdef __cplusplus ///<end extern c
@@ -32,6 +32,8 @@ extern "C" {
 /** Exported macros-----------------------------------------------------------*/
 #define MONO_FRAME_SIZE                       128
 #define STEREO_FRAME_SIZE                     (MONO_FRAME_SIZE*2U)  
+/*I2S数据帧位宽：16或24(24-in-32)，24位时USB选择24/32位备用设置则录音以完整精度直接输出*/
+#define I2S_AUDIO_PORT_SAMPLE_BITS            16U
 /** Exported variables -------------------------------------------------------*/
 /** Exported functions prototypes --------------------------------------------*/
 
@@ -41,6 +43,12 @@ void I2S_Audio_Port_Init(void);
 void I2S_Audio_Port_Start(void);
 /*音频接口任务使能*/
 void I2S_Audio_Port_Task_Start(void);
+/*读取I2S录音数据*/
+uint32_t I2S_Audio_Port_Get_Rec_Data(int16_t *Data, uint32_t Size);
+/*读取I2S录音数据，24-in-32左对齐*/
+uint32_t I2S_Audio_Port_Get_Rec_Data_32(int32_t *Data, uint32_t Size);
+/*按通道读取I2S录音数据*/
+uint32_t I2S_Audio_Port_Get_Rec_Planar_Data(int16_t *Left_Data, int16_t *Right_Data, uint32_t Frames);
 
 #ifdef __cplusplus ///<end extern c
 }
@@ -0,0 +1,366 @@
+/**
+ *  @file Signal_Gen.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright Copyright (c) 2021 aron566 <aron566@163.com>.
+ *
+ *  @brief 测试信号发生器
+ *
+ *  @details 1、SIGNAL_GEN_NUM个发生器分别发布为抓取点gen0..，由tap set <通道> gen<n>选择输出通道.
+ *           2、每帧整块生成AUDIO_DEBUG_FRAME_MONO_SIZE点，仅被选中且未关闭的发生器生成，逐点为定点运算.
+ *           3、噪声随机数取自硬件RNG，每个随机数32位.
+ *           4、命令：gen / gen <n> off / gen <n> sine <hz> / gen <n> <white|pink> /
+ *              gen <n> chirp <lin|log> <f0> <f1> <ms> / gen <n> mls <阶数> / gen <n> multi <flo> <fhi> <音数> /
+ *              gen <n> dtmf <号码> <on_ms> <off_ms> / gen <n> imp <period_ms>，末尾可附加电平dBFS.
+ *           5、所有接口需在主循环中调用.
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+
+/* Private includes ----------------------------------------------------------*/
+#include "Signal_Gen.h"
+#include "SignalGen.h"
+#include "Audio_Tap.h"
+#include "Audio_Debug.h"
+#include "Cmd_Port.h"
+#include "main.h"
+
+/** Use C compiler -----------------------------------------------------------*/
+#ifdef __cplusplus ///< use C compiler
+extern "C" {
+#endif
+/** Private typedef ----------------------------------------------------------*/
+/*命令信号类型*/
+typedef enum
+{
+  GEN_CMD_OFF = 0,
+  GEN_CMD_SINE,
+  GEN_CMD_WHITE,
+  GEN_CMD_PINK,
+  GEN_CMD_CHIRP,
+  GEN_CMD_MLS,
+  GEN_CMD_MULTI,
+  GEN_CMD_DTMF,
+  GEN_CMD_IMP,
+  GEN_CMD_NUM,
+}GEN_CMD_TYPE_Typedef_t;
+/** Private macros -----------------------------------------------------------*/
+#define GEN_FRAME_SIZE          AUDIO_DEBUG_FRAME_MONO_SIZE
+#define GEN_MS_MAX              60000U    /**< 时长参数上限*/
+#define GEN_RNG_TIMEOUT         100U      /**< 等待随机数就绪次数*/
+/** Private constants --------------------------------------------------------*/
+static const char * const Tap_Name[] = {"gen0", "gen1", "gen2", "gen3", "gen4", "gen5", "gen6", "gen7"};
+static const char * const Type_Name[] = {"off", "sine", "white", "pink", "chirp_lin", "chirp_log", "mls", "multi", "dtmf", "imp"};
+/*命令信号名称及必需参数个数(不含电平)*/
+static const char * const Cmd_Name[GEN_CMD_NUM] = {"off", "sine", "white", "pink", "chirp", "mls", "multi", "dtmf", "imp"};
+static const uint8_t Cmd_Arg_Num[GEN_CMD_NUM] = {0, 1, 0, 0, 4, 1, 3, 3, 1};
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static SG_HandleTypeDef Gen[SIGNAL_GEN_NUM];
+static int16_t Gen_Buf[SIGNAL_GEN_NUM][GEN_FRAME_SIZE];
+static uint8_t Tap_Gen[SIGNAL_GEN_NUM];
+static uint32_t Rand_State = 1U;
+/** Private function prototypes ----------------------------------------------*/
+
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+#if SIGNAL_GEN_NUM > 8U
+  #error "SIGNAL_GEN_NUM must not exceed 8."
+#endif
+
+/**
+  ******************************************************************
+  * @brief   硬件RNG初始化
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Signal_Gen_Rng_Init(void)
+{
+  /*RNG时钟取自PLL48CLK，与USB共用*/
+  __HAL_RCC_RNG_CLK_ENABLE();
+  RNG->CR |= RNG_CR_RNGEN;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取32位随机数
+  * @param   [in]None.
+  * @return  随机数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t Signal_Gen_Rand(void)
+{
+  /*种子或时钟错误时重新使能*/
+  if((RNG->SR & (RNG_SR_SEIS | RNG_SR_CEIS)) != 0U)
+  {
+    RNG->SR &= ~(RNG_SR_SEIS | RNG_SR_CEIS);
+    RNG->CR &= ~RNG_CR_RNGEN;
+    RNG->CR |= RNG_CR_RNGEN;
+  }
+  for(uint32_t i = 0; i < GEN_RNG_TIMEOUT && (RNG->SR & RNG_SR_DRDY) == 0U; i++)
+  {
+  }
+  /*叠加LCG，RNG未就绪重复读取同一值时仍不产生直流*/
+  Rand_State = Rand_State * 1664525U + 1013904223U;
+  return RNG->DR ^ Rand_State;
+}
+
+/**
+  ******************************************************************
+  * @brief   解析浮点参数
+  * @param   [in]Str 参数.
+  * @param   [out]Value 数值.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Signal_Gen_Parse_Float(const char *Str, float *Value)
+{
+  char *End = NULL;
+
+  *Value = strtof(Str, &End);
+  return (End != Str && *End == '\0');
+}
+
+/**
+  ******************************************************************
+  * @brief   解析无符号整数参数
+  * @param   [in]Str 参数.
+  * @param   [in]Max 上限.
+  * @param   [out]Value 数值.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Signal_Gen_Parse_Uint(const char *Str, uint32_t Max, uint32_t *Value)
+{
+  char *End = NULL;
+  unsigned long Result = strtoul(Str, &End, 10);
+
+  *Value = (uint32_t)Result;
+  return (End != Str && *End == '\0' && *Str != '-' && Result <= Max);
+}
+
+/**
+  ******************************************************************
+  * @brief   毫秒转换为点数
+  * @param   [in]Str 参数.
+  * @param   [out]Samples 点数.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Signal_Gen_Parse_Ms(const char *Str, uint32_t *Samples)
+{
+  uint32_t Ms = 0;
+
+  if(Signal_Gen_Parse_Uint(Str, GEN_MS_MAX, &Ms) == false)
+  {
+    return false;
+  }
+  *Samples = Ms * SIGNAL_GEN_SAMPLE_RATE / 1000U;
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   打印各发生器状态
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Signal_Gen_List(void)
+{
+  for(uint8_t Id = 0; Id < SIGNAL_GEN_NUM; Id++)
+  {
+    printf("%s %s gain %ld/32767%s\r\n", Tap_Name[Id], Type_Name[Gen[Id].type], (long)Gen[Id].gain,
+           (Audio_Tap_Is_Selected(Tap_Gen[Id]) == true)?" [tap]":"");
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   按命令参数设置发生器
+  * @param   [in]sg 发生器.
+  * @param   [in]Type 命令信号类型.
+  * @param   [in]Argv 信号参数.
+  * @param   [in]Level 电平dBFS.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static bool Signal_Gen_Set(SG_HandleTypeDef *sg, GEN_CMD_TYPE_Typedef_t Type, char *Argv[], float Level)
+{
+  float Freq[2] = {0};
+  uint32_t Value[2] = {0};
+
+  switch(Type)
+  {
+    case GEN_CMD_OFF:
+      SG_setOff(sg);
+      return true;
+    case GEN_CMD_SINE:
+      return Signal_Gen_Parse_Float(Argv[0], &Freq[0]) && SG_setSine(sg, Freq[0], Level);
+    case GEN_CMD_WHITE:
+      return SG_setWhite(sg, Level);
+    case GEN_CMD_PINK:
+      return SG_setPink(sg, Level);
+    case GEN_CMD_CHIRP:
+      if(strcmp(Argv[0], "lin") != 0 && strcmp(Argv[0], "log") != 0)
+      {
+        return false;
+      }
+      return Signal_Gen_Parse_Float(Argv[1], &Freq[0]) && Signal_Gen_Parse_Float(Argv[2], &Freq[1])
+             && Signal_Gen_Parse_Ms(Argv[3], &Value[0])
+             && SG_setChirp(sg, Freq[0], Freq[1], Value[0], (strcmp(Argv[0], "log") == 0), Level);
+    case GEN_CMD_MLS:
+      return Signal_Gen_Parse_Uint(Argv[0], SG_MLS_ORDER_MAX, &Value[0]) && SG_setMls(sg, (uint8_t)Value[0], Level);
+    case GEN_CMD_MULTI:
+      return Signal_Gen_Parse_Float(Argv[0], &Freq[0]) && Signal_Gen_Parse_Float(Argv[1], &Freq[1])
+             && Signal_Gen_Parse_Uint(Argv[2], SG_MULTITONE_MAX, &Value[0])
+             && SG_setMultitone(sg, Freq[0], Freq[1], (uint8_t)Value[0], Level);
+    case GEN_CMD_DTMF:
+      return Signal_Gen_Parse_Ms(Argv[1], &Value[0]) && Signal_Gen_Parse_Ms(Argv[2], &Value[1])
+             && SG_setDtmf(sg, Argv[0], Value[0], Value[1], Level);
+    case GEN_CMD_IMP:
+      return Signal_Gen_Parse_Ms(Argv[0], &Value[0]) && SG_setImpulse(sg, Value[0], Level);
+    default:
+      return false;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   gen命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void Signal_Gen_Cmd(int Argc, char *Argv[])
+{
+  uint32_t Id = 0;
+  uint32_t Type = 0;
+  float Level = SIGNAL_GEN_DBFS_DEFAULT;
+  bool Ok = false;
+
+  if(Argc < 2)
+  {
+    Signal_Gen_List();
+    return;
+  }
+  if(Argc >= 3 && Signal_Gen_Parse_Uint(Argv[1], SIGNAL_GEN_NUM - 1U, &Id) == true)
+  {
+    for(Type = 0; Type < (uint32_t)GEN_CMD_NUM && strcmp(Argv[2], Cmd_Name[Type]) != 0; Type++)
+    {
+    }
+  }
+  else
+  {
+    Type = (uint32_t)GEN_CMD_NUM;
+  }
+
+  /*信号参数后可附加电平*/
+  if(Type < (uint32_t)GEN_CMD_NUM)
+  {
+    Ok = (Argc == 3 + Cmd_Arg_Num[Type]);
+    if(Argc == 4 + Cmd_Arg_Num[Type] && Type != (uint32_t)GEN_CMD_OFF)
+    {
+      Ok = Signal_Gen_Parse_Float(Argv[Argc - 1], &Level);
+    }
+    Ok = Ok && Signal_Gen_Set(&Gen[Id], (GEN_CMD_TYPE_Typedef_t)Type, &Argv[3], Level);
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: gen | gen <n> off | gen <n> sine <hz> | gen <n> <white|pink> | "
+         "gen <n> chirp <lin|log> <f0> <f1> <ms> | gen <n> mls <2-20> | gen <n> multi <flo> <fhi> <1-16> | "
+         "gen <n> dtmf <digits> <on_ms> <off_ms> | gen <n> imp <ms>, optional trailing dBFS");
+}
+
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+  ******************************************************************
+  * @brief   生成一帧并发布抓取点
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Signal_Gen_Start(void)
+{
+  for(uint8_t Id = 0; Id < SIGNAL_GEN_NUM; Id++)
+  {
+    if(Gen[Id].type == SG_TYPE_OFF || Audio_Tap_Is_Selected(Tap_Gen[Id]) == false)
+    {
+      continue;
+    }
+    SG_render(&Gen[Id], Gen_Buf[Id], 1, GEN_FRAME_SIZE);
+    AUDIO_TAP_PUBLISH(Tap_Gen[Id], Gen_Buf[Id]);
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   发生器初始化，需在Audio_Tap_Init之后调用
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void Signal_Gen_Init(void)
+{
+  Signal_Gen_Rng_Init();
+  for(uint8_t Id = 0; Id < SIGNAL_GEN_NUM; Id++)
+  {
+    SG_init(&Gen[Id], SIGNAL_GEN_SAMPLE_RATE, Signal_Gen_Rand);
+    Tap_Gen[Id] = Audio_Tap_Register(Tap_Name[Id]);
+  }
+
+  Cmd_Port_Register("gen", "test signals: [<n> <off|sine|white|pink|chirp|mls|multi|dtmf|imp> ...]", Signal_Gen_Cmd);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,47 @@
+/**
+ *  @file Signal_Gen.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 测试信号发生器，以抓取点gen0..输出至调试通道
+ *
+ *  @version V1.0
+ */
+#ifndef SIGNAL_GEN_H
+#define SIGNAL_GEN_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define SIGNAL_GEN_NUM                4U        /**< 发生器数，每个占用一个抓取点*/
+#define SIGNAL_GEN_SAMPLE_RATE        16000U
+#define SIGNAL_GEN_DBFS_DEFAULT       (-20.f)   /**< 未指定电平时的默认电平*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*发生器初始化，注册抓取点及gen命令，需在Audio_Tap_Init之后调用*/
+void Signal_Gen_Init(void);
+/*生成一帧并发布，仅被选中且未关闭的发生器生成，需在Audio_Tap_Get_Channel_Data之前调用*/
+void Signal_Gen_Start(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,421 @@
+/**
+ *  @file UART_Audio_Port.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright Copyright (c) 2021 aron566 <aron566@163.com>.
+ *
+ *  @brief 串口低带宽音频输出，IMA-ADPCM编码后经UART1发送
+ *
+ *  @details 1、各通道独立选择模式，每通道每UART_AUDIO_PORT_FRAME_SAMPLES点封装为一帧，帧格式见AudioFrame.h，
+ *              channel_map指示来源通道，decimation指示采样率分频，上位机以AF_decoderPush解码并写WAV.
+ *           2、115200波特率下可同时输出一路16kHz或两路8kHz，超出带宽时发送缓冲区满，整帧丢弃并计入drop_count.
+ *           3、编码帧存入发送环形区，主循环中以中断方式发送连续段，发送完成后释放.
+ *           4、与printf共用UART1，发送期间的printf输出将丢失，上位机按同步字及CRC重新同步.
+ *           5、加入与发送需在同一上下文中调用，每次加入点数须为4的整数倍.
+ *           6、命令adpcm <ch> <off|16k|8k>选择通道模式，无参数时打印各通道模式及丢弃点数，
+ *              上位机以Tools/af_wav将抓取的串口数据解码为每通道一个WAV文件.
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+
+/* Private includes ----------------------------------------------------------*/
+#include "UART_Audio_Port.h"
+#include "UART_Port.h"
+#include "Audio_Debug.h"
+#include "ImaAdpcm.h"
+#include "Cmd_Port.h"
+#include "main.h"
+
+/** Use C compiler -----------------------------------------------------------*/
+#ifdef __cplusplus ///< use C compiler
+extern "C" {
+#endif
+/** Private typedef ----------------------------------------------------------*/
+/*通道编码状态*/
+typedef struct
+{
+  UART_AUDIO_MODE_Typedef_t Mode;
+  IMA_StateTypeDef State;
+  uint32_t Fill;                /**< 当前帧已编码点数*/
+  uint32_t Sample_Counter;      /**< 当前帧首点的累计点数*/
+  uint16_t Frame_Buf[UART_AUDIO_PORT_FRAME_SIZE / 2U];
+}UART_AUDIO_CHANNEL_Typedef_t;
+/** Private macros -----------------------------------------------------------*/
+#define UART_AUDIO_TX_BUF_SIZE      CQ_BUF_1KB  /**< 发送环形区大小*/
+#define UART_AUDIO_DECIM_CHUNK      64U         /**< 抽取每次处理输入点数*/
+
+#if (UART_AUDIO_PORT_FRAME_SAMPLES % 2U) != 0
+  #error "UART_AUDIO_PORT_FRAME_SAMPLES must be even."
+#endif
+/** Private constants --------------------------------------------------------*/
+static const char *const Mode_Name[UART_AUDIO_MODE_MAX] = {"off", "16k", "8k"};
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static UART_AUDIO_CHANNEL_Typedef_t Channel_State[UART_AUDIO_PORT_CHANNEL_MAX];
+/*发送环形区*/
+static uint8_t Tx_Buf[UART_AUDIO_TX_BUF_SIZE];
+static CQ_handleTypeDef CQ_Tx_Handle;
+static uint32_t Sending_Len = 0;
+static Uart_Dev_Handle_t *Uart_Handle = NULL;
+/*发送区满丢弃点数*/
+static uint32_t Drop_Count = 0;
+/** Private function prototypes ----------------------------------------------*/
+
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+  ******************************************************************
+  * @brief   完成一帧：填写帧头及CRC，存入发送环形区
+  * @param   [in]Channel 通道号.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void UART_Audio_Port_Finish_Frame(uint8_t Channel)
+{
+  UART_AUDIO_CHANNEL_Typedef_t *Ch = &Channel_State[Channel];
+  uint8_t *Frame = (uint8_t *)Ch->Frame_Buf;
+  uint32_t Size = AF_HEADER_SIZE + AF_IMA_PAYLOAD_SIZE(1U, UART_AUDIO_PORT_FRAME_SAMPLES);
+  uint32_t Data_End = AF_HEADER_SIZE + IMA_BLOCK_SIZE(UART_AUDIO_PORT_FRAME_SAMPLES);
+  AF_HeaderTypeDef Header;
+  CQ_SpanTypeDef Span;
+  uint32_t Crc = 0;
+
+  Header.sync = AF_SYNC_WORD;
+  Header.version = AF_VERSION;
+  Header.channel_number = 1;
+  Header.channel_map = (uint16_t)(1U << Channel);
+  Header.frame_samples = UART_AUDIO_PORT_FRAME_SAMPLES;
+  Header.header_size = AF_HEADER_SIZE;
+  Header.sample_counter = Ch->Sample_Counter;
+  Header.timestamp_ms = HAL_GetTick();
+  Header.drop_count = Drop_Count;
+  Header.codec = AF_CODEC_IMA_ADPCM;
+  Header.decimation = (Ch->Mode == UART_AUDIO_MODE_ADPCM_8K)?2U:1U;
+  Header.payload_size = (uint16_t)AF_IMA_PAYLOAD_SIZE(1U, UART_AUDIO_PORT_FRAME_SAMPLES);
+  memcpy(Frame, &Header, AF_HEADER_SIZE);
+  memset(Frame + Data_End, 0, Size - Data_End);
+
+  Crc = Audio_Debug_Crc32(Ch->Frame_Buf, Size / 4U);
+  Ch->Frame_Buf[Size / 2U] = (uint16_t)Crc;
+  Ch->Frame_Buf[Size / 2U + 1U] = (uint16_t)(Crc >> 16);
+  Size += AF_CRC_SIZE;
+
+  Ch->Sample_Counter += UART_AUDIO_PORT_FRAME_SAMPLES;
+  Ch->Fill = 0;
+
+  /*整帧存入，空间不足时丢弃，不截断*/
+  if(CQ_reserveWrite(&CQ_Tx_Handle, Size, &Span) < Size)
+  {
+    Drop_Count += UART_AUDIO_PORT_FRAME_SAMPLES;
+    return;
+  }
+  memcpy(Span.first, Frame, Span.first_len);
+  memcpy(Span.second, Frame + Span.first_len, Span.second_len);
+  CQ_commitWrite(&CQ_Tx_Handle, Size);
+}
+
+/**
+  ******************************************************************
+  * @brief   编码并加入帧，满帧时存入发送区
+  * @param   [in]Channel 通道号.
+  * @param   [in]Data 数据.
+  * @param   [in]Samples 点数，偶数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void UART_Audio_Port_Encode(uint8_t Channel, const int16_t *Data, uint32_t Samples)
+{
+  UART_AUDIO_CHANNEL_Typedef_t *Ch = &Channel_State[Channel];
+  uint8_t *Block = (uint8_t *)Ch->Frame_Buf + AF_HEADER_SIZE;
+  uint32_t Chunk = 0;
+
+  while(Samples > 0U)
+  {
+    /*块头为编码本帧前的状态*/
+    if(Ch->Fill == 0U)
+    {
+      IMA_writeBlockHeader(&Ch->State, Block);
+    }
+    Chunk = UART_AUDIO_PORT_FRAME_SAMPLES - Ch->Fill;
+    Chunk = (Samples < Chunk)?Samples:Chunk;
+    IMA_encode(&Ch->State, Data, 1, Chunk, Block + IMA_BLOCK_HEADER_SIZE + Ch->Fill / 2U);
+    Ch->Fill += Chunk;
+    Data += Chunk;
+    Samples -= Chunk;
+    if(Ch->Fill == UART_AUDIO_PORT_FRAME_SAMPLES)
+    {
+      UART_Audio_Port_Finish_Frame(Channel);
+    }
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   2:1抽取后编码，相邻两点取平均
+  * @param   [in]Channel 通道号.
+  * @param   [in]Data 数据.
+  * @param   [in]Samples 点数，4的整数倍.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void UART_Audio_Port_Encode_Decimate(uint8_t Channel, const int16_t *Data, uint32_t Samples)
+{
+  int16_t Decimated[UART_AUDIO_DECIM_CHUNK / 2U];
+  uint32_t Chunk = 0;
+
+  while(Samples > 0U)
+  {
+    Chunk = (Samples < UART_AUDIO_DECIM_CHUNK)?Samples:UART_AUDIO_DECIM_CHUNK;
+    for(uint32_t i = 0; i < Chunk / 2U; i++)
+    {
+      Decimated[i] = (int16_t)(((int32_t)Data[2U*i] + (int32_t)Data[2U*i + 1U]) >> 1);
+    }
+    UART_Audio_Port_Encode(Channel, Decimated, Chunk / 2U);
+    Data += Chunk;
+    Samples -= Chunk;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   adpcm命令
+  * @param   [in]Argc 参数个数.
+  * @param   [in]Argv 参数.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void UART_Audio_Port_Cmd(int Argc, char *Argv[])
+{
+  unsigned long Channel = UART_AUDIO_PORT_CHANNEL_MAX;
+  char *End = NULL;
+  bool Ok = false;
+
+  if(Argc < 2)
+  {
+    for(uint8_t i = 0; i < UART_AUDIO_PORT_CHANNEL_MAX; i++)
+    {
+      if(Channel_State[i].Mode != UART_AUDIO_MODE_OFF)
+      {
+        printf("adpcm: ch%u %s\r\n", i, Mode_Name[Channel_State[i].Mode]);
+      }
+    }
+    printf("adpcm: drop %lu samples\r\n", (unsigned long)Drop_Count);
+    return;
+  }
+  if(Argc == 3)
+  {
+    Channel = strtoul(Argv[1], &End, 10);
+    Channel = (End == Argv[1] || *End != '\0')?UART_AUDIO_PORT_CHANNEL_MAX:Channel;
+  }
+  for(uint8_t Mode = 0; Mode < UART_AUDIO_MODE_MAX && Channel < UART_AUDIO_PORT_CHANNEL_MAX; Mode++)
+  {
+    if(strcmp(Argv[2], Mode_Name[Mode]) == 0)
+    {
+      Ok = UART_Audio_Port_Set_Mode((uint8_t)Channel, (UART_AUDIO_MODE_Typedef_t)Mode);
+      break;
+    }
+  }
+  printf("%s\r\n", (Ok == true)?"ok":"usage: adpcm | adpcm <ch> <off|16k|8k>");
+}
+
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+  ******************************************************************
+  * @brief   设置通道输出模式，切换时重新开始该通道的帧
+  * @param   [in]Channel 通道号，0起.
+  * @param   [in]Mode 输出模式.
+  * @return  true 成功.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+bool UART_Audio_Port_Set_Mode(uint8_t Channel, UART_AUDIO_MODE_Typedef_t Mode)
+{
+  if(Channel >= UART_AUDIO_PORT_CHANNEL_MAX || Mode >= UART_AUDIO_MODE_MAX)
+  {
+    return false;
+  }
+  if(Channel_State[Channel].Mode == Mode)
+  {
+    return true;
+  }
+  Channel_State[Channel].Mode = Mode;
+  Channel_State[Channel].Fill = 0;
+  Channel_State[Channel].Sample_Counter = 0;
+  IMA_init(&Channel_State[Channel].State);
+  return true;
+}
+
+/**
+  ******************************************************************
+  * @brief   获取通道输出模式
+  * @param   [in]Channel 通道号，0起.
+  * @return  输出模式.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+UART_AUDIO_MODE_Typedef_t UART_Audio_Port_Get_Mode(uint8_t Channel)
+{
+  if(Channel >= UART_AUDIO_PORT_CHANNEL_MAX)
+  {
+    return UART_AUDIO_MODE_OFF;
+  }
+  return Channel_State[Channel].Mode;
+}
+
+/**
+  ******************************************************************
+  * @brief   加入各通道音频
+  * @param   [in]Channel_Data 各通道数据地址.
+  * @param   [in]Channel_Total 通道总数.
+  * @param   [in]Samples 每通道点数，4的整数倍.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void UART_Audio_Port_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total, uint32_t Samples)
+{
+  if(Channel_Data == NULL || Uart_Handle == NULL)
+  {
+    return;
+  }
+  if(Channel_Total > UART_AUDIO_PORT_CHANNEL_MAX)
+  {
+    Channel_Total = UART_AUDIO_PORT_CHANNEL_MAX;
+  }
+
+  for(uint8_t Channel = 0; Channel < Channel_Total; Channel++)
+  {
+    switch(Channel_State[Channel].Mode)
+    {
+      case UART_AUDIO_MODE_ADPCM:
+        UART_Audio_Port_Encode(Channel, Channel_Data[Channel], Samples);
+        break;
+      case UART_AUDIO_MODE_ADPCM_8K:
+        UART_Audio_Port_Encode_Decimate(Channel, Channel_Data[Channel], Samples);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   发送已编码帧，上次发送完成后释放并启动下一段
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void UART_Audio_Port_Start(void)
+{
+  CQ_SpanTypeDef Span;
+
+  if(Uart_Handle == NULL)
+  {
+    return;
+  }
+  if(Sending_Len > 0U)
+  {
+    if(Uart_Handle->phuart->gState != HAL_UART_STATE_READY)
+    {
+      return;
+    }
+    CQ_consumeRead(&CQ_Tx_Handle, Sending_Len);
+    Sending_Len = 0;
+  }
+  if(CQ_peekRead(&CQ_Tx_Handle, UART_AUDIO_TX_BUF_SIZE, &Span) == 0U)
+  {
+    return;
+  }
+  /*中断发送，数据在发送完成前保留于环形区*/
+  if(Uart_Port_Transmit_Data(Uart_Handle, (uint8_t *)Span.first, (uint16_t)Span.first_len, 0) == true)
+  {
+    Sending_Len = Span.first_len;
+  }
+}
+
+/**
+  ******************************************************************
+  * @brief   获取发送缓冲区满时丢弃的点数
+  * @param   [in]None.
+  * @return  丢弃点数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t UART_Audio_Port_Get_Drop_Count(void)
+{
+  return Drop_Count;
+}
+
+/**
+  ******************************************************************
+  * @brief   串口音频接口初始化，需在Uart_Port_Init及Cmd_Port_Init之后调用
+  * @param   [in]None.
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void UART_Audio_Port_Init(void)
+{
+  Uart_Handle = Uart_Port_Get_Handle(UART_NUM_1);
+
+  CQ_init(&CQ_Tx_Handle, Tx_Buf, UART_AUDIO_TX_BUF_SIZE);
+  CQ_registerStats(&CQ_Tx_Handle, "uart_audio_tx");
+
+  for(uint8_t Channel = 0; Channel < UART_AUDIO_PORT_CHANNEL_MAX; Channel++)
+  {
+    memset(&Channel_State[Channel], 0, sizeof(UART_AUDIO_CHANNEL_Typedef_t));
+    IMA_init(&Channel_State[Channel].State);
+    Channel_State[Channel].Mode = UART_AUDIO_PORT_DEFAULT_MODE;
+  }
+
+  Cmd_Port_Register("adpcm", "uart adpcm audio: [<ch> <off|16k|8k>]", UART_Audio_Port_Cmd);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
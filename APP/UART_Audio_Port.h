@@ -0,0 +1,67 @@
+/**
+ *  @file UART_Audio_Port.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 串口低带宽音频输出接口
+ *
+ *  @version V1.0
+ */
+#ifndef UART_AUDIO_PORT_H
+#define UART_AUDIO_PORT_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< nedd definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h> /**< need variable max value    */
+/** Private includes ---------------------------------------------------------*/
+#include "AudioFrame.h"
+/** Private defines ----------------------------------------------------------*/
+#define UART_AUDIO_PORT_CHANNEL_MAX     8U      /**< 最大通道数*/
+#define UART_AUDIO_PORT_FRAME_SAMPLES   256U    /**< 每帧输出点数，须为偶数*/
+#define UART_AUDIO_PORT_SAMPLE_RATE     16000U  /**< 输入采样率*/
+#define UART_AUDIO_PORT_DEFAULT_MODE    UART_AUDIO_MODE_OFF
+
+/** Exported typedefines -----------------------------------------------------*/
+/*通道输出模式，115200波特率约11.5KB/s*/
+typedef enum
+{
+  UART_AUDIO_MODE_OFF = 0,        /**< 不输出*/
+  UART_AUDIO_MODE_ADPCM,          /**< 16kHz IMA-ADPCM，约10.3KB/s*/
+  UART_AUDIO_MODE_ADPCM_8K,       /**< 2:1抽取后8kHz IMA-ADPCM，约5.1KB/s*/
+  UART_AUDIO_MODE_MAX
+}UART_AUDIO_MODE_Typedef_t;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*单通道帧字节数*/
+#define UART_AUDIO_PORT_FRAME_SIZE      AF_IMA_FRAME_SIZE(1U, UART_AUDIO_PORT_FRAME_SAMPLES)
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*串口音频接口初始化*/
+void UART_Audio_Port_Init(void);
+/*设置通道输出模式*/
+bool UART_Audio_Port_Set_Mode(uint8_t Channel, UART_AUDIO_MODE_Typedef_t Mode);
+/*获取通道输出模式*/
+UART_AUDIO_MODE_Typedef_t UART_Audio_Port_Get_Mode(uint8_t Channel);
+/*加入各通道音频，每通道Samples点(偶数)*/
+void UART_Audio_Port_Put_Channel_Data(const int16_t * const *Channel_Data, uint8_t Channel_Total, uint32_t Samples);
+/*发送已编码帧，主循环中调用*/
+void UART_Audio_Port_Start(void);
+/*获取发送缓冲区满时丢弃的点数*/
+uint32_t UART_Audio_Port_Get_Drop_Count(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
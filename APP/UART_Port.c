@@ -17,6 +17,7 @@
 extern "C" {
 #endif
 #include "UART_Port.h"/*外部接口*/
+#include "StaticArena.h"
 #if USE_USB_CDC
   #include "usbd_cdc_if.h"
 #endif
@@ -39,8 +40,8 @@ extern DMA_HandleTypeDef hdma_usart1_tx;
 #define USE_DMA_SEND_FORCE  0/**< 强制使用DMA发送*/
 /*定义内存管理接口*/
 #if !defined(uartport_malloc) && !defined(uartport_free)
-#define uartport_malloc  malloc//pvPortMalloc
-#define uartport_free  free//vPortFree
+#define uartport_malloc(size)  SA_alloc((uint32_t)(size), SA_ALIGN_DEFAULT)//pvPortMalloc
+#define uartport_free(ptr)     ((void)(ptr))//vPortFree
 #endif
 
 /** Private constants --------------------------------------------------------*/
@@ -444,6 +445,10 @@ void Uart_Port_Init(void)
     {
       printf("create uart opt handle 1 faild.\n");
     }
+    else
+    {
+      CQ_registerStats(Uart_pDevice[UART_NUM_1]->cb, "uart1_rx");
+    }
 
 #if USE_USB_CDC    
     Create_Uart_Dev(UART_NUM_0, NULL,
@@ -13,6 +13,8 @@
  *           2、16k采样，双声道，10ms出320点数据
  *           3、1ms间隔发送，10ms发送10次，每次发送320/10 = 32点数据 数据大小64字节（16bit*32）
  *           4、接收来自MIC数据，10ms来一次每次双通道160点*2
+ *           5、备用设置1-4/5-8/9-12分别为16位、24位紧凑(3字节)、32位，缓冲区按字节存放当前格式数据，
+ *              输入按左对齐扩展或截取高位转换为当前格式
  *  @version V1.0
  */
 /** Includes -----------------------------------------------------------------*/
@@ -20,15 +22,16 @@
 #include "USB_Audio_Port.h"
 #include "main.h"
 #include "usbd_audio.h"
+#include "PcmPack.h"
 /** Use C compiler -----------------------------------------------------------*/
 #ifdef __cplusplus ///<use C compiler
 extern "C" {
 #endif
 /** Private typedef ----------------------------------------------------------*/
 /** Private macros -----------------------------------------------------------*/
-#define USB_RX_BUF_SIZE_MAX       1024 /**< 接收缓冲区设置1024*2Bytes*/
+#define USB_RX_BUF_SIZE_MAX       8192 /**< 接收缓冲区设置8192Bytes，8通道32位时容纳两帧数据*/
 
-#define USB_PORT_AUDIO_OUT_PACKET AUDIO_PORT_OUT_SIZE    /**< 一次发送大小字节数*/
+#define USB_PORT_AUDIO_OUT_PACKET AUDIO_PORT_OUT_SIZE    /**< OUT端点一次接收大小字节数*/
 #define USB_PORT_AUDIO_BUF_SIZE   AUDIO_TOTAL_BUF_SIZE
 #define USB_PORT_AUDIO_IN_EP      AUDIO_PORT_IN_EP_DIR_ID
 #define USB_PORT_AUDIO_OUT_EP     AUDIO_PORT_OUT_EP_DIR_ID
@@ -37,10 +40,11 @@ extern "C" {
 /** Private variables --------------------------------------------------------*/
 /*音频缓冲区*/
 static CQ_handleTypeDef USB_Audio_Data_Handle;
-static int16_t USB_Audio_Receive_Buf[STEREO_FRAME_SIZE] = {0};
-static uint16_t USB_Audio_Send_Buf[USB_RX_BUF_SIZE_MAX];
+static uint32_t USB_Audio_Send_Buf[USB_RX_BUF_SIZE_MAX/4];
+/*当前备用设置，通道数、每点字节数及包长均由其得出，单次读取保证一致*/
+static volatile uint8_t USB_Audio_Alt_Setting = AUDIO_PORT_DEFAULT_ALT_SETTING;
 /** Private function prototypes ----------------------------------------------*/
-
+static void USB_Audio_Port_Put_Frames(const void * const *Channel_Data, uint8_t Sample_Size, uint32_t Channel_Number, uint32_t Stride, uint32_t Frames);
 /** Private user code --------------------------------------------------------*/
 
 /** Private application code -------------------------------------------------*/
@@ -62,24 +66,140 @@ static uint16_t USB_Audio_Send_Buf[USB_RX_BUF_SIZE_MAX];
   */
 static void USB_Audio_Port_Init(void)
 {
-  /*初始化接收音频缓冲区*/
-  CQ_16_init(&USB_Audio_Data_Handle, USB_Audio_Send_Buf, USB_RX_BUF_SIZE_MAX);
+  /*初始化接收音频缓冲区，按字节存放*/
+  CQ_init(&USB_Audio_Data_Handle, (uint8_t *)USB_Audio_Send_Buf, USB_RX_BUF_SIZE_MAX);
+  /*实时音频，缓冲区满时按当前包长丢弃最旧数据，保持通道对齐并限制延迟，切换备用设置时更新*/
+  CQ_setPolicy(&USB_Audio_Data_Handle, CQ_POLICY_OVERWRITE_OLDEST,
+               AUDIO_PORT_PACKET_SIZE(AUDIO_PORT_ALT_CHANNEL_NUMS(AUDIO_PORT_DEFAULT_ALT_SETTING),
+                                      AUDIO_PORT_ALT_SUBFRAME_SIZE(AUDIO_PORT_DEFAULT_ALT_SETTING)));
+  /*DataIn数据不足返回USBD_BUSY时计入underrun*/
+  CQ_registerStats(&USB_Audio_Data_Handle, "usb_audio");
+}
+
+/**
+  ******************************************************************
+  * @brief   写入预留区，跨越回绕时拆分
+  * @param   [in]Span 预留区
+  * @param   [in]Offset 预留区内偏移字节数
+  * @param   [in]Data 数据
+  * @param   [in]Len 字节数
+  * @return  写入后偏移.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static uint32_t USB_Audio_Port_Span_Write(const CQ_SpanTypeDef *Span, uint32_t Offset, const uint8_t *Data, uint32_t Len)
+{
+  uint32_t First = 0;
+  
+  if(Offset < Span->first_len)
+  {
+    First = GET_MIN(Len, Span->first_len - Offset);
+    memcpy((uint8_t *)Span->first + Offset, Data, First);
+  }
+  if(Len > First)
+  {
+    memcpy((uint8_t *)Span->second + (Offset + First - Span->first_len), Data + First, Len - First);
+  }
+  return Offset + Len;
+}
+
+/**
+  ******************************************************************
+  * @brief   按当前USB通道数及位宽交织写入，多余通道丢弃，不足通道补0
+  * @param   [in]Channel_Data 各通道数据地址
+  * @param   [in]Sample_Size 输入每点字节数，2为int16，4为24-in-32/int32左对齐
+  * @param   [in]Channel_Number 数据通道数
+  * @param   [in]Stride 同一通道相邻两点间隔
+  * @param   [in]Frames 每通道点数
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
+  ******************************************************************
+  */
+static void USB_Audio_Port_Put_Frames(const void * const *Channel_Data, uint8_t Sample_Size, uint32_t Channel_Number, uint32_t Stride, uint32_t Frames)
+{
+  CQ_SpanTypeDef Span;
+  uint8_t Frame_Buf[AUDIO_PORT_CHANNEL_NUMS_MAX*AUDIO_PORT_SUBFRAME_SIZE_MAX];
+  uint8_t Alt_Setting = USB_Audio_Alt_Setting;
+  uint32_t Channel_Nums = AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting);
+  uint32_t Subframe_Size = AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting);
+  uint32_t Frame_Size = Channel_Nums * Subframe_Size;
+  uint32_t Len = 0;
+  uint32_t Offset = 0;
+  uint32_t Index = 0;
+  uint32_t Sample = 0;
+  uint8_t *Ptr = NULL;
+  
+  /*直接在环形区内写入，仅写入完整帧*/
+  Len = CQ_reserveWrite(&USB_Audio_Data_Handle, Frames * Frame_Size, &Span) / Frame_Size;
+  for(uint32_t i = 0; i < Len; i++)
+  {
+    Ptr = Frame_Buf;
+    for(uint32_t Ch = 0; Ch < Channel_Nums; Ch++)
+    {
+      /*统一为左对齐32位，取高Subframe_Size字节小端输出*/
+      Sample = 0;
+      if(Ch < Channel_Number)
+      {
+        Sample = (Sample_Size == 2U)?((uint32_t)(uint16_t)((const int16_t *)Channel_Data[Ch])[Index] << 16)
+                                    :(uint32_t)((const int32_t *)Channel_Data[Ch])[Index];
+      }
+      Sample >>= 32U - 8U*Subframe_Size;
+      for(uint32_t n = 0; n < Subframe_Size; n++)
+      {
+        *Ptr++ = (uint8_t)Sample;
+        Sample >>= 8;
+      }
+    }
+    Offset = USB_Audio_Port_Span_Write(&Span, Offset, Frame_Buf, Frame_Size);
+    Index += Stride;
+  }
+  
+  CQ_commitWrite(&USB_Audio_Data_Handle, Len * Frame_Size);
 }
 
 /**
   ******************************************************************
-  * @brief   向USB缓冲区数据加入数据
-  * @param   [in]Data 待加入数据.
-  * @param   [in]Size 待加入数据长度Size个16Bit.
+  * @brief   24-in-32交织数据打包为3字节写入，通道数与USB一致
+  * @param   [in]Data 交织数据
+  * @param   [in]Frames 每通道点数
+  * @param   [in]Channel_Nums 通道数
   * @return  None.
   * @author  aron566
   * @version V1.0
-  * @date    2021-06-04
+  * @date    2026-10-17
   ******************************************************************
   */
-static inline void USB_Audio_Port_Put_Audio_Data(const int16_t *Data, uint32_t Size)
+static void USB_Audio_Port_Put_Packed24(const int32_t *Data, uint32_t Frames, uint32_t Channel_Nums)
 {
-  CQ_16putData(&USB_Audio_Data_Handle, (const uint16_t *)Data, Size);
+  CQ_SpanTypeDef Span;
+  uint8_t Sample_Buf[PCM_PACK24_SAMPLE_SIZE];
+  uint32_t Frame_Size = PCM_PACK24_SIZE(Channel_Nums);
+  uint32_t Len = 0;
+  uint32_t Samples = 0;
+  uint32_t First = 0;
+  uint32_t Offset = 0;
+  
+  Len = CQ_reserveWrite(&USB_Audio_Data_Handle, Frames * Frame_Size, &Span);
+  Len -= Len % Frame_Size;
+  Samples = Len / PCM_PACK24_SAMPLE_SIZE;
+  
+  /*第一段内完整的点直接打包至环形区*/
+  First = GET_MIN(Span.first_len, Len) / PCM_PACK24_SAMPLE_SIZE;
+  PCM_pack24(Data, First, (uint8_t *)Span.first);
+  if(First < Samples)
+  {
+    /*跨越回绕的一点经暂存拆分写入，其余打包至第二段*/
+    PCM_pack24(Data + First, 1U, Sample_Buf);
+    Offset = USB_Audio_Port_Span_Write(&Span, PCM_PACK24_SIZE(First), Sample_Buf, PCM_PACK24_SAMPLE_SIZE);
+    First++;
+    PCM_pack24(Data + First, Samples - First, (uint8_t *)Span.second + (Offset - Span.first_len));
+  }
+  
+  CQ_commitWrite(&USB_Audio_Data_Handle, Len);
 }
 
 /** Public application code --------------------------------------------------*/
@@ -172,15 +292,29 @@ uint8_t USB_Audio_Port_DataIn(void *xpdev, uint8_t epnum)
 {
   USBD_HandleTypeDef *pdev = (USBD_HandleTypeDef *)xpdev;
   USBD_AUDIO_HandleTypeDef *haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+  CQ_SpanTypeDef Span;
+  uint8_t Alt_Setting = USB_Audio_Alt_Setting;
+  uint32_t Packet_Size = AUDIO_PORT_PACKET_SIZE(AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting), AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting));
+  uint8_t Ret;
   
 	USBD_LL_FlushEP(pdev, USB_PORT_AUDIO_IN_EP);
   
-  if(CQ_getLength(&USB_Audio_Data_Handle) < USB_PORT_AUDIO_OUT_PACKET/2)
+  if(CQ_peekRead(&USB_Audio_Data_Handle, Packet_Size, &Span) < Packet_Size)
   {
     return (uint8_t)USBD_BUSY;
   }
-  CQ_16getData(&USB_Audio_Data_Handle, (uint16_t *)haudio->buffer, USB_PORT_AUDIO_OUT_PACKET/2);
-  return USBD_LL_Transmit(pdev, USB_PORT_AUDIO_IN_EP, haudio->buffer, USB_PORT_AUDIO_OUT_PACKET);
+  
+  /*ISO IN非DMA模式发送时即写入FIFO，数据连续时直接由环形区发送*/
+  if(Span.first_len == Packet_Size)
+  {
+    Ret = USBD_LL_Transmit(pdev, USB_PORT_AUDIO_IN_EP, (uint8_t *)Span.first, Packet_Size);
+    CQ_consumeRead(&USB_Audio_Data_Handle, Packet_Size);
+    return Ret;
+  }
+  
+  /*数据回绕，拼接后发送*/
+  CQ_getData(&USB_Audio_Data_Handle, haudio->buffer, Packet_Size);
+  return USBD_LL_Transmit(pdev, USB_PORT_AUDIO_IN_EP, haudio->buffer, Packet_Size);
 }
 
 /**
@@ -324,6 +458,7 @@ uint8_t USB_Audio_Port_EP_IN_Init(void *xpdev, uint8_t cfgidx)
   
   /*USB接口初始化*/
   USB_Audio_Port_Init();
+  USB_Audio_Port_Set_Alt_Setting(AUDIO_PORT_DEFAULT_ALT_SETTING);
   
   /* Allocate Audio structure */
   haudio = USBD_malloc(sizeof(USBD_AUDIO_HandleTypeDef));
@@ -346,7 +481,7 @@ uint8_t USB_Audio_Port_EP_IN_Init(void *xpdev, uint8_t cfgidx)
   }
   
     /* Open EP IN */
-  (void)USBD_LL_OpenEP(pdev, USB_PORT_AUDIO_IN_EP, USBD_EP_TYPE_ISOC, USB_PORT_AUDIO_OUT_PACKET); 
+  (void)USBD_LL_OpenEP(pdev, USB_PORT_AUDIO_IN_EP, USBD_EP_TYPE_ISOC, AUDIO_PORT_MAX_PACKET_SIZE); 
   pdev->ep_in[USB_PORT_AUDIO_IN_EP & 0xFU].is_used = 1U;
   
   haudio->alt_setting = 0U;
@@ -357,7 +492,9 @@ uint8_t USB_Audio_Port_EP_IN_Init(void *xpdev, uint8_t cfgidx)
   
   memset(haudio->buffer, 0, USB_PORT_AUDIO_BUF_SIZE);
 
-  USBD_LL_Transmit(pdev, USB_PORT_AUDIO_IN_EP, haudio->buffer, USB_PORT_AUDIO_OUT_PACKET);
+  USBD_LL_Transmit(pdev, USB_PORT_AUDIO_IN_EP, haudio->buffer,
+                   AUDIO_PORT_PACKET_SIZE(AUDIO_PORT_ALT_CHANNEL_NUMS(AUDIO_PORT_DEFAULT_ALT_SETTING),
+                                          AUDIO_PORT_ALT_SUBFRAME_SIZE(AUDIO_PORT_DEFAULT_ALT_SETTING)));
   return (uint8_t)USBD_OK;
 }
 
@@ -375,15 +512,167 @@ uint8_t USB_Audio_Port_EP_IN_Init(void *xpdev, uint8_t cfgidx)
   */
 void USB_Audio_Port_Put_Data(const int16_t *Left_Audio, const int16_t *Right_Audio, int Size)
 {
-  /*更新USB音频数据*/
-  int index = 0, i = 0;
-  for(i = 0; i < Size; index++)
+  const void *Channel_Data[2] = {Left_Audio, Right_Audio};
+  
+  /*更新USB音频数据 TO USB LEFT RIGHT*/
+  USB_Audio_Port_Put_Frames(Channel_Data, 2U, 2U, 1U, (uint32_t)Size/2U);
+}
+
+/**
+  ******************************************************************
+  * @brief   更新USB音频交织数据
+  * @param   [in]Data 交织数据LEFT RIGHT LEFT RIGHT......
+  * @param   [in]Size 总点数
+  * @param   [in]Channel_Number 数据通道数
+  * @return  None.
+  * @author  aron566
+  * @version V1.1
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void USB_Audio_Port_Put_Interleaved_Data(const int16_t *Data, uint32_t Size, uint8_t Channel_Number)
+{
+  const void *Channel_Data[AUDIO_PORT_CHANNEL_NUMS_MAX];
+  uint8_t Alt_Setting = USB_Audio_Alt_Setting;
+  uint32_t Channel_Nums = AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting);
+  uint32_t Frames = 0;
+  
+  if(Channel_Number == 0U)
+  {
+    return;
+  }
+  Frames = Size / Channel_Number;
+  
+  /*与USB数据格式一致，直接写入*/
+  if(Channel_Number == Channel_Nums && AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting) == sizeof(int16_t))
+  {
+    CQ_putData(&USB_Audio_Data_Handle, (const uint8_t *)Data, Frames * Channel_Nums * sizeof(int16_t));
+    return;
+  }
+  
+  /*超出USB通道数的通道不会被使用*/
+  for(uint32_t i = 0; i < Channel_Number && i < AUDIO_PORT_CHANNEL_NUMS_MAX; i++)
+  {
+    Channel_Data[i] = Data + i;
+  }
+  USB_Audio_Port_Put_Frames(Channel_Data, 2U, GET_MIN(Channel_Number, AUDIO_PORT_CHANNEL_NUMS_MAX), Channel_Number, Frames);
+}
+
+/**
+  ******************************************************************
+  * @brief   更新USB音频24-in-32/32位交织数据，高分辨率备用设置下保留完整精度
+  * @param   [in]Data 左对齐交织数据LEFT RIGHT LEFT RIGHT......
+  * @param   [in]Size 总点数
+  * @param   [in]Channel_Number 数据通道数
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void USB_Audio_Port_Put_Interleaved_Data_32(const int32_t *Data, uint32_t Size, uint8_t Channel_Number)
+{
+  const void *Channel_Data[AUDIO_PORT_CHANNEL_NUMS_MAX];
+  uint8_t Alt_Setting = USB_Audio_Alt_Setting;
+  uint32_t Channel_Nums = AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting);
+  uint32_t Frames = 0;
+  
+  if(Channel_Number == 0U)
   {
-    USB_Audio_Receive_Buf[i++] = Left_Audio[index];/**< TO USB LEFT*/
-    USB_Audio_Receive_Buf[i++] = Right_Audio[index];/**< TO USB RIGHT*/
+    return;
   }
+  Frames = Size / Channel_Number;
   
-  USB_Audio_Port_Put_Audio_Data(USB_Audio_Receive_Buf, Size);
+  /*通道数一致时32位直接写入，24位单次遍历打包*/
+  if(Channel_Number == Channel_Nums && AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting) == sizeof(int32_t))
+  {
+    CQ_putData(&USB_Audio_Data_Handle, (const uint8_t *)Data, Frames * Channel_Nums * sizeof(int32_t));
+    return;
+  }
+  if(Channel_Number == Channel_Nums && AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting) == PCM_PACK24_SAMPLE_SIZE)
+  {
+    USB_Audio_Port_Put_Packed24(Data, Frames, Channel_Nums);
+    return;
+  }
+  
+  for(uint32_t i = 0; i < Channel_Number && i < AUDIO_PORT_CHANNEL_NUMS_MAX; i++)
+  {
+    Channel_Data[i] = Data + i;
+  }
+  USB_Audio_Port_Put_Frames(Channel_Data, 4U, GET_MIN(Channel_Number, AUDIO_PORT_CHANNEL_NUMS_MAX), Channel_Number, Frames);
+}
+
+/**
+  ******************************************************************
+  * @brief   更新USB原始数据，如分帧调试数据，需由上位机录制原始数据后解析
+  * @param   [in]Data 数据
+  * @param   [in]Size 16位数据个数
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void USB_Audio_Port_Put_Raw_Data(const uint16_t *Data, uint32_t Size)
+{
+  CQ_putData(&USB_Audio_Data_Handle, (const uint8_t *)Data, Size * sizeof(uint16_t));
+}
+
+/**
+  ******************************************************************
+  * @brief   主机选择流接口备用设置，在USB中断中调用
+  * @param   [in]Alt_Setting 备用设置，0为零带宽
+  * @return  None.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+void USB_Audio_Port_Set_Alt_Setting(uint8_t Alt_Setting)
+{
+  /*零带宽时保持原格式，主机不再读取*/
+  if(Alt_Setting == 0U || Alt_Setting > AUDIO_PORT_ALT_SETTING_NUM)
+  {
+    return;
+  }
+  USB_Audio_Alt_Setting = Alt_Setting;
+  /*覆盖丢弃单位跟随包长，保持新格式通道对齐*/
+  CQ_setPolicy(&USB_Audio_Data_Handle, CQ_POLICY_OVERWRITE_OLDEST,
+               AUDIO_PORT_PACKET_SIZE(AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting), AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting)));
+  
+  /*丢弃原格式数据，与DataIn同为消费者上下文；
+    生产者正写入的一帧为旧格式，仅影响切换后的少量传输*/
+  CQ_consumeRead(&USB_Audio_Data_Handle, CQ_getLength(&USB_Audio_Data_Handle));
+}
+
+/**
+  ******************************************************************
+  * @brief   获取当前USB音频通道数
+  * @param   [in]None.
+  * @return  通道数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t USB_Audio_Port_Get_Channel_Number(void)
+{
+  return (uint8_t)AUDIO_PORT_ALT_CHANNEL_NUMS(USB_Audio_Alt_Setting);
+}
+
+/**
+  ******************************************************************
+  * @brief   获取当前USB每点字节数
+  * @param   [in]None.
+  * @return  2 16位，3 24位紧凑，4 32位.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint8_t USB_Audio_Port_Get_Subframe_Size(void)
+{
+  return (uint8_t)AUDIO_PORT_ALT_SUBFRAME_SIZE(USB_Audio_Alt_Setting);
 }
 
 /**
@@ -398,13 +687,32 @@ void USB_Audio_Port_Put_Data(const int16_t *Left_Audio, const int16_t *Right_Aud
   */
 bool USB_Audio_Port_Can_Put_Data(void)
 {
-  if(USB_Audio_Data_Handle.size - CQ_getLength(&USB_Audio_Data_Handle) >= STEREO_FRAME_SIZE)
+  uint8_t Alt_Setting = USB_Audio_Alt_Setting;
+  uint32_t Frame_Size = MONO_FRAME_SIZE * AUDIO_PORT_ALT_CHANNEL_NUMS(Alt_Setting) * AUDIO_PORT_ALT_SUBFRAME_SIZE(Alt_Setting);
+  
+  if(USB_Audio_Data_Handle.size - CQ_getLength(&USB_Audio_Data_Handle) >= Frame_Size)
   {
     return true;
   }
   return false;
 }
 
+/**
+  ******************************************************************
+  * @brief   获取缓冲区满时丢弃的音频点数
+  * @param   [in]None.
+  * @return  丢弃点数.
+  * @author  aron566
+  * @version V1.0
+  * @date    2026-10-17
+  ******************************************************************
+  */
+uint32_t USB_Audio_Port_Get_Drop_Count(void)
+{
+  /*环形区按字节计数，按当前每点字节数折算*/
+  return CQ_getDropCount(&USB_Audio_Data_Handle) / AUDIO_PORT_ALT_SUBFRAME_SIZE(USB_Audio_Alt_Setting);
+}
+
 #ifdef __cplusplus ///<end extern c
 }
 #endif
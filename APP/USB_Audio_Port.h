@@ -20,8 +20,10 @@
 #include <string.h>
 #include <limits.h> /**< need variable max value    */
 /** Exported macros-----------------------------------------------------------*/
-#define AUDIO_PORT_CHANNEL_NUMS               2U      /**< MIC音频通道数*/
-#define MONO_CHANNEL_SEL                      2U      /**< 0使用L声道 1使用R声道 2配置MONO*/
+#define AUDIO_PORT_CHANNEL_NUMS_MAX           8U      /**< MIC最大音频通道数*/
+#define AUDIO_PORT_ALT_SETTING_NUM            12U     /**< 流接口备用设置数，16/24/32位依次为1/2/4/8通道*/
+#define AUDIO_PORT_DEFAULT_ALT_SETTING        2U      /**< 主机选择前默认16位双通道*/
+#define AUDIO_PORT_SUBFRAME_SIZE_MAX          4U      /**< 最大每点字节数*/
 #define AUDIO_PORT_USBD_AUDIO_FREQ            16000U  /**< 设置音频采样率*/
 
 /*音频类终端类型定义*/ 
@@ -41,36 +43,32 @@
 #define AUDIO_PORT_IN_EP_DIR_ID               0x81  /**< (Direction=IN EndpointID=1)*/
 #define AUDIO_PORT_OUT_EP_DIR_ID              0x01  /**< (Direction=OUT EndpointID=1)*/
 
-/*立体声配置*/
-#if AUDIO_PORT_CHANNEL_NUMS == 2
-  /*使用L+R声道*/
-  #define AUDIO_PORT_CHANNEL_CONFIG_L  0x03U
-  #define AUDIO_PORT_CHANNEL_CONFIG_H  0x00U
-/*单声道配置*/
-#elif AUDIO_PORT_CHANNEL_NUMS == 1
-  #if MONO_CHANNEL_SEL == 0
-    /*使用L声道*/
-    #define AUDIO_PORT_CHANNEL_CONFIG_L  0x01U
-    #define AUDIO_PORT_CHANNEL_CONFIG_H  0x00U
-  #elif MONO_CHANNEL_SEL == 1
-    /*使用R声道*/
-    #define AUDIO_PORT_CHANNEL_CONFIG_L  0x02U
-    #define AUDIO_PORT_CHANNEL_CONFIG_H  0x00U
-  #elif MONO_CHANNEL_SEL == 2
-    /*使用默认MONO声道*/
-    #define AUDIO_PORT_CHANNEL_CONFIG_L  0x00U
-    #define AUDIO_PORT_CHANNEL_CONFIG_H  0x00U    
-  #endif
-#endif
+/*多通道为调试数据，不指定空间位置*/
+#define AUDIO_PORT_CHANNEL_CONFIG_L           0x00U
+#define AUDIO_PORT_CHANNEL_CONFIG_H           0x00U
+
+/*备用设置对应通道数：1/5/9->1 2/6/10->2 3/7/11->4 4/8/12->8*/
+#define AUDIO_PORT_ALT_CHANNEL_NUMS(alt)      (1U << (((alt) - 1U) % 4U))
+/*备用设置对应每点字节数：1-4->2(16位) 5-8->3(24位紧凑) 9-12->4(32位)*/
+#define AUDIO_PORT_ALT_SUBFRAME_SIZE(alt)     (2U + ((alt) - 1U) / 4U)
+#define AUDIO_PORT_ALT_BIT_RESOLUTION(alt)    (AUDIO_PORT_ALT_SUBFRAME_SIZE(alt) * 8U)
 
 /*轮询时间间隔*/
 #define AUDIO_PORT_FS_BINTERVAL           1U     /**< 1ms一次轮询*/
 /*音频传输大小设置*/
-#define AUDIO_PORT_PACKET_SZE(frq)       (uint8_t)(((frq * 2U * 2U)/(1000U/AUDIO_PORT_FS_BINTERVAL)) & 0xFFU), \
-                                         (uint8_t)((((frq * 2U * 2U)/(1000U/AUDIO_PORT_FS_BINTERVAL)) >> 8) & 0xFFU)
+#define AUDIO_PORT_PACKET_SIZE(ch, size)  ((AUDIO_PORT_USBD_AUDIO_FREQ * (size) * (ch))/(1000U/AUDIO_PORT_FS_BINTERVAL))  /**< 每包字节数*/
+#define AUDIO_PORT_PACKET_SZE(ch, size)   (uint8_t)(AUDIO_PORT_PACKET_SIZE(ch, size) & 0xFFU), \
+                                          (uint8_t)((AUDIO_PORT_PACKET_SIZE(ch, size) >> 8) & 0xFFU)
+#define AUDIO_PORT_MAX_PACKET_SIZE        AUDIO_PORT_PACKET_SIZE(AUDIO_PORT_CHANNEL_NUMS_MAX, AUDIO_PORT_SUBFRAME_SIZE_MAX)
                                          
-#define AUDIO_PORT_OUT_SIZE               ((AUDIO_PORT_USBD_AUDIO_FREQ * 2U * 2U)/(1000U/AUDIO_PORT_FS_BINTERVAL))   /**< 音频发送大小Byte*/                                         
-#define AUDIO_PORT_BUF_SIZE               AUDIO_PORT_OUT_SIZE*4   /**< 音频缓冲区大小 大于3的偶数倍*/
+#define AUDIO_PORT_OUT_SIZE               AUDIO_PORT_PACKET_SIZE(2U, 2U)  /**< 音频发送大小Byte*/                                         
+#define AUDIO_PORT_BUF_SIZE               AUDIO_PORT_OUT_SIZE*8   /**< 音频缓冲区大小 大于3的偶数倍，不小于最大包长*/
+/*IN端点发送FIFO(字)，每次仅写入一包，容纳一包最大包长*/
+#define AUDIO_PORT_TX_FIFO_WORDS          (AUDIO_PORT_MAX_PACKET_SIZE / 4U)
+
+#if AUDIO_PORT_BUF_SIZE < AUDIO_PORT_MAX_PACKET_SIZE
+  #error "AUDIO_PORT_BUF_SIZE must hold one maximum size packet"
+#endif
 /** Private includes ---------------------------------------------------------*/
 
 /** Use C compiler -----------------------------------------------------------*/
@@ -89,8 +87,22 @@ extern "C" {
 
 /*向USB缓冲区数据加入数据*/
 void USB_Audio_Port_Put_Data(const int16_t *Left_Audio, const int16_t *Right_Audio, int Size);
+/*向USB缓冲区加入交织数据，按当前备用设置通道数丢弃多余通道或补0，按位宽左对齐扩展*/
+void USB_Audio_Port_Put_Interleaved_Data(const int16_t *Data, uint32_t Size, uint8_t Channel_Number);
+/*向USB缓冲区加入24-in-32/32位交织数据，按当前备用设置位宽截取高位*/
+void USB_Audio_Port_Put_Interleaved_Data_32(const int32_t *Data, uint32_t Size, uint8_t Channel_Number);
+/*向USB缓冲区加入原始数据，不按通道对齐*/
+void USB_Audio_Port_Put_Raw_Data(const uint16_t *Data, uint32_t Size);
+/*主机选择流接口备用设置*/
+void USB_Audio_Port_Set_Alt_Setting(uint8_t Alt_Setting);
+/*获取当前USB音频通道数*/
+uint8_t USB_Audio_Port_Get_Channel_Number(void);
+/*获取当前USB每点字节数*/
+uint8_t USB_Audio_Port_Get_Subframe_Size(void);
 /*是否可以更新音频数据*/
 bool USB_Audio_Port_Can_Put_Data(void);
+/*获取缓冲区满时丢弃的音频点数*/
+uint32_t USB_Audio_Port_Get_Drop_Count(void);
 /*初始化音频输出端点*/
 uint8_t USB_Audio_Port_EP_IN_Init(void *xpdev, uint8_t cfgidx);
 /*初始化音频输入端点*/
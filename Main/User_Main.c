@@ -57,6 +57,12 @@ void User_Main_Loop(void)
   /*定时器接口启动*/
   Timer_Port_Start();
   
+  /*命令行*/
+  Cmd_Port_Start();
+  
+  /*DMA拷贝统计*/
+  DMA_Copy_Port_Poll();
+  
   /*音频接口启动*/
   I2S_Audio_Port_Start();
 }
@@ -79,8 +85,23 @@ void User_Main_Init(void)
   /*定时器接口初始化*/
   Timer_Port_Init();
   
+  /*命令行及音频调试抓取点初始化*/
+  Cmd_Port_Init();
+  Audio_Tap_Init();
+  Audio_Capture_Init();
+  Signal_Gen_Init();
+  
+  /*串口音频接口初始化，注册命令需在命令行初始化之后*/
+  UART_Audio_Port_Init();
+  
+  /*DMA拷贝接口初始化，注册命令需在命令行初始化之后*/
+  DMA_Copy_Port_Init();
+  
   /*音频接口初始化*/
   I2S_Audio_Port_Init();
+  
+  /*打印静态内存池使用情况*/
+  SA_report();
 }
 
 #ifdef __cplusplus ///<end extern c
@@ -24,6 +24,13 @@
 #include "I2S_Audio_Port.h"
 #include "Timer_Port.h"
 #include "UART_Port.h"
+#include "StaticArena.h"
+#include "DMA_Copy_Port.h"
+#include "UART_Audio_Port.h"
+#include "Cmd_Port.h"
+#include "Audio_Tap.h"
+#include "Audio_Capture.h"
+#include "Signal_Gen.h"
 /* Use C compiler ------------------------------------------------------------*/
 #ifdef __cplusplus ///< use C compiler
 extern "C" {
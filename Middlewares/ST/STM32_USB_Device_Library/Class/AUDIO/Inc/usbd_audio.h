@@ -59,7 +59,7 @@ extern "C" {
 #endif /* AUDIO_FS_BINTERVAL */
 
 #define AUDIO_OUT_EP                                  0x01U
-#define USB_AUDIO_CONFIG_DESC_SIZ                     0x6DU
+#define USB_AUDIO_CONFIG_DESC_SIZ                     0x24DU
 #define AUDIO_INTERFACE_DESC_SIZE                     0x09U
 #define USB_AUDIO_DESC_SIZ                            0x09U
 #define AUDIO_STANDARD_ENDPOINT_DESC_SIZE             0x09U
@@ -27,8 +27,8 @@
   *          The current audio class version supports the following audio features:
   *             - Pulse Coded Modulation (PCM) format
   *             - sampling rate: 48KHz.
-  *             - Bit resolution: 16
-  *             - Number of channels: 2
+  *             - Bit resolution: 16/24/32 (streaming alternate setting 1-4/5-8/9-12)
+  *             - Number of channels: 1/2/4/8 for each bit resolution
   *             - No volume control
   *             - Mute/Unmute capability
   *             - Asynchronous Endpoints
@@ -97,6 +97,51 @@ EndBSPDependencies */
 #define AUDIO_PACKET_SZE(frq)          (uint8_t)(((frq * 2U * 2U)/1000U) & 0xFFU), \
                                        (uint8_t)((((frq * 2U * 2U)/1000U) >> 8) & 0xFFU)
 
+/* Audio Streaming operational alternate setting: AS interface, AS general, Type I format,
+   standard iso IN endpoint and class-specific endpoint descriptors (43 bytes) */
+#define AUDIO_PORT_AS_ALT_DESC(alt) \
+  AUDIO_INTERFACE_DESC_SIZE,            /* bLength */                                      \
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */                              \
+  0x01,                                 /* bInterfaceNumber */                             \
+  (alt),                                /* bAlternateSetting */                            \
+  0x01,                                 /* bNumEndpoints */                                \
+  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */                              \
+  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */                           \
+  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */                           \
+  0x00,                                 /* iInterface */                                   \
+  AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */                                      \
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */                              \
+  AUDIO_STREAMING_GENERAL,              /* bDescriptorSubtype */                           \
+  AUDIO_PORT_OUTPUT_TERMINAL_ID_3,      /* bTerminalLink */                                \
+  0x01,                                 /* bDelay */                                       \
+  0x01,                                 /* wFormatTag AUDIO_FORMAT_PCM  0x0001 */          \
+  0x00,                                                                                    \
+  0x0B,                                 /* bLength */                                      \
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */                              \
+  AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */                           \
+  AUDIO_FORMAT_TYPE_I,                  /* bFormatType */                                  \
+  AUDIO_PORT_ALT_CHANNEL_NUMS(alt),     /* bNrChannels */                                  \
+  AUDIO_PORT_ALT_SUBFRAME_SIZE(alt),    /* bSubFrameSize : 2/3/4 Bytes per sample */       \
+  AUDIO_PORT_ALT_BIT_RESOLUTION(alt),   /* bBitResolution 16/24/32-bits per sample */      \
+  0x01,                                 /* bSamFreqType only one frequency supported */    \
+  AUDIO_SAMPLE_FREQ(USBD_AUDIO_FREQ),   /* Audio sampling frequency coded on 3 bytes */    \
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */                                      \
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */                              \
+  AUDIO_PORT_IN_EP_DIR_ID,              /* bEndpointAddress 1 in endpoint */               \
+  USBD_EP_TYPE_ISOC,                    /* bmAttributes */                                 \
+  AUDIO_PORT_PACKET_SZE(AUDIO_PORT_ALT_CHANNEL_NUMS(alt), AUDIO_PORT_ALT_SUBFRAME_SIZE(alt)), \
+                                        /* wMaxPacketSize Freq(Samples)*ch*SubFrameSize */ \
+  AUDIO_PORT_FS_BINTERVAL,              /* bInterval */                                    \
+  0x00,                                 /* bRefresh */                                     \
+  0x00,                                 /* bSynchAddress */                                \
+  AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */                                      \
+  AUDIO_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType */                              \
+  AUDIO_ENDPOINT_GENERAL,               /* bDescriptor */                                  \
+  0x00,                                 /* bmAttributes */                                 \
+  0x00,                                 /* bLockDelayUnits */                              \
+  0x00,                                 /* wLockDelay */                                   \
+  0x00
+
 /**
   * @}
   */
@@ -156,7 +201,7 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   /* Configuration 1 */
   0x09,                                 /* bLength */
   USB_DESC_TYPE_CONFIGURATION,          /* bDescriptorType */
-  LOBYTE(USB_AUDIO_CONFIG_DESC_SIZ),    /* wTotalLength  109 bytes*/
+  LOBYTE(USB_AUDIO_CONFIG_DESC_SIZ),    /* wTotalLength  589 bytes*/
   HIBYTE(USB_AUDIO_CONFIG_DESC_SIZ),
   0x02,                                 /* bNumInterfaces */
   0x01,                                 /* bConfigurationValue */
@@ -187,7 +232,7 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   AUDIO_CONTROL_HEADER,                 /* bDescriptorSubtype */
   0x00,          /* 1.00 */             /* bcdADC */
   0x01,
-  0x27,                                 /* wTotalLength = 39*/
+  0x2E,                                 /* wTotalLength = 46*/
   0x00,
   0x01,                                 /* bInCollection */
   0x01,                                 /* baInterfaceNr */
@@ -201,24 +246,24 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   AUDIO_PORT_MICRO_PHONE_TERMINAL_L,    /* wTerminalType AUDIO_TERMINAL_USB_Microphone   0x0201 */
   AUDIO_PORT_MICRO_PHONE_TERMINAL_H,
   0x00,                                 /* bAssocTerminal */
-  AUDIO_PORT_CHANNEL_NUMS,              /* bNrChannels */
-  AUDIO_PORT_CHANNEL_CONFIG_L,          /* wChannelConfig 0x0000  Mono or L+R or L or R*/
+  AUDIO_PORT_CHANNEL_NUMS_MAX,          /* bNrChannels */
+  AUDIO_PORT_CHANNEL_CONFIG_L,          /* wChannelConfig 0x0000  no spatial location */
   AUDIO_PORT_CHANNEL_CONFIG_H,
   0x00,                                 /* iChannelNames */
   0x00,                                 /* iTerminal */
   /* 12 byte*/
 
   /* USB Microphone Audio Feature Unit Descriptor */
-  0x09,                                 /* bLength */
+  0x10,                                 /* bLength = 7 + (bNrChannels + 1) */
   AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
   AUDIO_CONTROL_FEATURE_UNIT,           /* bDescriptorSubtype */
   AUDIO_PORT_INPUT_CTL_ID_2,            /* bUnitID */
   AUDIO_PORT_INPUT_TERMINAL_ID_1,       /* bSourceID */
   0x01,                                 /* bControlSize */
-  AUDIO_CONTROL_MUTE,                   /* bmaControls(0) */
-  0,                                    /* bmaControls(1) */
+  AUDIO_CONTROL_MUTE,                   /* bmaControls(0) master */
+  0, 0, 0, 0, 0, 0, 0, 0,               /* bmaControls(1..8) */
   0x00,                                 /* iTerminal */
-  /* 09 byte*/
+  /* 16 byte*/
 
   /*USB Microphone Output Terminal Descriptor */
   0x09,      /* bLength */
@@ -245,61 +290,19 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   0x00,                                 /* iInterface */
   /* 09 byte*/
 
-  /* USB Microphone Standard AS Interface Descriptor - Audio Streaming Operational */
-  /* Interface 1, Alternate Setting 1                                           */
-  AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
-  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
-  0x01,                                 /* bInterfaceNumber */
-  0x01,                                 /* bAlternateSetting */
-  0x01,                                 /* bNumEndpoints */
-  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
-  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
-  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
-  0x00,                                 /* iInterface */
-  /* 09 byte*/
-
-  /* USB Microphone Audio Streaming Interface Descriptor */
-  AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */
-  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
-  AUDIO_STREAMING_GENERAL,              /* bDescriptorSubtype */
-  AUDIO_PORT_OUTPUT_TERMINAL_ID_3,      /* bTerminalLink */
-  0x01,                                 /* bDelay */
-  0x01,                                 /* wFormatTag AUDIO_FORMAT_PCM  0x0001 */
-  0x00,
-  /* 07 byte*/
-
-  /* USB Microphone Audio Type III Format Interface Descriptor */
-  0x0B,                                 /* bLength */
-  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
-  AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */
-  AUDIO_FORMAT_TYPE_I,                  /* bFormatType */
-  AUDIO_PORT_CHANNEL_NUMS,              /* bNrChannels */
-  0x02,                                 /* bSubFrameSize :  2 Bytes per frame (16bits) */
-  16,                                   /* bBitResolution (16-bits per sample) */
-  0x01,                                 /* bSamFreqType only one frequency supported */
-  AUDIO_SAMPLE_FREQ(USBD_AUDIO_FREQ),   /* Audio sampling frequency coded on 3 bytes */
-  /* 11 byte*/
-
-  /* Endpoint 1 - Standard Descriptor */
-  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
-  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
-  AUDIO_PORT_IN_EP_DIR_ID,              /* bEndpointAddress 1 in endpoint */
-  USBD_EP_TYPE_ISOC,                    /* bmAttributes */
-  AUDIO_PORT_PACKET_SZE(USBD_AUDIO_FREQ),/* wMaxPacketSize in Bytes (Freq(Samples)*2(Stereo)*2(HalfWord)) */
-  AUDIO_PORT_FS_BINTERVAL,              /* bInterval */
-  0x00,                                 /* bRefresh */
-  0x00,                                 /* bSynchAddress */
-  /* 09 byte*/
-
-  /* Endpoint - Audio Streaming Descriptor*/
-  AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */
-  AUDIO_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType */
-  AUDIO_ENDPOINT_GENERAL,               /* bDescriptor */
-  0x00,                                 /* bmAttributes */
-  0x00,                                 /* bLockDelayUnits */
-  0x00,                                 /* wLockDelay */
-  0x00,
-  /* 07 byte*/
+  /* USB Microphone Audio Streaming Operational: Interface 1, Alternate Setting 1-12 */
+  AUDIO_PORT_AS_ALT_DESC(0x01U),        /* 16-bit 1 channel  */
+  AUDIO_PORT_AS_ALT_DESC(0x02U),        /* 16-bit 2 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x03U),        /* 16-bit 4 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x04U),        /* 16-bit 8 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x05U),        /* 24-bit 1 channel  */
+  AUDIO_PORT_AS_ALT_DESC(0x06U),        /* 24-bit 2 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x07U),        /* 24-bit 4 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x08U),        /* 24-bit 8 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x09U),        /* 32-bit 1 channel  */
+  AUDIO_PORT_AS_ALT_DESC(0x0AU),        /* 32-bit 2 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x0BU),        /* 32-bit 4 channels */
+  AUDIO_PORT_AS_ALT_DESC(0x0CU),        /* 32-bit 8 channels */
 } ;
 
 /* USB Standard Device Descriptor */
@@ -447,9 +450,11 @@ static uint8_t USBD_AUDIO_Setup(USBD_HandleTypeDef *pdev,
         case USB_REQ_SET_INTERFACE:
           if (pdev->dev_state == USBD_STATE_CONFIGURED)
           {
-            if ((uint8_t)(req->wValue) <= USBD_MAX_NUM_INTERFACES)
+            if ((uint8_t)(req->wValue) <= AUDIO_PORT_ALT_SETTING_NUM)
             {
               haudio->alt_setting = (uint8_t)(req->wValue);
+              /* Streaming alternate setting selects the channel count and sample size */
+              USB_Audio_Port_Set_Alt_Setting((uint8_t)(req->wValue));
             }
             else
             {
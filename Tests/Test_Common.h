@@ -0,0 +1,108 @@
+/**
+ *  @file Test_Common.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 主机端测试公共定义：计时、伪随机数、校验与JSON结果输出
+ *
+ *  @details 所有测试结果按每行一个JSON对象输出到stdout，便于脚本收集
+ *
+ *  @version V1.0
+ */
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+#include <stdio.h>  /**< if need printf             */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*校验失败时输出JSON错误行并以非零状态退出*/
+#define TEST_CHECK(test, cond, ...)                                                   \
+    do                                                                                \
+    {                                                                                 \
+        if(!(cond))                                                                   \
+        {                                                                             \
+            printf("{\"test\":\"%s\",\"result\":\"fail\",\"line\":%d,\"msg\":\"", (test), __LINE__); \
+            printf(__VA_ARGS__);                                                      \
+            printf("\"}\n");                                                          \
+            exit(1);                                                                  \
+        }                                                                             \
+    }while(0)
+
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/**
+ * [Test_Now_Ns 单调时钟，单位ns]
+ * @return [当前时间]
+ */
+static inline uint64_t Test_Now_Ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * [Test_Rand xorshift32伪随机数，种子固定时结果可复现]
+ * @param  state [随机数状态，不可为0]
+ * @return       [随机数]
+ */
+static inline uint32_t Test_Rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/**
+ * [Test_Rand_Range 取[0, n)范围内随机数]
+ * @param  state [随机数状态]
+ * @param  n     [上限，不可为0]
+ * @return       [随机数]
+ */
+static inline uint32_t Test_Rand_Range(uint32_t *state, uint32_t n)
+{
+    return Test_Rand(state) % n;
+}
+
+/**
+ * [Test_Arg_U32 读取命令行数值参数]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @param  idx  [参数序号]
+ * @param  def  [缺省值]
+ * @return      [参数值]
+ */
+static inline uint32_t Test_Arg_U32(int argc, char **argv, int idx, uint32_t def)
+{
+    if(idx < argc)
+    {
+        return (uint32_t)strtoul(argv[idx], NULL, 0);
+    }
+    return def;
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,527 @@
+/**
+ *  @file adpcm_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief IMA-ADPCM编解码(IMA_xx)及串口音频帧往返测试
+ *
+ *  @details 用法: adpcm_test [种子]
+ *           1、ref：与按IMA规范独立实现的参考编解码器逐字节、逐点比对，含削波及奇数点
+ *           2、stride：交织输入输出与连续数据结果一致
+ *           3、snr：-6dBFS 1kHz正弦编解码信噪比不低于SNR_MIN_DB
+ *           4、frame：按UART_Audio_Port帧格式成帧，两通道交替，随机分段并插入干扰字节，
+ *              经AF_decoderPush还原后与参考重建值逐点一致，丢帧后下一帧独立解码，
+ *              丢帧通道报告一次gap，另一通道不报告
+ *           5、wav：AF_wavHeader字段
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include "ImaAdpcm.h"
+#include "AudioFrame.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define REF_SAMPLES         1001U   /**< 奇数，覆盖末字节半满*/
+#define SNR_SAMPLES         4096U
+#define SNR_MIN_DB          24.0
+#define FRAME_SAMPLES       256U    /**< 与UART_AUDIO_PORT_FRAME_SAMPLES一致*/
+#define FRAME_NUM           12U     /**< 每通道帧数*/
+#define DROP_FRAME          5U      /**< 通道0丢弃的帧序号*/
+#define FRAME_SIZE          AF_IMA_FRAME_SIZE(1U, FRAME_SAMPLES)
+#define STREAM_MAX          (2U * FRAME_NUM * (FRAME_SIZE + 8U))
+
+/** Private typedef ----------------------------------------------------------*/
+/*参考编解码状态*/
+typedef struct
+{
+    int32_t predicted;
+    int32_t index;
+}REF_StateTypeDef;
+
+/*帧解码收集*/
+typedef struct
+{
+    int16_t pcm[2][FRAME_NUM * FRAME_SAMPLES];
+    uint32_t frames[2];
+    uint32_t gaps;
+    uint32_t gap_value;
+    uint32_t repeats;
+    uint32_t errors;
+}COLLECT_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+/*IMA规范步长表及索引调整表*/
+static const int32_t Ref_Step[89] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int32_t Ref_Index_Adjust[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "adpcm_test";
+static int16_t Pcm[2][FRAME_NUM * FRAME_SAMPLES];
+static int16_t Recon[2][FRAME_NUM * FRAME_SAMPLES];
+static uint8_t Stream[STREAM_MAX];
+static COLLECT_TypeDef Collect;
+static AF_DecoderTypeDef Dec;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Ref_Clamp 预测值及索引限幅]
+ * @param state [状态]
+ */
+static void Ref_Clamp(REF_StateTypeDef *state)
+{
+    if(state->predicted > 32767)
+    {
+        state->predicted = 32767;
+    }
+    else if(state->predicted < -32768)
+    {
+        state->predicted = -32768;
+    }
+    if(state->index < 0)
+    {
+        state->index = 0;
+    }
+    else if(state->index > 88)
+    {
+        state->index = 88;
+    }
+}
+
+/**
+ * [Ref_Encode 参考编码单点，按IMA规范的逐位逼近并同步累加重建差值]
+ * @param  state  [状态]
+ * @param  sample [输入点]
+ * @return        [4位码]
+ */
+static uint8_t Ref_Encode(REF_StateTypeDef *state, int16_t sample)
+{
+    int32_t step = Ref_Step[state->index];
+    int32_t diff = sample - state->predicted;
+    int32_t vpdiff = step >> 3;
+    uint8_t code = 0;
+
+    if(diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    for(uint8_t mask = 4; mask > 0U; mask >>= 1)
+    {
+        if(diff >= step)
+        {
+            code |= mask;
+            diff -= step;
+            vpdiff += step;
+        }
+        step >>= 1;
+    }
+    state->predicted += (code & 8U)?-vpdiff:vpdiff;
+    state->index += Ref_Index_Adjust[code & 7U];
+    Ref_Clamp(state);
+    return code;
+}
+
+/**
+ * [Ref_Decode 参考解码单点]
+ * @param  state [状态]
+ * @param  code  [4位码]
+ * @return       [还原点]
+ */
+static int16_t Ref_Decode(REF_StateTypeDef *state, uint8_t code)
+{
+    int32_t step = Ref_Step[state->index];
+    int32_t vpdiff = step >> 3;
+
+    if(code & 4U)
+    {
+        vpdiff += step;
+    }
+    if(code & 2U)
+    {
+        vpdiff += step >> 1;
+    }
+    if(code & 1U)
+    {
+        vpdiff += step >> 2;
+    }
+    state->predicted += (code & 8U)?-vpdiff:vpdiff;
+    state->index += Ref_Index_Adjust[code & 7U];
+    Ref_Clamp(state);
+    return (int16_t)state->predicted;
+}
+
+/**
+ * [Fill_Signal 生成正弦叠加噪声，部分段落超出满幅以覆盖削波]
+ * @param seed    [随机数状态]
+ * @param pcm     [输出]
+ * @param samples [点数]
+ */
+static void Fill_Signal(uint32_t *seed, int16_t *pcm, uint32_t samples)
+{
+    double v = 0;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        v = 12000.0 * sin(2.0 * M_PI * 440.0 * i / 16000.0) + (double)((int32_t)Test_Rand_Range(seed, 4001U) - 2000);
+        /*每隔一段插入满幅方波，步长索引到达上限*/
+        if((i / 128U) % 5U == 3U)
+        {
+            v = ((i / 8U) & 1U)?32767.0:-32768.0;
+        }
+        pcm[i] = (int16_t)((v > 32767.0)?32767.0:((v < -32768.0)?-32768.0:v));
+    }
+}
+
+/**
+ * [Test_Ref 与参考编解码器逐字节、逐点比对]
+ * @param seed [随机数状态]
+ */
+static void Test_Ref(uint32_t *seed)
+{
+    static int16_t pcm[REF_SAMPLES];
+    static int16_t out[REF_SAMPLES];
+    static uint8_t coded[IMA_DATA_SIZE(REF_SAMPLES)];
+    static uint8_t ref_coded[IMA_DATA_SIZE(REF_SAMPLES)];
+    IMA_StateTypeDef enc;
+    IMA_StateTypeDef dec;
+    REF_StateTypeDef ref_enc = {0, 0};
+    REF_StateTypeDef ref_dec = {0, 0};
+    uint8_t code = 0;
+
+    Fill_Signal(seed, pcm, REF_SAMPLES);
+    memset(ref_coded, 0, sizeof(ref_coded));
+    for(uint32_t i = 0; i < REF_SAMPLES; i++)
+    {
+        code = Ref_Encode(&ref_enc, pcm[i]);
+        ref_coded[i / 2U] |= (uint8_t)((i & 1U)?(code << 4):code);
+    }
+
+    IMA_init(&enc);
+    IMA_encode(&enc, pcm, 1, REF_SAMPLES, coded);
+    for(uint32_t i = 0; i < sizeof(coded); i++)
+    {
+        TEST_CHECK(Test_Name, coded[i] == ref_coded[i], "ref: byte %u 0x%02x expect 0x%02x", i, coded[i], ref_coded[i]);
+    }
+    TEST_CHECK(Test_Name, enc.predictor == ref_enc.predicted && enc.index == ref_enc.index,
+               "ref: encoder state %d/%u expect %d/%d", enc.predictor, enc.index, ref_enc.predicted, ref_enc.index);
+
+    IMA_init(&dec);
+    IMA_decode(&dec, coded, REF_SAMPLES, out, 1);
+    for(uint32_t i = 0; i < REF_SAMPLES; i++)
+    {
+        int16_t expect = Ref_Decode(&ref_dec, (i & 1U)?(uint8_t)(coded[i / 2U] >> 4):(uint8_t)(coded[i / 2U] & 0x0FU));
+        TEST_CHECK(Test_Name, out[i] == expect, "ref: sample %u %d expect %d", i, out[i], expect);
+    }
+    /*解码端状态与编码端一致，后续块可无缝衔接*/
+    TEST_CHECK(Test_Name, dec.predictor == enc.predictor && dec.index == enc.index,
+               "ref: decoder state %d/%u encoder %d/%u", dec.predictor, dec.index, enc.predictor, enc.index);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"ref\",\"samples\":%u}\n", Test_Name, REF_SAMPLES);
+}
+
+/**
+ * [Test_Stride 交织输入输出与连续数据结果一致]
+ * @param seed [随机数状态]
+ */
+static void Test_Stride(uint32_t *seed)
+{
+    static int16_t pcm[REF_SAMPLES];
+    static int16_t interleaved[3U * REF_SAMPLES];
+    static int16_t out[REF_SAMPLES];
+    static int16_t out_interleaved[2U * REF_SAMPLES];
+    static uint8_t coded[IMA_DATA_SIZE(REF_SAMPLES)];
+    static uint8_t coded_stride[IMA_DATA_SIZE(REF_SAMPLES)];
+    static uint8_t block[IMA_BLOCK_SIZE(REF_SAMPLES)];
+    IMA_StateTypeDef state;
+
+    Fill_Signal(seed, pcm, REF_SAMPLES);
+    for(uint32_t i = 0; i < REF_SAMPLES; i++)
+    {
+        interleaved[3U*i] = (int16_t)Test_Rand(seed);
+        interleaved[3U*i + 1U] = pcm[i];
+        interleaved[3U*i + 2U] = (int16_t)Test_Rand(seed);
+    }
+    IMA_init(&state);
+    IMA_encode(&state, pcm, 1, REF_SAMPLES, coded);
+    IMA_init(&state);
+    IMA_encode(&state, interleaved + 1, 3, REF_SAMPLES, coded_stride);
+    TEST_CHECK(Test_Name, memcmp(coded, coded_stride, sizeof(coded)) == 0, "stride: encode mismatch");
+
+    /*块头为非零初始状态*/
+    state.predictor = -1234;
+    state.index = 40;
+    IMA_writeBlockHeader(&state, block);
+    IMA_encode(&state, pcm, 1, REF_SAMPLES, block + IMA_BLOCK_HEADER_SIZE);
+    TEST_CHECK(Test_Name, IMA_decodeBlock(block, REF_SAMPLES, out, 1) == true, "stride: block rejected");
+    memset(out_interleaved, 0x55, sizeof(out_interleaved));
+    TEST_CHECK(Test_Name, IMA_decodeBlock(block, REF_SAMPLES, out_interleaved + 1, 2) == true, "stride: block rejected");
+    for(uint32_t i = 0; i < REF_SAMPLES; i++)
+    {
+        TEST_CHECK(Test_Name, out_interleaved[2U*i + 1U] == out[i] && out_interleaved[2U*i] == 0x5555,
+                   "stride: decode sample %u", i);
+    }
+    block[2] = IMA_INDEX_MAX + 1U;
+    TEST_CHECK(Test_Name, IMA_decodeBlock(block, REF_SAMPLES, out, 1) == false, "stride: invalid index accepted");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"stride\"}\n", Test_Name);
+}
+
+/**
+ * [Test_Snr 正弦编解码信噪比]
+ */
+static void Test_Snr(void)
+{
+    static int16_t pcm[SNR_SAMPLES];
+    static int16_t out[SNR_SAMPLES];
+    static uint8_t coded[IMA_DATA_SIZE(SNR_SAMPLES)];
+    IMA_StateTypeDef state;
+    double signal = 0;
+    double noise = 0;
+    double snr = 0;
+
+    for(uint32_t i = 0; i < SNR_SAMPLES; i++)
+    {
+        pcm[i] = (int16_t)lrint(16384.0 * sin(2.0 * M_PI * 1000.0 * i / 16000.0));
+    }
+    IMA_init(&state);
+    IMA_encode(&state, pcm, 1, SNR_SAMPLES, coded);
+    IMA_init(&state);
+    IMA_decode(&state, coded, SNR_SAMPLES, out, 1);
+    /*跳过步长收敛段*/
+    for(uint32_t i = 256U; i < SNR_SAMPLES; i++)
+    {
+        signal += (double)pcm[i] * pcm[i];
+        noise += (double)(out[i] - pcm[i]) * (out[i] - pcm[i]);
+    }
+    snr = 10.0 * log10(signal / ((noise > 0.0)?noise:1.0));
+    TEST_CHECK(Test_Name, snr >= SNR_MIN_DB, "snr: %.1f dB below %.1f dB", snr, SNR_MIN_DB);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"snr\",\"snr_db\":%.1f}\n", Test_Name, snr);
+}
+
+/**
+ * [Build_Frame 按UART_Audio_Port格式生成单通道IMA帧]
+ * @param  state   [编码状态]
+ * @param  channel [来源通道]
+ * @param  counter [样点计数]
+ * @param  pcm     [FRAME_SAMPLES点]
+ * @param  out     [输出，FRAME_SIZE字节]
+ * @return         [帧长]
+ */
+static uint32_t Build_Frame(IMA_StateTypeDef *state, uint8_t channel, uint32_t counter, const int16_t *pcm, uint8_t *out)
+{
+    AF_HeaderTypeDef header;
+    uint32_t size = AF_HEADER_SIZE + AF_IMA_PAYLOAD_SIZE(1U, FRAME_SAMPLES);
+    uint32_t crc = 0;
+
+    memset(out, 0, FRAME_SIZE);
+    memset(&header, 0, sizeof(header));
+    header.sync = AF_SYNC_WORD;
+    header.version = AF_VERSION;
+    header.channel_number = 1;
+    header.channel_map = (uint16_t)(1U << channel);
+    header.frame_samples = FRAME_SAMPLES;
+    header.header_size = AF_HEADER_SIZE;
+    header.sample_counter = counter;
+    header.codec = AF_CODEC_IMA_ADPCM;
+    header.decimation = (uint8_t)(channel + 1U);
+    header.payload_size = (uint16_t)AF_IMA_PAYLOAD_SIZE(1U, FRAME_SAMPLES);
+    memcpy(out, &header, AF_HEADER_SIZE);
+    IMA_writeBlockHeader(state, out + AF_HEADER_SIZE);
+    IMA_encode(state, pcm, 1, FRAME_SAMPLES, out + AF_HEADER_SIZE + IMA_BLOCK_HEADER_SIZE);
+
+    crc = AF_crc32(AF_CRC_INIT, out, size);
+    for(uint32_t i = 0; i < 4U; i++)
+    {
+        out[size + i] = (uint8_t)(crc >> (8U * i));
+    }
+    return size + AF_CRC_SIZE;
+}
+
+/**
+ * [On_Frame 收集解码帧]
+ * @param header [帧头]
+ * @param data   [小端int16]
+ * @param user   [收集区]
+ */
+static void On_Frame(const AF_HeaderTypeDef *header, const uint8_t *data, void *user)
+{
+    COLLECT_TypeDef *c = (COLLECT_TypeDef *)user;
+    uint32_t ch = (header->channel_map == 1U)?0U:1U;
+    uint32_t index = header->sample_counter / FRAME_SAMPLES;
+
+    TEST_CHECK(Test_Name, header->codec == AF_CODEC_IMA_ADPCM && header->decimation == ch + 1U
+               && index < FRAME_NUM, "frame: header map %u counter %u", header->channel_map, header->sample_counter);
+    for(uint32_t i = 0; i < FRAME_SAMPLES; i++)
+    {
+        c->pcm[ch][index * FRAME_SAMPLES + i] = (int16_t)(uint16_t)(data[2U*i] | ((uint16_t)data[2U*i + 1U] << 8));
+    }
+    c->frames[ch]++;
+}
+
+/**
+ * [On_Event 统计解码事件]
+ * @param event [事件]
+ * @param value [参数]
+ * @param user  [收集区]
+ */
+static void On_Event(AF_EVENT_ENUM_TypeDef event, uint32_t value, void *user)
+{
+    COLLECT_TypeDef *c = (COLLECT_TypeDef *)user;
+
+    switch(event)
+    {
+        case AF_EVENT_GAP:
+            c->gaps++;
+            c->gap_value = value;
+            break;
+        case AF_EVENT_REPEAT:
+            c->repeats++;
+            break;
+        case AF_EVENT_CRC_ERROR:
+        case AF_EVENT_DECODE_ERROR:
+            c->errors++;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * [Test_Frame 两通道交替成帧，随机分段及干扰字节下往返解码]
+ * @param seed [随机数状态]
+ */
+static void Test_Frame(uint32_t *seed)
+{
+    IMA_StateTypeDef state[2];
+    REF_StateTypeDef ref[2] = {{0, 0}, {0, 0}};
+    uint8_t frame[FRAME_SIZE];
+    uint32_t len = 0;
+    uint32_t size = 0;
+    uint32_t pos = 0;
+    uint32_t chunk = 0;
+
+    for(uint32_t ch = 0; ch < 2U; ch++)
+    {
+        Fill_Signal(seed, Pcm[ch], FRAME_NUM * FRAME_SAMPLES);
+        IMA_init(&state[ch]);
+        for(uint32_t i = 0; i < FRAME_NUM * FRAME_SAMPLES; i++)
+        {
+            (void)Ref_Encode(&ref[ch], Pcm[ch][i]);
+            Recon[ch][i] = (int16_t)ref[ch].predicted;
+        }
+    }
+
+    for(uint32_t n = 0; n < FRAME_NUM; n++)
+    {
+        for(uint32_t ch = 0; ch < 2U; ch++)
+        {
+            size = Build_Frame(&state[ch], (uint8_t)ch, n * FRAME_SAMPLES, Pcm[ch] + n * FRAME_SAMPLES, frame);
+            /*发送缓冲区满时整帧丢弃，编码状态照常推进*/
+            if(ch == 0U && n == DROP_FRAME)
+            {
+                continue;
+            }
+            memcpy(Stream + len, frame, size);
+            len += size;
+            /*共用串口的printf输出*/
+            if(Test_Rand_Range(seed, 3U) == 0U)
+            {
+                memcpy(Stream + len, "ok\r\n", 4);
+                len += 4U;
+            }
+        }
+    }
+
+    memset(&Collect, 0, sizeof(Collect));
+    AF_decoderInit(&Dec, On_Frame, On_Event, &Collect);
+    while(pos < len)
+    {
+        chunk = 1U + Test_Rand_Range(seed, 300U);
+        chunk = (chunk > len - pos)?(len - pos):chunk;
+        AF_decoderPush(&Dec, Stream + pos, chunk);
+        pos += chunk;
+    }
+
+    TEST_CHECK(Test_Name, Collect.frames[0] == FRAME_NUM - 1U && Collect.frames[1] == FRAME_NUM,
+               "frame: decoded %u/%u frames", Collect.frames[0], Collect.frames[1]);
+    TEST_CHECK(Test_Name, Collect.errors == 0U && Collect.repeats == 0U, "frame: %u errors %u repeats",
+               Collect.errors, Collect.repeats);
+    TEST_CHECK(Test_Name, Collect.gaps == 1U && Collect.gap_value == FRAME_SAMPLES, "frame: %u gaps value %u",
+               Collect.gaps, Collect.gap_value);
+    for(uint32_t ch = 0; ch < 2U; ch++)
+    {
+        for(uint32_t i = 0; i < FRAME_NUM * FRAME_SAMPLES; i++)
+        {
+            if(ch == 0U && i / FRAME_SAMPLES == DROP_FRAME)
+            {
+                continue;
+            }
+            TEST_CHECK(Test_Name, Collect.pcm[ch][i] == Recon[ch][i], "frame: ch%u sample %u %d expect %d",
+                       ch, i, Collect.pcm[ch][i], Recon[ch][i]);
+        }
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"frame\",\"bytes\":%u,\"frames\":%u}\n",
+           Test_Name, len, Collect.frames[0] + Collect.frames[1]);
+}
+
+/**
+ * [Test_Wav WAV文件头字段]
+ */
+static void Test_Wav(void)
+{
+    static const uint8_t expect[AF_WAV_HEADER_SIZE] =
+    {
+        'R', 'I', 'F', 'F', 0x24, 0x10, 0x00, 0x00, 'W', 'A', 'V', 'E',
+        'f', 'm', 't', ' ', 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+        0x40, 0x1F, 0x00, 0x00, 0x80, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00,
+        'd', 'a', 't', 'a', 0x00, 0x10, 0x00, 0x00
+    };
+    uint8_t header[AF_WAV_HEADER_SIZE];
+
+    AF_wavHeader(header, 1, 8000, 4096);
+    for(uint32_t i = 0; i < AF_WAV_HEADER_SIZE; i++)
+    {
+        TEST_CHECK(Test_Name, header[i] == expect[i], "wav: byte %u 0x%02x expect 0x%02x", i, header[i], expect[i]);
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"wav\"}\n", Test_Name);
+}
+
+/**
+ * [main 依次运行各组]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x1D2C3B4AU);
+
+    Test_Ref(&seed);
+    Test_Stride(&seed);
+    Test_Snr();
+    Test_Frame(&seed);
+    Test_Wav();
+    return 0;
+}
+/******************************** End of file *********************************/
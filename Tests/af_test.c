@@ -0,0 +1,457 @@
+/**
+ *  @file af_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 调试音频帧流式解码(AF_xx)测试
+ *
+ *  @details 用法: af_test [种子] [帧数]
+ *           1、crc：AF_crc32与按位计算的参考值一致，分段计算与整体计算一致
+ *           2、resync：帧间插入随机字节及伪同步字，随机分段输入，全部帧逐字节还原，
+ *              resync事件合计等于插入字节数，不报告CRC错误
+ *           3、sequence：样点计数跳增报告gap及丢失点数，回退报告repeat，帧照常回调
+ *           4、crc_error：数据位翻转及截断帧报告CRC错误，该帧不回调，下一帧重新同步后还原
+ *           5、planar：v3帧头分频表，按通道依次存放的数据及每通道点数
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "AudioFrame.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define CHANNELS            2U
+#define FRAME_SAMPLES       64U
+#define FRAME_SIZE          AF_FRAME_SIZE(CHANNELS, FRAME_SAMPLES)
+#define FRAME_NUM_MAX       256U
+#define NOISE_MAX           40U     /**< 帧间插入字节数上限*/
+#define STREAM_MAX          (FRAME_NUM_MAX * (AF_HEADER_SIZE_MAX + FRAME_SIZE + NOISE_MAX + 8U))
+
+/** Private typedef ----------------------------------------------------------*/
+/*解码结果收集*/
+typedef struct
+{
+    uint32_t frames;
+    uint32_t counter[FRAME_NUM_MAX];
+    uint32_t events[AF_EVENT_DECODE_ERROR + 1];
+    uint32_t event_value[AF_EVENT_DECODE_ERROR + 1]; /**< 各事件参数合计*/
+    bool data_ok;
+    AF_HeaderTypeDef last_header;
+    uint8_t last[CHANNELS * FRAME_SAMPLES * 2U];    /**< 最近一帧数据*/
+}COLLECT_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "af_test";
+static uint8_t Stream[STREAM_MAX];
+static uint8_t Payload[FRAME_NUM_MAX][CHANNELS * FRAME_SAMPLES * 2U];
+static COLLECT_TypeDef Collect;
+static AF_DecoderTypeDef Dec;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Ref_Crc32 按位计算CRC32，按32位小端字输入、高位先行]
+ * @param  data [数据]
+ * @param  len  [字节数，4的整数倍]
+ * @return      [CRC]
+ */
+static uint32_t Ref_Crc32(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = AF_CRC_INIT;
+    uint32_t word = 0;
+
+    for(uint32_t i = 0; i < len; i += 4U)
+    {
+        word = (uint32_t)data[i] | ((uint32_t)data[i + 1U] << 8) | ((uint32_t)data[i + 2U] << 16) | ((uint32_t)data[i + 3U] << 24);
+        crc ^= word;
+        for(uint32_t bit = 0; bit < 32U; bit++)
+        {
+            crc = (crc & 0x80000000U)?((crc << 1) ^ AF_CRC_POLY):(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * [Put_U16 小端写入]
+ */
+static void Put_U16(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * [Put_U32 小端写入]
+ */
+static void Put_U32(uint8_t *out, uint32_t value)
+{
+    Put_U16(out, value);
+    Put_U16(out + 2, value >> 16);
+}
+
+/**
+ * [Build_Frame 生成PCM帧]
+ * @param  out         [输出]
+ * @param  counter     [样点计数]
+ * @param  payload     [数据]
+ * @param  decimation  [各通道分频，NULL时为v2帧头]
+ * @return             [帧长]
+ */
+static uint32_t Build_Frame(uint8_t *out, uint32_t counter, const uint8_t *payload, const uint8_t *decimation)
+{
+    uint32_t header_size = (decimation == NULL)?AF_HEADER_SIZE:AF_HEADER_SIZE_MAX;
+    uint32_t payload_size = 0;
+
+    for(uint32_t ch = 0; ch < CHANNELS; ch++)
+    {
+        payload_size += FRAME_SAMPLES / ((decimation == NULL)?1U:decimation[ch]) * 2U;
+    }
+    memset(out, 0, header_size);
+    Put_U32(out, AF_SYNC_WORD);
+    out[4] = (decimation == NULL)?2U:AF_VERSION;
+    out[5] = CHANNELS;
+    Put_U16(out + 6, (1U << CHANNELS) - 1U);
+    Put_U16(out + 8, FRAME_SAMPLES);
+    Put_U16(out + 10, header_size);
+    Put_U32(out + 12, counter);
+    Put_U32(out + 16, counter / 16U);
+    out[24] = AF_CODEC_PCM;
+    out[25] = 1;
+    Put_U16(out + 26, payload_size);
+    if(decimation != NULL)
+    {
+        memcpy(out + AF_HEADER_SIZE, decimation, CHANNELS);
+    }
+    memcpy(out + header_size, payload, payload_size);
+    Put_U32(out + header_size + payload_size, AF_crc32(AF_CRC_INIT, out, header_size + payload_size));
+    return header_size + payload_size + AF_CRC_SIZE;
+}
+
+/**
+ * [Add_Noise 插入随机字节，部分含伪同步字]
+ * @param  seed [随机数状态]
+ * @param  out  [输出]
+ * @return      [字节数]
+ */
+static uint32_t Add_Noise(uint32_t *seed, uint8_t *out)
+{
+    uint32_t len = Test_Rand_Range(seed, NOISE_MAX + 1U);
+
+    for(uint32_t i = 0; i < len; i++)
+    {
+        out[i] = (uint8_t)Test_Rand(seed);
+    }
+    /*伪同步字后跟随机帧头*/
+    if(len >= 8U && Test_Rand_Range(seed, 2U) == 0U)
+    {
+        Put_U32(out + Test_Rand_Range(seed, len - 7U), AF_SYNC_WORD);
+    }
+    return len;
+}
+
+/**
+ * [On_Frame 记录帧并比对数据]
+ * @param header [帧头]
+ * @param data   [数据]
+ * @param user   [收集区]
+ */
+static void On_Frame(const AF_HeaderTypeDef *header, const uint8_t *data, void *user)
+{
+    COLLECT_TypeDef *c = (COLLECT_TypeDef *)user;
+    uint32_t index = header->sample_counter / FRAME_SAMPLES;
+
+    if(c->frames < FRAME_NUM_MAX)
+    {
+        c->counter[c->frames] = header->sample_counter;
+    }
+    c->frames++;
+    c->last_header = *header;
+    memcpy(c->last, data, (header->payload_size < sizeof(c->last))?header->payload_size:sizeof(c->last));
+    /*v2帧数据按sample_counter / FRAME_SAMPLES对应Payload*/
+    if(header->header_size == AF_HEADER_SIZE
+       && (index >= FRAME_NUM_MAX || memcmp(data, Payload[index], sizeof(Payload[0])) != 0))
+    {
+        c->data_ok = false;
+    }
+}
+
+/**
+ * [On_Event 统计事件]
+ * @param event [事件]
+ * @param value [参数]
+ * @param user  [收集区]
+ */
+static void On_Event(AF_EVENT_ENUM_TypeDef event, uint32_t value, void *user)
+{
+    COLLECT_TypeDef *c = (COLLECT_TypeDef *)user;
+
+    c->events[event]++;
+    c->event_value[event] += value;
+}
+
+/**
+ * [Decoder_Reset 清空收集区并初始化解码器]
+ */
+static void Decoder_Reset(void)
+{
+    memset(&Collect, 0, sizeof(Collect));
+    Collect.data_ok = true;
+    AF_decoderInit(&Dec, On_Frame, On_Event, &Collect);
+}
+
+/**
+ * [Push_Random 随机分段输入]
+ * @param seed [随机数状态]
+ * @param data [数据]
+ * @param len  [字节数]
+ */
+static void Push_Random(uint32_t *seed, const uint8_t *data, uint32_t len)
+{
+    uint32_t chunk = 0;
+
+    while(len > 0U)
+    {
+        chunk = 1U + Test_Rand_Range(seed, 2U * FRAME_SIZE);
+        chunk = (chunk > len)?len:chunk;
+        AF_decoderPush(&Dec, data, chunk);
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+/**
+ * [Test_Crc CRC与参考实现比对]
+ * @param seed [随机数状态]
+ */
+static void Test_Crc(uint32_t *seed)
+{
+    uint8_t data[256];
+    uint32_t split = 0;
+
+    for(uint32_t loop = 0; loop < 64U; loop++)
+    {
+        for(uint32_t i = 0; i < sizeof(data); i++)
+        {
+            data[i] = (uint8_t)Test_Rand(seed);
+        }
+        split = 4U * Test_Rand_Range(seed, sizeof(data) / 4U);
+        TEST_CHECK(Test_Name, AF_crc32(AF_CRC_INIT, data, sizeof(data)) == Ref_Crc32(data, sizeof(data)), "crc: loop %u", loop);
+        TEST_CHECK(Test_Name, AF_crc32(AF_crc32(AF_CRC_INIT, data, split), data + split, sizeof(data) - split)
+                   == AF_crc32(AF_CRC_INIT, data, sizeof(data)), "crc: split at %u", split);
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"crc\"}\n", Test_Name);
+}
+
+/**
+ * [Test_Resync 帧间插入干扰字节]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Resync(uint32_t *seed, uint32_t frames)
+{
+    uint32_t len = 0;
+    uint32_t noise = 0;
+    uint32_t n = 0;
+
+    for(uint32_t i = 0; i < frames; i++)
+    {
+        n = Add_Noise(seed, Stream + len);
+        len += n;
+        noise += n;
+        len += Build_Frame(Stream + len, i * FRAME_SAMPLES, Payload[i], NULL);
+    }
+    Decoder_Reset();
+    Push_Random(seed, Stream, len);
+
+    TEST_CHECK(Test_Name, Collect.frames == frames && Collect.data_ok == true, "resync: %u/%u frames data %d",
+               Collect.frames, frames, Collect.data_ok);
+    TEST_CHECK(Test_Name, Collect.event_value[AF_EVENT_RESYNC] == noise && AF_decoderGetStats(&Dec)->skipped_bytes == noise,
+               "resync: skipped %u expect %u", Collect.event_value[AF_EVENT_RESYNC], noise);
+    TEST_CHECK(Test_Name, Collect.events[AF_EVENT_CRC_ERROR] == 0U && Collect.events[AF_EVENT_GAP] == 0U
+               && Collect.events[AF_EVENT_REPEAT] == 0U, "resync: crc %u gap %u repeat %u",
+               Collect.events[AF_EVENT_CRC_ERROR], Collect.events[AF_EVENT_GAP], Collect.events[AF_EVENT_REPEAT]);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"resync\",\"frames\":%u,\"noise_bytes\":%u,\"resyncs\":%u}\n",
+           Test_Name, frames, noise, Collect.events[AF_EVENT_RESYNC]);
+}
+
+/**
+ * [Test_Sequence 样点计数跳增及回退]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Sequence(uint32_t *seed, uint32_t frames)
+{
+    uint32_t len = 0;
+    uint32_t index = 0;
+    uint32_t gaps = 0;
+    uint32_t gap_samples = 0;
+    uint32_t repeats = 0;
+    uint32_t sent = 0;
+    uint32_t step = 0;
+
+    while(index < frames)
+    {
+        len += Build_Frame(Stream + len, index * FRAME_SAMPLES, Payload[index], NULL);
+        sent++;
+        /*随机跳过若干帧或重发上一帧*/
+        step = Test_Rand_Range(seed, 8U);
+        if(step == 0U && index + 4U < frames)
+        {
+            gaps++;
+            gap_samples += 3U * FRAME_SAMPLES;
+            index += 4U;
+        }
+        else if(step == 1U)
+        {
+            len += Build_Frame(Stream + len, index * FRAME_SAMPLES, Payload[index], NULL);
+            sent++;
+            repeats++;
+            index++;
+        }
+        else
+        {
+            index++;
+        }
+    }
+    Decoder_Reset();
+    Push_Random(seed, Stream, len);
+
+    TEST_CHECK(Test_Name, Collect.frames == sent && Collect.data_ok == true, "sequence: %u/%u frames", Collect.frames, sent);
+    TEST_CHECK(Test_Name, Collect.events[AF_EVENT_GAP] == gaps && Collect.event_value[AF_EVENT_GAP] == gap_samples,
+               "sequence: gaps %u/%u samples %u/%u", Collect.events[AF_EVENT_GAP], gaps,
+               Collect.event_value[AF_EVENT_GAP], gap_samples);
+    TEST_CHECK(Test_Name, Collect.events[AF_EVENT_REPEAT] == repeats && Collect.event_value[AF_EVENT_REPEAT] == repeats * FRAME_SAMPLES,
+               "sequence: repeats %u/%u", Collect.events[AF_EVENT_REPEAT], repeats);
+    TEST_CHECK(Test_Name, AF_decoderGetStats(&Dec)->gap_samples == gap_samples, "sequence: stats gap samples");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"sequence\",\"frames\":%u,\"gaps\":%u,\"repeats\":%u}\n",
+           Test_Name, sent, gaps, repeats);
+}
+
+/**
+ * [Test_Crc_Error 位翻转及截断帧]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Crc_Error(uint32_t *seed, uint32_t frames)
+{
+    uint32_t len = 0;
+    uint32_t size = 0;
+    uint32_t flipped = 0;
+    uint32_t truncated = 0;
+    uint32_t good = 0;
+    uint32_t kind = 0;
+
+    for(uint32_t i = 0; i < frames; i++)
+    {
+        size = Build_Frame(Stream + len, i * FRAME_SAMPLES, Payload[i], NULL);
+        /*首帧及末帧保持完整，中间帧随机损坏*/
+        kind = (i == 0U || i + 1U == frames)?0U:Test_Rand_Range(seed, 6U);
+        if(kind == 1U)
+        {
+            /*帧头之后任一位翻转，含CRC字段*/
+            Stream[len + AF_HEADER_SIZE + Test_Rand_Range(seed, size - AF_HEADER_SIZE)] ^= (uint8_t)(1U << Test_Rand_Range(seed, 8U));
+            flipped++;
+        }
+        else if(kind == 2U)
+        {
+            /*发送中断，帧尾丢失*/
+            size = AF_HEADER_SIZE + Test_Rand_Range(seed, size - AF_HEADER_SIZE);
+            truncated++;
+        }
+        else
+        {
+            good++;
+        }
+        len += size;
+    }
+    Decoder_Reset();
+    Push_Random(seed, Stream, len);
+
+    TEST_CHECK(Test_Name, Collect.frames == good && Collect.data_ok == true, "crc_error: %u/%u frames", Collect.frames, good);
+    TEST_CHECK(Test_Name, Collect.events[AF_EVENT_CRC_ERROR] == flipped + truncated,
+               "crc_error: %u errors, flipped %u truncated %u", Collect.events[AF_EVENT_CRC_ERROR], flipped, truncated);
+    TEST_CHECK(Test_Name, AF_decoderGetStats(&Dec)->crc_errors == flipped + truncated, "crc_error: stats");
+    /*损坏帧之后的帧报告丢失点数*/
+    TEST_CHECK(Test_Name, Collect.event_value[AF_EVENT_GAP] == (flipped + truncated) * FRAME_SAMPLES,
+               "crc_error: gap samples %u", Collect.event_value[AF_EVENT_GAP]);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"crc_error\",\"frames\":%u,\"flipped\":%u,\"truncated\":%u}\n",
+           Test_Name, frames, flipped, truncated);
+}
+
+/**
+ * [Test_Planar v3帧头分频表]
+ * @param seed [随机数状态]
+ */
+static void Test_Planar(uint32_t *seed)
+{
+    static const uint8_t decimation[CHANNELS] = {1, 4};
+    uint8_t payload[CHANNELS * FRAME_SAMPLES * 2U];
+    uint32_t size = 0;
+    uint32_t len = 0;
+
+    for(uint32_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)Test_Rand(seed);
+    }
+    size = Build_Frame(Stream, 0, payload, decimation);
+    len = Build_Frame(Stream + size, FRAME_SAMPLES, payload, decimation) + size;
+    /*分频非2的幂时帧头无效，跳过后下一帧同步*/
+    Stream[AF_HEADER_SIZE + 1U] = 3U;
+
+    Decoder_Reset();
+    AF_decoderPush(&Dec, Stream, len);
+
+    TEST_CHECK(Test_Name, Collect.frames == 1U && Collect.counter[0] == FRAME_SAMPLES, "planar: %u frames", Collect.frames);
+    TEST_CHECK(Test_Name, Collect.events[AF_EVENT_RESYNC] == 1U && Collect.event_value[AF_EVENT_RESYNC] == size,
+               "planar: resync %u bytes", Collect.event_value[AF_EVENT_RESYNC]);
+    TEST_CHECK(Test_Name, AF_channelSamples(&Collect.last_header, 0) == FRAME_SAMPLES
+               && AF_channelSamples(&Collect.last_header, 1) == FRAME_SAMPLES / 4U
+               && Collect.last_header.channel_decimation[1] == 4U, "planar: channel samples");
+    /*第0通道全部点在前，第1通道1/4点紧随其后*/
+    TEST_CHECK(Test_Name, memcmp(Collect.last, payload, (FRAME_SAMPLES + FRAME_SAMPLES / 4U) * 2U) == 0, "planar: data");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"planar\"}\n", Test_Name);
+}
+
+/**
+ * [main 依次运行各组]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x5EED1234U);
+    uint32_t frames = Test_Arg_U32(argc, argv, 2, 200U);
+
+    frames = (frames > FRAME_NUM_MAX)?FRAME_NUM_MAX:((frames < 8U)?8U:frames);
+    for(uint32_t i = 0; i < FRAME_NUM_MAX; i++)
+    {
+        for(uint32_t j = 0; j < sizeof(Payload[0]); j++)
+        {
+            Payload[i][j] = (uint8_t)Test_Rand(&seed);
+        }
+    }
+
+    Test_Crc(&seed);
+    Test_Resync(&seed, frames);
+    Test_Sequence(&seed, frames);
+    Test_Crc_Error(&seed, frames);
+    Test_Planar(&seed);
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,166 @@
+/**
+ *  @file cq_bench.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief CircularQueue主机端吞吐测试
+ *
+ *  @details 用法: cq_bench [每组元素总数]
+ *           按位宽、缓冲区大小、单次长度与起始偏移(是否回绕)组合测量写入+读出耗时，
+ *           另测交织写入，每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define MAX_SIZE            4096U
+#define MAX_CHANNEL         8U
+#define IL_FRAMES           128U    /**< 与调试通道每帧点数一致*/
+
+/** Private typedef ----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static uint32_t Ring_Buf[MAX_SIZE];
+static uint32_t Src_Buf[MAX_SIZE];
+static uint32_t Dst_Buf[MAX_SIZE];
+static uint16_t Ch_Buf[MAX_CHANNEL][IL_FRAMES];
+/*防止读出结果被优化掉*/
+static volatile uint32_t Sink;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Bench_Put_Get 一组写入+读出吞吐]
+ * @param shift  [元素字节数左移位数]
+ * @param size   [缓冲区大小]
+ * @param chunk  [单次读写元素个数]
+ * @param offset [起始偏移，非0时每次读写均跨越回绕处]
+ * @param total  [元素总数]
+ */
+static void Bench_Put_Get(uint32_t shift, uint32_t size, uint32_t chunk, uint32_t offset, uint32_t total)
+{
+    CQ_handleTypeDef cq;
+    uint32_t loops = total / chunk;
+    uint32_t moved = 0;
+    uint64_t start = 0;
+    uint64_t ns = 0;
+
+    switch(shift)
+    {
+        case 0:
+            CQ_init(&cq, (uint8_t *)Ring_Buf, size);
+            break;
+        case 1:
+            CQ_16_init(&cq, (uint16_t *)Ring_Buf, size);
+            break;
+        default:
+            CQ_32_init(&cq, Ring_Buf, size);
+            break;
+    }
+    cq.entrance = cq.exit = offset;
+
+    start = Test_Now_Ns();
+    for(uint32_t i = 0; i < loops; i++)
+    {
+        switch(shift)
+        {
+            case 0:
+                CQ_putData(&cq, (const uint8_t *)Src_Buf, chunk);
+                moved += CQ_getData(&cq, (uint8_t *)Dst_Buf, chunk);
+                break;
+            case 1:
+                CQ_16putData(&cq, (const uint16_t *)Src_Buf, chunk);
+                moved += CQ_16getData(&cq, (uint16_t *)Dst_Buf, chunk);
+                break;
+            default:
+                CQ_32putData(&cq, Src_Buf, chunk);
+                moved += CQ_32getData(&cq, Dst_Buf, chunk);
+                break;
+        }
+        /*保持每次读写起始偏移不变*/
+        cq.entrance = cq.exit = offset;
+    }
+    ns = Test_Now_Ns() - start;
+    Sink += Dst_Buf[0];
+
+    printf("{\"bench\":\"put_get\",\"bits\":%u,\"size\":%u,\"chunk\":%u,\"wrap\":%s,\"elements\":%u,"
+           "\"ns_per_elem\":%.3f,\"mb_per_s\":%.1f}\n",
+           8U << shift, size, chunk, (offset != 0U)?"true":"false", moved,
+           (double)ns / moved, (double)moved * (1U << shift) * 1e3 / ns);
+}
+
+/**
+ * [Bench_Interleave 交织写入吞吐]
+ * @param ch_num [通道数]
+ * @param total  [帧总数]
+ */
+static void Bench_Interleave(uint32_t ch_num, uint32_t total)
+{
+    CQ_handleTypeDef cq;
+    const uint16_t *channels[MAX_CHANNEL];
+    uint32_t loops = total / IL_FRAMES;
+    uint32_t frames = 0;
+    uint64_t start = 0;
+    uint64_t ns = 0;
+
+    for(uint32_t ch = 0; ch < ch_num; ch++)
+    {
+        channels[ch] = Ch_Buf[ch];
+    }
+    CQ_16_init(&cq, (uint16_t *)Ring_Buf, MAX_SIZE);
+
+    start = Test_Now_Ns();
+    for(uint32_t i = 0; i < loops; i++)
+    {
+        frames += CQ_16putInterleaved(&cq, channels, ch_num, 1, IL_FRAMES);
+        CQ_ManualOffsetInc(&cq, IL_FRAMES * ch_num);
+    }
+    ns = Test_Now_Ns() - start;
+
+    printf("{\"bench\":\"interleave\",\"bits\":16,\"channels\":%u,\"frames\":%u,\"ns_per_frame\":%.3f,\"mb_per_s\":%.1f}\n",
+           ch_num, frames, (double)ns / frames, (double)frames * ch_num * 2U * 1e3 / ns);
+}
+
+/**
+ * [main 依次运行各组合]
+ * @param  argc [参数个数]
+ * @param  argv [每组元素总数]
+ * @return      [0]
+ */
+int main(int argc, char **argv)
+{
+    static const uint32_t Size_Table[] = {256, 1024, 4096};
+    static const uint32_t Chunk_Table[] = {1, 7, 64, 128, 200};
+    uint32_t total = Test_Arg_U32(argc, argv, 1, 4000000U);
+
+    for(uint32_t i = 0; i < MAX_SIZE; i++)
+    {
+        Src_Buf[i] = i * 2654435761U;
+    }
+    for(uint32_t shift = 0; shift < 3U; shift++)
+    {
+        for(uint32_t s = 0; s < sizeof(Size_Table) / sizeof(Size_Table[0]); s++)
+        {
+            for(uint32_t c = 0; c < sizeof(Chunk_Table) / sizeof(Chunk_Table[0]); c++)
+            {
+                Bench_Put_Get(shift, Size_Table[s], Chunk_Table[c], 0, total);
+                /*起始于末尾前半个块，强制拆分为两段拷贝*/
+                Bench_Put_Get(shift, Size_Table[s], Chunk_Table[c], Size_Table[s] - Chunk_Table[c] / 2U, total);
+            }
+        }
+    }
+    for(uint32_t ch = 1; ch <= MAX_CHANNEL; ch++)
+    {
+        Bench_Interleave(ch, total / 4U);
+    }
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,299 @@
+/**
+ *  @file cq_dma_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief DMA环形缓冲区(CQ_DMA_xx)测试，以软件模拟循环DMA的剩余计数与传输完成中断
+ *
+ *  @details 用法: cq_dma_test [种子] [每组次数]
+ *           1、节拍读取：环形区为每次读取量的4倍，写入量随时钟漂移抖动，数据不可丢失
+ *           2、停顿整圈：两次同步间恰好写满一圈，依靠圈数识别为溢出而非无数据
+ *           3、传输完成中断挂起：同步时写位置已回绕但中断未执行，不可重复计圈
+ *           4、随机写入量与中断延迟，可读长度不超过余量限制，读出数据连续且为最新
+ *           5、写入速率与节拍存在固定偏差(如I2S实际16.13kHz对8ms节拍)，每节拍读完全部
+ *              整块，积压有界且不溢出，不读取不足一块的数据
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define RING_SIZE           1024U
+#define TICK_READ           (RING_SIZE / 4U)    /**< 每节拍读取量*/
+#define READ_LIMIT          (RING_SIZE - (RING_SIZE >> CQ_DMA_GUARD_SHIFT))
+
+/** Private typedef ----------------------------------------------------------*/
+/*模拟DMA*/
+typedef struct
+{
+    volatile uint32_t ndtr;     /**< 剩余传输计数*/
+    uint32_t written;           /**< 累计写入点数*/
+    uint32_t pending_tc;        /**< 未执行的传输完成中断数*/
+}DMA_SimTypeDef;
+
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "cq_dma_test";
+static uint16_t Ring_Buf[RING_SIZE];
+static uint16_t Read_Buf[RING_SIZE];
+static CQ_DMA_handleTypeDef Dma_Ring;
+static DMA_SimTypeDef Dma;
+static uint32_t Rand_State;
+/*消费者已读取的绝对位置*/
+static uint32_t Read_Pos;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Dma_Write 模拟DMA写入，数据为绝对位置低16位]
+ * @param n     [写入点数]
+ * @param defer [true 传输完成中断挂起，由Dma_Fire_Tc执行]
+ * @param isr   [true 使用传输完成中断计圈]
+ */
+static void Dma_Write(uint32_t n, bool defer, bool isr)
+{
+    uint32_t pos = 0;
+
+    while(n-- > 0U)
+    {
+        pos = RING_SIZE - Dma.ndtr;
+        Ring_Buf[pos] = (uint16_t)Dma.written++;
+        if(--Dma.ndtr == 0U)
+        {
+            /*循环模式重装并产生传输完成中断*/
+            Dma.ndtr = RING_SIZE;
+            if(isr == false)
+            {
+                continue;
+            }
+            if(defer == true)
+            {
+                Dma.pending_tc++;
+            }
+            else
+            {
+                CQ_DMA_lapComplete(&Dma_Ring);
+            }
+        }
+    }
+}
+
+/**
+ * [Dma_Fire_Tc 执行挂起的传输完成中断]
+ */
+static void Dma_Fire_Tc(void)
+{
+    while(Dma.pending_tc > 0U)
+    {
+        Dma.pending_tc--;
+        CQ_DMA_lapComplete(&Dma_Ring);
+    }
+}
+
+/**
+ * [Setup 初始化并启动模拟DMA]
+ */
+static void Setup(void)
+{
+    memset(&Dma, 0, sizeof(Dma));
+    Read_Pos = 0;
+    /*DMA启动前NDTR为0*/
+    CQ_DMA_16_init(&Dma_Ring, Ring_Buf, RING_SIZE, &Dma.ndtr);
+    Dma.ndtr = RING_SIZE;
+}
+
+/**
+ * [Sync_And_Check 同步后检查可读长度，读出n点并校验连续]
+ * @param  n [期望读取点数，为0时读取全部]
+ * @return   [读取点数]
+ */
+static uint32_t Sync_And_Check(uint32_t n)
+{
+    uint32_t len = CQ_DMA_sync(&Dma_Ring);
+    uint32_t expect = GET_MIN(Dma.written - Read_Pos, READ_LIMIT);
+
+    TEST_CHECK(Test_Name, len == expect, "sync length %u expect %u (written %u read %u)", len, expect, Dma.written, Read_Pos);
+    /*溢出时跳过最旧数据*/
+    Read_Pos = Dma.written - len;
+    n = (n == 0U)?len:GET_MIN(n, len);
+    TEST_CHECK(Test_Name, CQ_16getData(&Dma_Ring.cq, Read_Buf, n) == n, "read %u", n);
+    for(uint32_t i = 0; i < n; i++)
+    {
+        TEST_CHECK(Test_Name, Read_Buf[i] == (uint16_t)(Read_Pos + i), "data[%u] %u expect %u", i, Read_Buf[i], (uint16_t)(Read_Pos + i));
+    }
+    Read_Pos += n;
+    return n;
+}
+
+/**
+ * [Test_Tick_Read 按节拍读取，写入量在每节拍读取量附近抖动]
+ * @param ticks [节拍数]
+ */
+static void Test_Tick_Read(uint32_t ticks)
+{
+    uint32_t reads = 0;
+    uint32_t drop = 0;
+
+    Setup();
+    for(uint32_t i = 0; i < ticks; i++)
+    {
+        Dma_Write(TICK_READ - 1U + Test_Rand_Range(&Rand_State, 3U), false, true);
+        if(CQ_DMA_sync(&Dma_Ring) >= TICK_READ)
+        {
+            TEST_CHECK(Test_Name, CQ_16getData(&Dma_Ring.cq, Read_Buf, TICK_READ) == TICK_READ, "tick read");
+            for(uint32_t k = 0; k < TICK_READ; k++)
+            {
+                TEST_CHECK(Test_Name, Read_Buf[k] == (uint16_t)(Read_Pos + k), "tick data[%u]", k);
+            }
+            Read_Pos += TICK_READ;
+            reads++;
+        }
+        /*漂移累积的余量由下一节拍读取，不可溢出*/
+        drop += (Dma.written - Read_Pos > READ_LIMIT)?1U:0U;
+    }
+    TEST_CHECK(Test_Name, drop == 0U, "tick overrun %u", drop);
+    TEST_CHECK(Test_Name, reads + 2U >= Dma.written / TICK_READ, "tick reads %u of %u", reads, Dma.written / TICK_READ);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"tick_read\",\"ring\":%u,\"tick_read\":%u,\"ticks\":%u,\"reads\":%u}\n",
+           Test_Name, RING_SIZE, TICK_READ, ticks, reads);
+}
+
+/**
+ * [Test_Rate_Mismatch 写入速率与读取节拍存在固定偏差，每节拍读完全部整块]
+ * @param ticks [节拍数]
+ * @param num   [写入速率分子]
+ * @param den   [写入速率分母，每节拍写入TICK_READ*num/den点]
+ */
+static void Test_Rate_Mismatch(uint32_t ticks, uint32_t num, uint32_t den)
+{
+    uint64_t acc = 0;
+    uint32_t n = 0;
+    uint32_t reads = 0;
+    uint32_t max_reads = 0;
+    uint32_t tick_reads = 0;
+    uint32_t max_backlog = 0;
+    uint32_t drop = 0;
+
+    Setup();
+    for(uint32_t i = 0; i < ticks; i++)
+    {
+        /*小数部分累积，另叠加±1抖动*/
+        acc += (uint64_t)TICK_READ * num;
+        n = (uint32_t)(acc / den);
+        acc %= den;
+        Dma_Write(n - 1U + Test_Rand_Range(&Rand_State, 3U), false, true);
+        drop += (Dma.written - Read_Pos > READ_LIMIT)?1U:0U;
+        tick_reads = 0;
+        while(CQ_DMA_sync(&Dma_Ring) >= TICK_READ)
+        {
+            TEST_CHECK(Test_Name, CQ_16getData(&Dma_Ring.cq, Read_Buf, TICK_READ) == TICK_READ, "rate read");
+            for(uint32_t k = 0; k < TICK_READ; k++)
+            {
+                TEST_CHECK(Test_Name, Read_Buf[k] == (uint16_t)(Read_Pos + k), "rate data[%u] %u expect %u",
+                           k, Read_Buf[k], (uint16_t)(Read_Pos + k));
+            }
+            Read_Pos += TICK_READ;
+            tick_reads++;
+        }
+        /*不足一块的数据留待下一节拍*/
+        TEST_CHECK(Test_Name, CQ_getLength(&Dma_Ring.cq) < TICK_READ, "rate residue %u", CQ_getLength(&Dma_Ring.cq));
+        reads += tick_reads;
+        max_reads = (tick_reads > max_reads)?tick_reads:max_reads;
+        max_backlog = (Dma.written - Read_Pos > max_backlog)?(Dma.written - Read_Pos):max_backlog;
+    }
+    TEST_CHECK(Test_Name, drop == 0U, "rate %u/%u overrun %u", num, den, drop);
+    TEST_CHECK(Test_Name, reads == Dma.written / TICK_READ, "rate reads %u of %u", reads, Dma.written / TICK_READ);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"rate_mismatch\",\"rate\":%.5f,\"ticks\":%u,\"reads\":%u,"
+           "\"max_reads_per_tick\":%u,\"max_backlog\":%u}\n",
+           Test_Name, (double)num / den, ticks, reads, max_reads, max_backlog);
+}
+
+/**
+ * [Test_Full_Lap 两次同步间恰好写满一圈，写位置不变]
+ */
+static void Test_Full_Lap(void)
+{
+    Setup();
+    Dma_Write(100, false, true);
+    Sync_And_Check(0);
+    /*写位置与上次同步相同，仅由圈数区分无数据与写满一圈*/
+    Dma_Write(RING_SIZE, false, true);
+    Sync_And_Check(0);
+
+    /*多圈*/
+    Dma_Write(RING_SIZE * 3U + 17U, false, true);
+    Sync_And_Check(0);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"full_lap\"}\n", Test_Name);
+}
+
+/**
+ * [Test_Pending_Tc 同步时传输完成中断挂起]
+ */
+static void Test_Pending_Tc(void)
+{
+    Setup();
+    Dma_Write(RING_SIZE - 10U, false, true);
+    Sync_And_Check(0);
+    /*回绕后中断未执行即同步*/
+    Dma_Write(30, true, true);
+    Sync_And_Check(0);
+    Dma_Fire_Tc();
+    Dma_Write(5, false, true);
+    Sync_And_Check(0);
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"pending_tc\"}\n", Test_Name);
+}
+
+/**
+ * [Test_Random 随机写入量、读取量与中断延迟]
+ * @param loops [次数]
+ * @param isr   [true 使用传输完成中断计圈]
+ */
+static void Test_Random(uint32_t loops, bool isr)
+{
+    uint32_t n = 0;
+    bool defer = false;
+
+    Setup();
+    for(uint32_t i = 0; i < loops; i++)
+    {
+        /*不使用中断计圈时同步间隔需小于一圈；中断挂起仅限本次写入回绕一次*/
+        n = Test_Rand_Range(&Rand_State, (isr == true)?(RING_SIZE * 3U):RING_SIZE);
+        defer = (isr == true && n < RING_SIZE && Test_Rand_Range(&Rand_State, 2U) == 0U);
+        Dma_Write(n, defer, isr);
+        Sync_And_Check(Test_Rand_Range(&Rand_State, RING_SIZE));
+        Dma_Fire_Tc();
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"random\",\"isr\":%s,\"loops\":%u,\"written\":%u}\n",
+           Test_Name, isr?"true":"false", loops, Dma.written);
+}
+
+/**
+ * [main 依次运行各组]
+ * @param  argc [参数个数]
+ * @param  argv [种子 每组次数]
+ * @return      [0 全部通过]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0xD3AU);
+    uint32_t loops = Test_Arg_U32(argc, argv, 2, 100000U);
+
+    Rand_State = (seed == 0U)?1U:seed;
+    Test_Tick_Read(loops);
+    /*I2S实际采样率高于、低于标称16kHz*/
+    Test_Rate_Mismatch(loops, 16129U, 16000U);
+    Test_Rate_Mismatch(loops, 15871U, 16000U);
+    Test_Full_Lap();
+    Test_Pending_Tc();
+    Test_Random(loops, true);
+    Test_Random(loops, false);
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,588 @@
+/**
+ *  @file cq_fuzz.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief CircularQueue差分模糊测试，随机操作序列与参考队列逐步比对
+ *
+ *  @details 用法: cq_fuzz [种子] [每组操作次数]
+ *           覆盖8/16/32bit读写、peek/consume、reserve/commit、手动偏移、帧头跳转、
+ *           交织/解交织及两种写满策略，每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define REF_CAPACITY        4096U   /**< 参考队列容量，不小于被测缓冲区*/
+#define MAX_CHANNEL         8U
+#define MAX_ELEMENTS        (REF_CAPACITY * 2U)
+
+/** Private typedef ----------------------------------------------------------*/
+/*参考队列，计数不回绕*/
+typedef struct
+{
+    uint32_t data[REF_CAPACITY];
+    uint64_t head;
+    uint64_t tail;
+    uint32_t size;
+    uint32_t frame_len;
+    uint32_t drop_count;
+    bool overwrite;
+}REF_QueueTypeDef;
+
+/*操作类型*/
+typedef enum
+{
+    OP_PUT = 0,
+    OP_GET,
+    OP_PEEK_CONSUME,
+    OP_RESERVE_COMMIT,
+    OP_OFFSET_INC,
+    OP_SKIP_HEADER,
+    OP_PUT_INTERLEAVED,
+    OP_GET_DEINTERLEAVED,
+    OP_NUM,
+}OP_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const char *const Op_Name[OP_NUM] = {"put", "get", "peek", "reserve", "offset", "skip", "interleave", "deinterleave"};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static REF_QueueTypeDef Ref;
+static uint32_t Rand_State;
+static uint32_t Shift;
+static const char *Test_Name = "cq_fuzz";
+static uint32_t Op_Count[OP_NUM];
+
+static uint32_t Ring_Buf[REF_CAPACITY];
+static uint32_t Src_Buf[MAX_ELEMENTS];
+static uint32_t Dst_Buf[MAX_ELEMENTS];
+static uint16_t Ch_Buf[MAX_CHANNEL][MAX_ELEMENTS];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Ref_Used 参考队列数据量]
+ * @return [元素个数]
+ */
+static inline uint32_t Ref_Used(void)
+{
+    return (uint32_t)(Ref.tail - Ref.head);
+}
+
+/**
+ * [Ref_At 参考队列出口后第index个元素]
+ * @param  index [偏移]
+ * @return       [元素]
+ */
+static inline uint32_t Ref_At(uint32_t index)
+{
+    return Ref.data[(Ref.head + index) % REF_CAPACITY];
+}
+
+/**
+ * [Ref_Push 参考队列写入]
+ * @param value [元素]
+ */
+static inline void Ref_Push(uint32_t value)
+{
+    Ref.data[Ref.tail % REF_CAPACITY] = value;
+    Ref.tail++;
+}
+
+/**
+ * [Ref_Make_Room 覆盖模式下按整帧丢弃最旧数据，对应CQ_Make_Room]
+ * @param len [期望写入元素个数]
+ */
+static void Ref_Make_Room(uint32_t len)
+{
+    uint32_t drop = 0;
+
+    if(Ref.overwrite == false || Ref.size - Ref_Used() >= len)
+    {
+        return;
+    }
+    drop = len - (Ref.size - Ref_Used());
+    drop = ((drop + Ref.frame_len - 1U) / Ref.frame_len) * Ref.frame_len;
+    drop = GET_MIN(drop, Ref_Used());
+    Ref.head += drop;
+    Ref.drop_count += drop;
+}
+
+/**
+ * [Rand_Value 生成一个元素，8bit时取值范围较小以便帧头匹配]
+ * @return [元素]
+ */
+static uint32_t Rand_Value(void)
+{
+    uint32_t value = Test_Rand(&Rand_State);
+
+    switch(Shift)
+    {
+        case 0:
+            return value % 8U;
+        case 1:
+            return value & 0xFFFFU;
+        default:
+            return value;
+    }
+}
+
+/**
+ * [Elem_Read 读取缓冲区元素]
+ * @param  base  [起始地址]
+ * @param  index [元素序号]
+ * @return       [元素]
+ */
+static uint32_t Elem_Read(const void *base, uint32_t index)
+{
+    switch(Shift)
+    {
+        case 0:
+            return ((const uint8_t *)base)[index];
+        case 1:
+            return ((const uint16_t *)base)[index];
+        default:
+            return ((const uint32_t *)base)[index];
+    }
+}
+
+/**
+ * [Elem_Write 写入缓冲区元素]
+ * @param base  [起始地址]
+ * @param index [元素序号]
+ * @param value [元素]
+ */
+static void Elem_Write(void *base, uint32_t index, uint32_t value)
+{
+    switch(Shift)
+    {
+        case 0:
+            ((uint8_t *)base)[index] = (uint8_t)value;
+            break;
+        case 1:
+            ((uint16_t *)base)[index] = (uint16_t)value;
+            break;
+        default:
+            ((uint32_t *)base)[index] = value;
+            break;
+    }
+}
+
+/**
+ * [Span_Read 读取连续段内第index个元素]
+ * @param  span  [内存段]
+ * @param  index [元素序号]
+ * @return       [元素]
+ */
+static uint32_t Span_Read(const CQ_SpanTypeDef *span, uint32_t index)
+{
+    if(index < span->first_len)
+    {
+        return Elem_Read(span->first, index);
+    }
+    return Elem_Read(span->second, index - span->first_len);
+}
+
+/**
+ * [Put_Data 按位宽调用CQ_xxputData]
+ */
+static uint32_t Put_Data(CQ_handleTypeDef *cq, uint32_t len)
+{
+    static uint8_t buf8[MAX_ELEMENTS];
+    static uint16_t buf16[MAX_ELEMENTS];
+
+    switch(Shift)
+    {
+        case 0:
+            for(uint32_t i = 0; i < len; i++)
+            {
+                buf8[i] = (uint8_t)Src_Buf[i];
+            }
+            return CQ_putData(cq, buf8, len);
+        case 1:
+            for(uint32_t i = 0; i < len; i++)
+            {
+                buf16[i] = (uint16_t)Src_Buf[i];
+            }
+            return CQ_16putData(cq, buf16, len);
+        default:
+            return CQ_32putData(cq, Src_Buf, len);
+    }
+}
+
+/**
+ * [Get_Data 按位宽调用CQ_xxgetData，结果转存至Dst_Buf]
+ */
+static uint32_t Get_Data(CQ_handleTypeDef *cq, uint32_t len)
+{
+    static uint8_t buf8[MAX_ELEMENTS];
+    static uint16_t buf16[MAX_ELEMENTS];
+    uint32_t n = 0;
+
+    switch(Shift)
+    {
+        case 0:
+            n = CQ_getData(cq, buf8, len);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                Dst_Buf[i] = buf8[i];
+            }
+            return n;
+        case 1:
+            n = CQ_16getData(cq, buf16, len);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                Dst_Buf[i] = buf16[i];
+            }
+            return n;
+        default:
+            return CQ_32getData(cq, Dst_Buf, len);
+    }
+}
+
+/**
+ * [Peek_Read 按位宽调用CQ_xx_peekRead]
+ */
+static uint32_t Peek_Read(CQ_handleTypeDef *cq, uint32_t len, CQ_SpanTypeDef *span)
+{
+    switch(Shift)
+    {
+        case 0:
+            return CQ_peekRead(cq, len, span);
+        case 1:
+            return CQ_16_peekRead(cq, len, span);
+        default:
+            return CQ_32_peekRead(cq, len, span);
+    }
+}
+
+/**
+ * [Reserve_Write 按位宽调用CQ_xx_reserveWrite]
+ */
+static uint32_t Reserve_Write(CQ_handleTypeDef *cq, uint32_t len, CQ_SpanTypeDef *span)
+{
+    switch(Shift)
+    {
+        case 0:
+            return CQ_reserveWrite(cq, len, span);
+        case 1:
+            return CQ_16_reserveWrite(cq, len, span);
+        default:
+            return CQ_32_reserveWrite(cq, len, span);
+    }
+}
+
+/**
+ * [Do_Op 执行一次随机操作并与参考队列比对]
+ * @param cq [被测缓冲区]
+ * @param op [操作类型]
+ */
+static void Do_Op(CQ_handleTypeDef *cq, OP_TypeDef op)
+{
+    CQ_SpanTypeDef Span;
+    const uint16_t *src_ch[MAX_CHANNEL];
+    uint16_t *dst_ch[MAX_CHANNEL];
+    uint32_t len = Test_Rand_Range(&Rand_State, Ref.size + Ref.size / 2U + 2U);
+    uint32_t expect = 0;
+    uint32_t n = 0;
+    uint32_t k = 0;
+    uint32_t skip = 0;
+    uint32_t ch_num = 0;
+    uint32_t stride = 0;
+    uint32_t frames = 0;
+    uint8_t pattern[2];
+
+    switch(op)
+    {
+        case OP_PUT:
+            for(uint32_t i = 0; i < len; i++)
+            {
+                Src_Buf[i] = Rand_Value();
+            }
+            n = Put_Data(cq, len);
+            /*覆盖模式超出缓冲区时只保留最新数据*/
+            if(Ref.overwrite == true && len > Ref.size)
+            {
+                skip = len - Ref.size;
+                Ref.drop_count += skip;
+                len = Ref.size;
+            }
+            Ref_Make_Room(len);
+            expect = GET_MIN(len, Ref.size - Ref_Used());
+            for(uint32_t i = 0; i < expect; i++)
+            {
+                Ref_Push(Src_Buf[skip + i]);
+            }
+            TEST_CHECK(Test_Name, n == expect, "put returned %u expect %u", n, expect);
+            break;
+
+        case OP_GET:
+            n = Get_Data(cq, len);
+            expect = GET_MIN(len, Ref_Used());
+            TEST_CHECK(Test_Name, n == expect, "get returned %u expect %u", n, expect);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                TEST_CHECK(Test_Name, Dst_Buf[i] == Ref_At(i), "get data[%u] %u expect %u", i, Dst_Buf[i], Ref_At(i));
+            }
+            Ref.head += n;
+            break;
+
+        case OP_PEEK_CONSUME:
+            n = Peek_Read(cq, len, &Span);
+            expect = GET_MIN(len, Ref_Used());
+            TEST_CHECK(Test_Name, n == expect, "peek returned %u expect %u", n, expect);
+            TEST_CHECK(Test_Name, Span.first_len + Span.second_len == n, "peek span %u+%u", Span.first_len, Span.second_len);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                TEST_CHECK(Test_Name, Span_Read(&Span, i) == Ref_At(i), "peek data[%u]", i);
+            }
+            k = Test_Rand_Range(&Rand_State, n + 1U);
+            CQ_consumeRead(cq, k);
+            Ref.head += k;
+            break;
+
+        case OP_RESERVE_COMMIT:
+            n = Reserve_Write(cq, len, &Span);
+            if(Ref.overwrite == true)
+            {
+                len = GET_MIN(len, Ref.size);
+            }
+            Ref_Make_Room(len);
+            expect = GET_MIN(len, Ref.size - Ref_Used());
+            TEST_CHECK(Test_Name, n == expect, "reserve returned %u expect %u", n, expect);
+            TEST_CHECK(Test_Name, Span.first_len + Span.second_len == n, "reserve span %u+%u", Span.first_len, Span.second_len);
+            k = Test_Rand_Range(&Rand_State, n + 1U);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                Src_Buf[i] = Rand_Value();
+                if(i < Span.first_len)
+                {
+                    Elem_Write(Span.first, i, Src_Buf[i]);
+                }
+                else
+                {
+                    Elem_Write(Span.second, i - Span.first_len, Src_Buf[i]);
+                }
+            }
+            CQ_commitWrite(cq, k);
+            for(uint32_t i = 0; i < k; i++)
+            {
+                Ref_Push(Src_Buf[i]);
+            }
+            break;
+
+        case OP_OFFSET_INC:
+            k = Test_Rand_Range(&Rand_State, Ref_Used() + 4U);
+            CQ_ManualOffsetInc(cq, k);
+            Ref.head += GET_MIN(k, Ref_Used());
+            break;
+
+        case OP_SKIP_HEADER:
+            /*仅8bit缓冲区按字节查找帧头*/
+            if(Shift != 0U)
+            {
+                break;
+            }
+            pattern[0] = (uint8_t)Rand_Value();
+            pattern[1] = (uint8_t)Rand_Value();
+            n = CQ_skipInvaildU16Header(cq, (uint16_t)(pattern[0] | ((uint16_t)pattern[1] << 8)));
+            len = Ref_Used();
+            if(len < 2U)
+            {
+                TEST_CHECK(Test_Name, n == 0U, "skip short returned %u", n);
+                break;
+            }
+            for(k = 0; k + 2U <= len; k++)
+            {
+                if(Ref_At(k) == pattern[0] && Ref_At(k + 1U) == pattern[1])
+                {
+                    break;
+                }
+            }
+            /*未找到时保留最后一个字节*/
+            Ref.head += (k + 2U <= len)?k:(len - 1U);
+            expect = (k + 2U <= len)?Ref_Used():0U;
+            TEST_CHECK(Test_Name, n == expect, "skip returned %u expect %u", n, expect);
+            break;
+
+        case OP_PUT_INTERLEAVED:
+            if(Shift != 1U)
+            {
+                break;
+            }
+            ch_num = 1U + Test_Rand_Range(&Rand_State, MAX_CHANNEL);
+            stride = 1U + Test_Rand_Range(&Rand_State, 2U);
+            frames = Test_Rand_Range(&Rand_State, (Ref.size + Ref.size / 2U) / ch_num + 2U);
+            for(uint32_t ch = 0; ch < ch_num; ch++)
+            {
+                for(uint32_t i = 0; i < frames * stride; i++)
+                {
+                    Ch_Buf[ch][i] = (uint16_t)Rand_Value();
+                }
+                src_ch[ch] = Ch_Buf[ch];
+            }
+            n = CQ_16putInterleaved(cq, src_ch, ch_num, stride, frames);
+            /*对应CQ_Reserve_Elements后取整帧*/
+            len = frames * ch_num;
+            if(Ref.overwrite == true)
+            {
+                len = GET_MIN(len, Ref.size);
+            }
+            Ref_Make_Room(len);
+            expect = GET_MIN(len, Ref.size - Ref_Used()) / ch_num;
+            TEST_CHECK(Test_Name, n == expect, "interleave returned %u expect %u (ch %u frames %u)", n, expect, ch_num, frames);
+            skip = 0;
+            if(Ref.overwrite == true && expect < frames)
+            {
+                skip = frames - expect;
+                Ref.drop_count += skip * ch_num;
+            }
+            /*丢弃最新时保留前expect帧，覆盖时保留后expect帧*/
+            for(uint32_t f = skip; f < skip + expect; f++)
+            {
+                for(uint32_t ch = 0; ch < ch_num; ch++)
+                {
+                    Ref_Push(Ch_Buf[ch][f * stride]);
+                }
+            }
+            break;
+
+        case OP_GET_DEINTERLEAVED:
+            if(Shift != 1U)
+            {
+                break;
+            }
+            ch_num = 1U + Test_Rand_Range(&Rand_State, MAX_CHANNEL);
+            stride = 1U + Test_Rand_Range(&Rand_State, 2U);
+            frames = Test_Rand_Range(&Rand_State, Ref.size / ch_num + 2U);
+            for(uint32_t ch = 0; ch < ch_num; ch++)
+            {
+                /*随机丢弃部分通道*/
+                dst_ch[ch] = (Test_Rand_Range(&Rand_State, 4U) == 0U)?NULL:Ch_Buf[ch];
+            }
+            n = CQ_16getDeinterleaved(cq, dst_ch, ch_num, stride, frames);
+            expect = GET_MIN(frames, Ref_Used() / ch_num);
+            TEST_CHECK(Test_Name, n == expect, "deinterleave returned %u expect %u", n, expect);
+            for(uint32_t f = 0; f < n; f++)
+            {
+                for(uint32_t ch = 0; ch < ch_num; ch++)
+                {
+                    if(dst_ch[ch] != NULL)
+                    {
+                        TEST_CHECK(Test_Name, dst_ch[ch][f * stride] == Ref_At(f * ch_num + ch), "deinterleave frame %u ch %u", f, ch);
+                    }
+                }
+            }
+            Ref.head += n * ch_num;
+            break;
+
+        default:
+            break;
+    }
+    Op_Count[op]++;
+
+    TEST_CHECK(Test_Name, CQ_getLength(cq) == Ref_Used(), "%s: length %u expect %u", Op_Name[op], CQ_getLength(cq), Ref_Used());
+    TEST_CHECK(Test_Name, CQ_getDropCount(cq) == Ref.drop_count, "%s: drop %u expect %u", Op_Name[op], CQ_getDropCount(cq), Ref.drop_count);
+}
+
+/**
+ * [Run_Case 运行一组模糊测试]
+ * @param shift     [元素字节数左移位数]
+ * @param size      [缓冲区大小]
+ * @param overwrite [true 覆盖模式]
+ * @param frame_len [覆盖模式丢弃单位]
+ * @param ops       [操作次数]
+ */
+static void Run_Case(uint32_t shift, uint32_t size, bool overwrite, uint32_t frame_len, uint32_t ops)
+{
+    CQ_handleTypeDef cq;
+    uint64_t start = 0;
+    bool ret = false;
+
+    Shift = shift;
+    switch(shift)
+    {
+        case 0:
+            ret = CQ_init(&cq, (uint8_t *)Ring_Buf, size);
+            break;
+        case 1:
+            ret = CQ_16_init(&cq, (uint16_t *)Ring_Buf, size);
+            break;
+        default:
+            ret = CQ_32_init(&cq, Ring_Buf, size);
+            break;
+    }
+    TEST_CHECK(Test_Name, ret == true, "init size %u", size);
+    if(overwrite == true)
+    {
+        ret = CQ_setPolicy(&cq, CQ_POLICY_OVERWRITE_OLDEST, frame_len);
+        TEST_CHECK(Test_Name, ret == true, "policy frame_len %u", frame_len);
+    }
+    /*索引起点靠近回绕处，覆盖32位计数溢出*/
+    cq.entrance = cq.exit = 0xFFFFFFFFU - size * 3U;
+
+    memset(&Ref, 0, sizeof(Ref));
+    Ref.size = size;
+    Ref.overwrite = overwrite;
+    Ref.frame_len = frame_len;
+    memset(Op_Count, 0, sizeof(Op_Count));
+
+    start = Test_Now_Ns();
+    for(uint32_t i = 0; i < ops; i++)
+    {
+        Do_Op(&cq, (OP_TypeDef)Test_Rand_Range(&Rand_State, OP_NUM));
+    }
+
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"bits\":%u,\"size\":%u,\"policy\":\"%s\",\"frame_len\":%u,\"ops\":%u,"
+           "\"drop\":%u,\"elapsed_ms\":%.3f,\"op_count\":{",
+           Test_Name, 8U << shift, size, overwrite?"overwrite":"drop_newest", frame_len, ops,
+           Ref.drop_count, (double)(Test_Now_Ns() - start) / 1e6);
+    for(uint32_t op = 0; op < OP_NUM; op++)
+    {
+        printf("%s\"%s\":%u", (op == 0U)?"":",", Op_Name[op], Op_Count[op]);
+    }
+    printf("}}\n");
+}
+
+/**
+ * [main 依次运行各位宽、大小与策略组合]
+ * @param  argc [参数个数]
+ * @param  argv [种子 每组操作次数]
+ * @return      [0 全部通过]
+ */
+int main(int argc, char **argv)
+{
+    static const uint32_t Size_Table[] = {1, 2, 16, 256, 1024};
+    static const uint32_t Frame_Table[] = {1, 3, 4};
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x5EEDU);
+    uint32_t ops = Test_Arg_U32(argc, argv, 2, 20000U);
+
+    Rand_State = (seed == 0U)?1U:seed;
+    for(uint32_t shift = 0; shift < 3U; shift++)
+    {
+        for(uint32_t s = 0; s < sizeof(Size_Table) / sizeof(Size_Table[0]); s++)
+        {
+            Run_Case(shift, Size_Table[s], false, 1, ops);
+            for(uint32_t f = 0; f < sizeof(Frame_Table) / sizeof(Frame_Table[0]); f++)
+            {
+                /*丢弃单位不可大于缓冲区*/
+                if(Frame_Table[f] > Size_Table[s])
+                {
+                    continue;
+                }
+                Run_Case(shift, Size_Table[s], true, Frame_Table[f], ops);
+            }
+        }
+    }
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,245 @@
+/**
+ *  @file cq_skip_bench.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 帧头跳转(CQ_skipInvaildXXHeader)重同步耗时，与原逐字节查找对比
+ *
+ *  @details 用法: cq_skip_bench [重复次数]
+ *           缓冲区内为4KB无效数据+帧头+数据，起始位置靠近末尾使查找跨越回绕处；
+ *           另测全部为无效数据(找不到帧头)的情况。两种实现结果需一致，
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define RING_SIZE           CQ_BUF_8KB
+#define GARBAGE_LEN         4096U
+#define PAYLOAD_LEN         64U
+#define START_OFFSET        (RING_SIZE - 1000U)  /**< 查找过程跨越回绕处*/
+
+/** Private typedef ----------------------------------------------------------*/
+/*帧头类型*/
+typedef enum
+{
+    HEADER_U8 = 0,
+    HEADER_U16,
+    HEADER_U32,
+    HEADER_MODBUS_U16,
+    HEADER_MODBUS_U32,
+    HEADER_NUM,
+}HEADER_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const char *const Header_Name[HEADER_NUM] = {"u8", "u16", "u32", "modbus_u16", "modbus_u32"};
+/*帧头字节序列(缓冲区内顺序)*/
+static const uint8_t Header_Bytes[4] = {0xA5, 0x5A, 0xC3, 0x3C};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "cq_skip_bench";
+static uint8_t Ring_Buf[RING_SIZE];
+static uint8_t Frame_Buf[GARBAGE_LEN + 4U + PAYLOAD_LEN];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Legacy_Skip 原逐字节查找实现，每次读取帧头长度个字节比较，不匹配时出口加一]
+ * @param  cb     [环形缓冲区句柄]
+ * @param  type   [帧头类型]
+ * @param  header [帧头]
+ * @return        [找到时返回缓冲区可读长度，否则返回0]
+ */
+static uint32_t Legacy_Skip(CQ_handleTypeDef *cb, HEADER_TypeDef type, uint32_t header)
+{
+    uint32_t value = 0;
+    uint32_t len = (type == HEADER_U8)?1U:((type == HEADER_U16 || type == HEADER_MODBUS_U16)?2U:4U);
+
+    while(CQ_getLength(cb) >= len)
+    {
+        switch(type)
+        {
+            case HEADER_U8:
+                value = CQ_ManualGet_Offset_Data(cb, 0);
+                break;
+            case HEADER_U16:
+                value = CQ_ManualGet_Offset_Data(cb, 0);
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 1)) << 8;
+                break;
+            case HEADER_U32:
+                value = CQ_ManualGet_Offset_Data(cb, 0);
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 1)) << 8;
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 2)) << 16;
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 3)) << 24;
+                break;
+            case HEADER_MODBUS_U16:
+                value = ((uint32_t)CQ_ManualGet_Offset_Data(cb, 0)) << 8;
+                value |= CQ_ManualGet_Offset_Data(cb, 1);
+                break;
+            default:
+                value = ((uint32_t)CQ_ManualGet_Offset_Data(cb, 0)) << 24;
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 1)) << 16;
+                value |= ((uint32_t)CQ_ManualGet_Offset_Data(cb, 2)) << 8;
+                value |= CQ_ManualGet_Offset_Data(cb, 3);
+                break;
+        }
+        if(value != header)
+        {
+            CQ_ManualOffsetInc(cb, 1);
+        }
+        else
+        {
+            return CQ_getLength(cb);
+        }
+    }
+    return 0;
+}
+
+/**
+ * [Current_Skip 当前实现]
+ * @param  cb     [环形缓冲区句柄]
+ * @param  type   [帧头类型]
+ * @param  header [帧头]
+ * @return        [找到时返回缓冲区可读长度，否则返回0]
+ */
+static uint32_t Current_Skip(CQ_handleTypeDef *cb, HEADER_TypeDef type, uint32_t header)
+{
+    switch(type)
+    {
+        case HEADER_U8:
+            return CQ_skipInvaildU8Header(cb, (uint8_t)header);
+        case HEADER_U16:
+            return CQ_skipInvaildU16Header(cb, (uint16_t)header);
+        case HEADER_U32:
+            return CQ_skipInvaildU32Header(cb, header);
+        case HEADER_MODBUS_U16:
+            return CQ_skipInvaildModbusU16Header(cb, (uint16_t)header);
+        default:
+            return CQ_skipInvaildModbusU32Header(cb, header);
+    }
+}
+
+/**
+ * [Header_Value 帧头字节序列对应的帧头参数]
+ * @param  type [帧头类型]
+ * @return      [帧头]
+ */
+static uint32_t Header_Value(HEADER_TypeDef type)
+{
+    const uint8_t *b = Header_Bytes;
+
+    switch(type)
+    {
+        case HEADER_U8:
+            return b[0];
+        case HEADER_U16:
+            return b[0] | ((uint32_t)b[1] << 8);
+        case HEADER_U32:
+            return b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+        case HEADER_MODBUS_U16:
+            return ((uint32_t)b[0] << 8) | b[1];
+        default:
+            return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | b[3];
+    }
+}
+
+/**
+ * [Fill_Ring 复位缓冲区并写入一帧测试数据]
+ * @param cb  [环形缓冲区句柄]
+ * @param len [写入长度]
+ */
+static void Fill_Ring(CQ_handleTypeDef *cb, uint32_t len)
+{
+    CQ_init(cb, Ring_Buf, RING_SIZE);
+    cb->entrance = cb->exit = START_OFFSET;
+    CQ_putData(cb, Frame_Buf, len);
+}
+
+/**
+ * [Bench_Case 一组耗时对比]
+ * @param type  [帧头类型]
+ * @param found [true 无效数据后有帧头]
+ * @param loops [重复次数]
+ */
+static void Bench_Case(HEADER_TypeDef type, bool found, uint32_t loops)
+{
+    CQ_handleTypeDef cq;
+    uint32_t header = Header_Value(type);
+    uint32_t hlen = (type == HEADER_U8)?1U:((type == HEADER_U16 || type == HEADER_MODBUS_U16)?2U:4U);
+    uint32_t total = found?(GARBAGE_LEN + hlen + PAYLOAD_LEN):GARBAGE_LEN;
+    uint32_t legacy_ret = 0;
+    uint32_t legacy_left = 0;
+    uint32_t current_ret = 0;
+    uint32_t current_left = 0;
+    uint64_t legacy_ns = 0;
+    uint64_t current_ns = 0;
+    uint64_t start = 0;
+
+    /*帧头紧随无效数据，其后为数据区*/
+    memcpy(Frame_Buf + GARBAGE_LEN, Header_Bytes, hlen);
+
+    for(uint32_t i = 0; i < loops; i++)
+    {
+        Fill_Ring(&cq, total);
+        start = Test_Now_Ns();
+        legacy_ret = Legacy_Skip(&cq, type, header);
+        legacy_ns += Test_Now_Ns() - start;
+        legacy_left = CQ_getLength(&cq);
+
+        Fill_Ring(&cq, total);
+        start = Test_Now_Ns();
+        current_ret = Current_Skip(&cq, type, header);
+        current_ns += Test_Now_Ns() - start;
+        current_left = CQ_getLength(&cq);
+
+        TEST_CHECK(Test_Name, legacy_ret == current_ret && legacy_left == current_left,
+                   "%s: legacy %u/%u current %u/%u", Header_Name[type], legacy_ret, legacy_left, current_ret, current_left);
+    }
+    if(found == true)
+    {
+        TEST_CHECK(Test_Name, current_ret == hlen + PAYLOAD_LEN, "%s: returned %u", Header_Name[type], current_ret);
+    }
+
+    printf("{\"bench\":\"skip_header\",\"header\":\"%s\",\"found\":%s,\"garbage_bytes\":%u,\"wrap\":true,\"loops\":%u,"
+           "\"legacy_ns\":%.1f,\"current_ns\":%.1f,\"legacy_ns_per_byte\":%.3f,\"current_ns_per_byte\":%.3f,\"speedup\":%.1f}\n",
+           Header_Name[type], found?"true":"false", GARBAGE_LEN, loops,
+           (double)legacy_ns / loops, (double)current_ns / loops,
+           (double)legacy_ns / loops / GARBAGE_LEN, (double)current_ns / loops / GARBAGE_LEN,
+           (double)legacy_ns / (double)current_ns);
+}
+
+/**
+ * [main 依次运行各帧头类型]
+ * @param  argc [参数个数]
+ * @param  argv [重复次数]
+ * @return      [0 结果一致]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t loops = Test_Arg_U32(argc, argv, 1, 2000U);
+    uint32_t state = 0x1234U;
+
+    /*无效数据不含帧头首字节，但含其余帧头字节以触发部分匹配*/
+    for(uint32_t i = 0; i < sizeof(Frame_Buf); i++)
+    {
+        do
+        {
+            Frame_Buf[i] = (uint8_t)Test_Rand(&state);
+        }while(Frame_Buf[i] == Header_Bytes[0]);
+    }
+    for(uint32_t type = 0; type < HEADER_NUM; type++)
+    {
+        Bench_Case((HEADER_TypeDef)type, true, loops);
+        Bench_Case((HEADER_TypeDef)type, false, loops);
+    }
+    return 0;
+}
+/******************************** End of file *********************************/
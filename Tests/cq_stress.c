@@ -0,0 +1,225 @@
+/**
+ *  @file cq_stress.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief CircularQueue双线程压力测试，校验索引发布顺序与覆盖模式出口比较交换
+ *
+ *  @details 用法: cq_stress [每组元素总数]
+ *           生产者、消费者各占一个线程，写入连续序号并在消费端逐个校验：
+ *           1、put/get：数据不可丢失、重复或乱序
+ *           2、reserve/commit + peek/consume：零拷贝路径同上
+ *           3、覆盖模式：单次读出的数据必须连续未被撕裂，跨次读取序号递增，
+ *              读出与丢弃之和等于写入总数
+ *           主机端屏障与比较交换由__atomic实现，与目标端__DMB/LDREX-STREX对应，
+ *           屏障缺失或顺序错误时在多核主机上可复现为序号错误
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <pthread.h>
+#include <sched.h>
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define RING_SIZE           1024U
+#define MAX_CHUNK           131U
+#define FRAME_LEN           4U
+
+/** Private typedef ----------------------------------------------------------*/
+/*测试模式*/
+typedef enum
+{
+    STRESS_PUT_GET = 0,
+    STRESS_ZERO_COPY,
+    STRESS_OVERWRITE,
+}STRESS_MODE_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const char *const Mode_Name[] = {"put_get", "zero_copy", "overwrite"};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "cq_stress";
+static uint32_t Ring_Buf[RING_SIZE];
+static CQ_handleTypeDef Cq;
+static STRESS_MODE_TypeDef Mode;
+static uint32_t Total;
+static volatile bool Producer_Done;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Span_Elem 连续段内第index个32bit元素地址]
+ */
+static inline uint32_t *Span_Elem(const CQ_SpanTypeDef *span, uint32_t index)
+{
+    if(index < span->first_len)
+    {
+        return (uint32_t *)span->first + index;
+    }
+    return (uint32_t *)span->second + (index - span->first_len);
+}
+
+/**
+ * [Producer_Thread 生产者，写入连续序号，单次长度变化以覆盖各种回绕位置]
+ * @param  arg [未使用]
+ * @return     [NULL]
+ */
+static void *Producer_Thread(void *arg)
+{
+    CQ_SpanTypeDef Span;
+    uint32_t buf[MAX_CHUNK];
+    uint32_t seq = 0;
+    uint32_t n = 0;
+    uint32_t len = 0;
+
+    (void)arg;
+    while(seq < Total)
+    {
+        len = GET_MIN((seq * 7U) % 97U + 1U, Total - seq);
+        /*覆盖模式按整帧写入*/
+        if(Mode == STRESS_OVERWRITE)
+        {
+            len = FRAME_LEN;
+        }
+        if(Mode == STRESS_ZERO_COPY)
+        {
+            n = CQ_32_reserveWrite(&Cq, len, &Span);
+            for(uint32_t i = 0; i < n; i++)
+            {
+                *Span_Elem(&Span, i) = seq + i;
+            }
+            CQ_commitWrite(&Cq, n);
+        }
+        else
+        {
+            for(uint32_t i = 0; i < len; i++)
+            {
+                buf[i] = seq + i;
+            }
+            n = CQ_32putData(&Cq, buf, len);
+        }
+        seq += n;
+        /*单核主机上让出CPU，避免空转到时间片结束*/
+        if(n == 0U)
+        {
+            sched_yield();
+        }
+    }
+    Producer_Done = true;
+    return NULL;
+}
+
+/**
+ * [Run_Mode 运行一组压力测试]
+ * @param mode [测试模式]
+ */
+static void Run_Mode(STRESS_MODE_TypeDef mode)
+{
+    CQ_SpanTypeDef Span;
+    pthread_t producer;
+    uint32_t buf[MAX_CHUNK];
+    uint32_t expect = 0;
+    uint32_t received = 0;
+    uint32_t reads = 0;
+    uint32_t n = 0;
+    uint32_t want = 1;
+    bool done = false;
+    uint64_t start = 0;
+    uint64_t ns = 0;
+
+    Mode = mode;
+    Producer_Done = false;
+    CQ_32_init(&Cq, Ring_Buf, RING_SIZE);
+    if(mode == STRESS_OVERWRITE)
+    {
+        CQ_setPolicy(&Cq, CQ_POLICY_OVERWRITE_OLDEST, FRAME_LEN);
+    }
+
+    start = Test_Now_Ns();
+    TEST_CHECK(Test_Name, pthread_create(&producer, NULL, Producer_Thread, NULL) == 0, "pthread_create");
+    while(done == false)
+    {
+        /*先取完成标志再读，保证读空后不再有新数据*/
+        done = Producer_Done;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        want = want % MAX_CHUNK + 1U;
+        do
+        {
+            if(mode == STRESS_ZERO_COPY)
+            {
+                n = CQ_32_peekRead(&Cq, want, &Span);
+                for(uint32_t i = 0; i < n; i++)
+                {
+                    TEST_CHECK(Test_Name, *Span_Elem(&Span, i) == expect + i, "%s: seq %u expect %u",
+                               Mode_Name[mode], *Span_Elem(&Span, i), expect + i);
+                }
+                CQ_consumeRead(&Cq, n);
+            }
+            else
+            {
+                n = CQ_32getData(&Cq, buf, want);
+                if(mode == STRESS_OVERWRITE && n > 0U)
+                {
+                    /*被覆盖的数据跳过，但单次读出必须连续*/
+                    TEST_CHECK(Test_Name, buf[0] >= expect, "%s: seq %u went back from %u", Mode_Name[mode], buf[0], expect);
+                    expect = buf[0];
+                }
+                for(uint32_t i = 0; i < n; i++)
+                {
+                    TEST_CHECK(Test_Name, buf[i] == expect + i, "%s: seq %u expect %u", Mode_Name[mode], buf[i], expect + i);
+                }
+            }
+            expect += n;
+            received += n;
+            reads += (n > 0U)?1U:0U;
+        }while(done == true && n > 0U);
+        if(n == 0U)
+        {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    ns = Test_Now_Ns() - start;
+
+    if(mode == STRESS_OVERWRITE)
+    {
+        TEST_CHECK(Test_Name, received + CQ_getDropCount(&Cq) == Total, "%s: received %u + drop %u != %u",
+                   Mode_Name[mode], received, CQ_getDropCount(&Cq), Total);
+        TEST_CHECK(Test_Name, expect == Total, "%s: last seq %u expect %u", Mode_Name[mode], expect, Total);
+    }
+    else
+    {
+        TEST_CHECK(Test_Name, received == Total, "%s: received %u expect %u", Mode_Name[mode], received, Total);
+    }
+
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"mode\":\"%s\",\"size\":%u,\"elements\":%u,\"received\":%u,"
+           "\"drop\":%u,\"reads\":%u,\"elapsed_ms\":%.3f,\"melem_per_s\":%.2f}\n",
+           Test_Name, Mode_Name[mode], RING_SIZE, Total, received, CQ_getDropCount(&Cq), reads,
+           (double)ns / 1e6, (double)Total * 1e3 / ns);
+}
+
+/**
+ * [main 依次运行各模式]
+ * @param  argc [参数个数]
+ * @param  argv [每组元素总数]
+ * @return      [0 全部通过]
+ */
+int main(int argc, char **argv)
+{
+    Total = Test_Arg_U32(argc, argv, 1, 20000000U);
+    /*覆盖模式按整帧写入*/
+    Total -= Total % FRAME_LEN;
+
+    Run_Mode(STRESS_PUT_GET);
+    Run_Mode(STRESS_ZERO_COPY);
+    Run_Mode(STRESS_OVERWRITE);
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,236 @@
+/**
+ *  @file interleave_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 调试通道交织写入等价性测试：CQ_16putInterleaved与原va_arg逐点交织结果比对
+ *
+ *  @details 用法: interleave_test [种子] [每组随机次数]
+ *           Audio_Debug_Put_Channel_Data以CQ_16putInterleaved(stride 1)直接写入环形区，
+ *           原Audio_Debug_Put_Data为左右声道+va_arg附加通道逐点拷贝到临时区再CQ_16putData。
+ *           覆盖2-8通道、奇数帧数、非对齐起始与回绕，两种写满策略，比对返回值、长度、
+ *           丢弃数及缓冲区全部内容
+ *
+ *           原实现中switch按附加通道数选择分支，总通道数2时写入0、3时写入左声道两次，
+ *           参考实现按其通用分支(左、右、附加通道依次写入)，即上位机期望的格式
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <stdarg.h>
+#include "CircularQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define RING_SIZE           CQ_BUF_2KB  /**< 与调试通道环形区大小一致*/
+#define MONO_FRAME_SIZE     128U        /**< 与调试通道每帧点数一致*/
+#define MAX_CHANNEL         8U
+#define MAX_FRAMES          (MONO_FRAME_SIZE * 2U + 1U)
+
+/** Private typedef ----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+static const uint32_t Frames_Table[] = {1, 2, 3, 63, 127, MONO_FRAME_SIZE, 129, 255};
+static const uint32_t Offset_Table[] = {0, 1, 3, RING_SIZE / 2U - 1U, RING_SIZE - 7U, RING_SIZE - 1U};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "interleave_test";
+static uint32_t Rand_State;
+static int16_t Ch_Buf[MAX_CHANNEL][MAX_FRAMES];
+static uint16_t Ref_Ring[RING_SIZE];
+static uint16_t New_Ring[RING_SIZE];
+static uint16_t Ref_Out[RING_SIZE];
+static uint16_t New_Out[RING_SIZE];
+static uint16_t Prefill_Buf[RING_SIZE];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Legacy_Put_Data 原va_arg交织实现(通用分支)，帧数参数化]
+ * @param cq             [环形缓冲区句柄]
+ * @param frames         [帧数，原实现固定为MONO_FRAME_SIZE]
+ * @param Left           [左声道]
+ * @param Right          [右声道]
+ * @param Channel_Number [附加通道数]
+ * @return               [写入元素个数]
+ */
+static uint32_t Legacy_Put_Data(CQ_handleTypeDef *cq, uint32_t frames, const int16_t *Left, const int16_t *Right, uint8_t Channel_Number, ...)
+{
+    static int16_t Audio_Data[MAX_CHANNEL * MAX_FRAMES];
+    va_list args;
+    uint32_t index = 0;
+
+    for(uint32_t i = 0; i < frames; i++)
+    {
+        Audio_Data[index++] = Left[i];
+        Audio_Data[index++] = Right[i];
+
+        va_start(args, Channel_Number);
+        for(uint8_t Channel_Index = 0; Channel_Index < Channel_Number; Channel_Index++)
+        {
+            Audio_Data[index++] = (va_arg(args, int16_t *))[i];
+        }
+        va_end(args);
+    }
+    return CQ_16putData(cq, (const uint16_t *)Audio_Data, (2U + Channel_Number) * frames);
+}
+
+/**
+ * [Legacy_Put 按通道总数展开可变参数调用原实现]
+ * @param cq       [环形缓冲区句柄]
+ * @param ch_total [通道总数，2-8]
+ * @param frames   [帧数]
+ * @return         [写入元素个数]
+ */
+static uint32_t Legacy_Put(CQ_handleTypeDef *cq, uint32_t ch_total, uint32_t frames)
+{
+    int16_t *c[MAX_CHANNEL];
+
+    for(uint32_t ch = 0; ch < MAX_CHANNEL; ch++)
+    {
+        c[ch] = Ch_Buf[ch];
+    }
+    switch(ch_total)
+    {
+        case 2:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 0);
+        case 3:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 1, c[2]);
+        case 4:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 2, c[2], c[3]);
+        case 5:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 3, c[2], c[3], c[4]);
+        case 6:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 4, c[2], c[3], c[4], c[5]);
+        case 7:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 5, c[2], c[3], c[4], c[5], c[6]);
+        default:
+            return Legacy_Put_Data(cq, frames, c[0], c[1], 6, c[2], c[3], c[4], c[5], c[6], c[7]);
+    }
+}
+
+/**
+ * [Ring_Setup 初始化缓冲区，设置起始偏移并预先写入部分数据]
+ * @param cq        [环形缓冲区句柄]
+ * @param mem       [存储区]
+ * @param offset    [起始偏移]
+ * @param prefill   [预先写入元素个数]
+ * @param overwrite [true 覆盖模式]
+ * @param frame_len [覆盖模式丢弃单位]
+ */
+static void Ring_Setup(CQ_handleTypeDef *cq, uint16_t *mem, uint32_t offset, uint32_t prefill, bool overwrite, uint32_t frame_len)
+{
+    CQ_16_init(cq, mem, RING_SIZE);
+    if(overwrite == true)
+    {
+        CQ_setPolicy(cq, CQ_POLICY_OVERWRITE_OLDEST, frame_len);
+    }
+    cq->entrance = cq->exit = offset;
+    CQ_16putData(cq, Prefill_Buf, prefill);
+}
+
+/**
+ * [Check_Case 一组比对]
+ * @param ch_total  [通道总数]
+ * @param frames    [帧数]
+ * @param offset    [起始偏移]
+ * @param prefill   [预先写入元素个数]
+ * @param overwrite [true 覆盖模式，丢弃单位与调试通道一致为一帧全部通道]
+ */
+static void Check_Case(uint32_t ch_total, uint32_t frames, uint32_t offset, uint32_t prefill, bool overwrite)
+{
+    CQ_handleTypeDef ref;
+    CQ_handleTypeDef cur;
+    const uint16_t *channels[MAX_CHANNEL];
+    uint32_t frame_len = ch_total * MONO_FRAME_SIZE;
+    uint32_t ref_len = 0;
+    uint32_t cur_len = 0;
+    uint32_t n = 0;
+
+    for(uint32_t ch = 0; ch < ch_total; ch++)
+    {
+        for(uint32_t i = 0; i < frames; i++)
+        {
+            Ch_Buf[ch][i] = (int16_t)Test_Rand(&Rand_State);
+        }
+        channels[ch] = (const uint16_t *)Ch_Buf[ch];
+    }
+    for(uint32_t i = 0; i < prefill; i++)
+    {
+        Prefill_Buf[i] = (uint16_t)Test_Rand(&Rand_State);
+    }
+
+    Ring_Setup(&ref, Ref_Ring, offset, prefill, overwrite, frame_len);
+    Ring_Setup(&cur, New_Ring, offset, prefill, overwrite, frame_len);
+
+    ref_len = Legacy_Put(&ref, ch_total, frames);
+    /*与Audio_Debug_Put_Channel_Data_At中非抽取模式调用一致*/
+    cur_len = CQ_16putInterleaved(&cur, channels, ch_total, 1, frames) * ch_total;
+
+    TEST_CHECK(Test_Name, ref_len == cur_len, "ch %u frames %u offset %u prefill %u: len %u expect %u",
+               ch_total, frames, offset, prefill, cur_len, ref_len);
+    TEST_CHECK(Test_Name, CQ_getLength(&ref) == CQ_getLength(&cur), "ch %u frames %u: length %u expect %u",
+               ch_total, frames, CQ_getLength(&cur), CQ_getLength(&ref));
+    TEST_CHECK(Test_Name, CQ_getDropCount(&ref) == CQ_getDropCount(&cur), "ch %u frames %u: drop %u expect %u",
+               ch_total, frames, CQ_getDropCount(&cur), CQ_getDropCount(&ref));
+
+    n = CQ_16getData(&ref, Ref_Out, RING_SIZE);
+    TEST_CHECK(Test_Name, CQ_16getData(&cur, New_Out, RING_SIZE) == n, "ch %u frames %u: read length", ch_total, frames);
+    for(uint32_t i = 0; i < n; i++)
+    {
+        TEST_CHECK(Test_Name, Ref_Out[i] == New_Out[i], "ch %u frames %u offset %u prefill %u: data[%u] %04X expect %04X",
+                   ch_total, frames, offset, prefill, i, New_Out[i], Ref_Out[i]);
+    }
+}
+
+/**
+ * [main 遍历通道数、帧数、起始偏移，另加随机预填充]
+ * @param  argc [参数个数]
+ * @param  argv [种子 每组随机次数]
+ * @return      [0 全部一致]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x1EAFU);
+    uint32_t loops = Test_Arg_U32(argc, argv, 2, 200U);
+    uint32_t cases = 0;
+    uint32_t wraps = 0;
+    uint32_t len = 0;
+    uint32_t prefill = 0;
+    uint32_t offset = 0;
+    uint64_t start = Test_Now_Ns();
+
+    Rand_State = (seed == 0U)?1U:seed;
+    for(uint32_t policy = 0; policy < 2U; policy++)
+    {
+        for(uint32_t ch = 2; ch <= MAX_CHANNEL; ch++)
+        {
+            for(uint32_t f = 0; f < sizeof(Frames_Table) / sizeof(Frames_Table[0]); f++)
+            {
+                len = ch * Frames_Table[f];
+                for(uint32_t o = 0; o < sizeof(Offset_Table) / sizeof(Offset_Table[0]) + loops; o++)
+                {
+                    /*固定偏移后接随机偏移*/
+                    offset = (o < sizeof(Offset_Table) / sizeof(Offset_Table[0]))?Offset_Table[o]:Test_Rand(&Rand_State);
+                    /*丢弃最新模式下空间不足时原实现写入部分帧，新实现仅写入整帧，仅比对空间足够的情况*/
+                    prefill = Test_Rand_Range(&Rand_State, ((policy == 0U)?(RING_SIZE - len):RING_SIZE) + 1U);
+                    if(((offset + prefill) & (RING_SIZE - 1U)) + len > RING_SIZE)
+                    {
+                        wraps++;
+                    }
+                    Check_Case(ch, Frames_Table[f], offset, prefill, policy == 1U);
+                    cases++;
+                }
+            }
+        }
+    }
+
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"channels\":\"2-8\",\"cases\":%u,\"wrap_cases\":%u,\"elapsed_ms\":%.3f}\n",
+           Test_Name, cases, wraps, (double)(Test_Now_Ns() - start) / 1e6);
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,326 @@
+/**
+ *  @file mq_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 变长消息队列(MQ_xx)测试
+ *
+ *  @details 用法: mq_test [种子] [随机操作次数]
+ *           1、随机：随机长度的加入、单条取出、批量取出、查看长度，与参考队列比对，
+ *              起始位置靠近末尾使帧头与数据跨越回绕处，空消息必须被拒绝
+ *           2、帧头损坏：5字节续位、第5字节溢出、长度为0、长度超出可读区，
+ *              之前的消息完整取出，损坏数据被丢弃，队列不可停滞，之后的消息可重新对齐
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include "MessageQueue.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define RING_SIZE           CQ_BUF_1KB
+#define MAX_MSG_LEN         400U
+#define MAX_BATCH           8U
+#define REF_MAX             (RING_SIZE / 2U)    /**< 参考队列最多消息条数，每条至少占2字节*/
+
+/** Private typedef ----------------------------------------------------------*/
+/*帧头损坏类型*/
+typedef enum
+{
+    CORRUPT_CONTINUATION = 0,   /**< 帧头全部为续位*/
+    CORRUPT_OVERFLOW,           /**< 第5字节超出32位*/
+    CORRUPT_ZERO,               /**< 长度为0*/
+    CORRUPT_TOO_LONG,           /**< 长度超出可读区*/
+    CORRUPT_NUM,
+}CORRUPT_TypeDef;
+
+/*取出方式*/
+typedef enum
+{
+    READ_SINGLE = 0,
+    READ_BATCH,
+    READ_PEEK,
+    READ_NUM,
+}READ_TypeDef;
+
+/*参考队列*/
+typedef struct
+{
+    uint8_t data[REF_MAX][MAX_MSG_LEN];
+    uint32_t len[REF_MAX];
+    uint32_t head;
+    uint32_t count;
+}REF_QueueTypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const char *const Corrupt_Name[CORRUPT_NUM] = {"continuation", "overflow", "zero", "too_long"};
+static const char *const Read_Name[READ_NUM] = {"single", "batch", "peek"};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "mq_test";
+static uint8_t Ring_Buf[RING_SIZE];
+static uint8_t Msg_Buf[RING_SIZE];
+static uint8_t Out_Buf[RING_SIZE];
+static REF_QueueTypeDef Ref;
+static uint32_t Rand_State;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/**
+ * [Ring_Setup 初始化缓冲区并设置起始偏移]
+ * @param cq     [环形缓冲区句柄]
+ * @param offset [起始偏移]
+ */
+static void Ring_Setup(CQ_handleTypeDef *cq, uint32_t offset)
+{
+    CQ_init(cq, Ring_Buf, RING_SIZE);
+    cq->entrance = cq->exit = offset;
+}
+
+/**
+ * [Check_Msg 校验取出的消息与参考队列队首一致并出队]
+ * @param data [消息]
+ * @param len  [消息长度]
+ */
+static void Check_Msg(const uint8_t *data, uint32_t len)
+{
+    uint32_t head = Ref.head;
+
+    TEST_CHECK(Test_Name, Ref.count > 0U, "got %u bytes from empty queue", len);
+    TEST_CHECK(Test_Name, len == Ref.len[head], "len %u expect %u", len, Ref.len[head]);
+    TEST_CHECK(Test_Name, memcmp(data, Ref.data[head], len) == 0, "data mismatch len %u", len);
+    Ref.head = (head + 1U) % REF_MAX;
+    Ref.count--;
+}
+
+/**
+ * [Test_Random 随机操作与参考队列比对]
+ * @param loops [操作次数]
+ */
+static void Test_Random(uint32_t loops)
+{
+    CQ_handleTypeDef cq;
+    MQ_MsgTypeDef Msgs[MAX_BATCH];
+    uint32_t len = 0;
+    uint32_t size = 0;
+    uint32_t n = 0;
+    uint32_t puts = 0;
+    uint32_t gets = 0;
+    uint32_t wraps = 0;
+    bool fit = false;
+
+    memset(&Ref, 0, sizeof(Ref));
+    Ring_Setup(&cq, 0xFFFFFFFFU - RING_SIZE * 3U);
+    for(uint32_t i = 0; i < loops; i++)
+    {
+        switch(Test_Rand_Range(&Rand_State, 4U))
+        {
+            case 0:
+                /*偏向短消息，偶尔为空消息或超过剩余空间*/
+                len = (Test_Rand_Range(&Rand_State, 4U) == 0U)?Test_Rand_Range(&Rand_State, MAX_MSG_LEN + 1U)
+                                                               :Test_Rand_Range(&Rand_State, 130U);
+                for(uint32_t k = 0; k < len; k++)
+                {
+                    Msg_Buf[k] = (uint8_t)Test_Rand(&Rand_State);
+                }
+                fit = (len > 0U && MQ_msgSpace(len) <= RING_SIZE - CQ_getLength(&cq));
+                if((cq.entrance & (RING_SIZE - 1U)) + MQ_msgSpace(len) > RING_SIZE)
+                {
+                    wraps += fit?1U:0U;
+                }
+                n = CQ_getLength(&cq);
+                TEST_CHECK(Test_Name, MQ_putMsg(&cq, Msg_Buf, len) == (fit?len:0U), "put %u fit %d", len, fit);
+                if(fit == false)
+                {
+                    TEST_CHECK(Test_Name, CQ_getLength(&cq) == n, "failed put %u changed length", len);
+                    break;
+                }
+                memcpy(Ref.data[(Ref.head + Ref.count) % REF_MAX], Msg_Buf, len);
+                Ref.len[(Ref.head + Ref.count) % REF_MAX] = len;
+                Ref.count++;
+                puts++;
+                break;
+            case 1:
+                size = Test_Rand_Range(&Rand_State, MAX_MSG_LEN + 1U);
+                len = MQ_getMsg(&cq, Out_Buf, size);
+                /*无消息或目标区不足时返回0且不取出*/
+                if(Ref.count == 0U || Ref.len[Ref.head] > size)
+                {
+                    TEST_CHECK(Test_Name, len == 0U, "get %u with size %u", len, size);
+                    break;
+                }
+                Check_Msg(Out_Buf, len);
+                gets++;
+                break;
+            case 2:
+                size = Test_Rand_Range(&Rand_State, RING_SIZE + 1U);
+                n = MQ_getMsgBatch(&cq, Out_Buf, size, Msgs, Test_Rand_Range(&Rand_State, MAX_BATCH) + 1U);
+                for(uint32_t k = 0; k < n; k++)
+                {
+                    TEST_CHECK(Test_Name, Msgs[k].data >= Out_Buf && Msgs[k].data + Msgs[k].len <= Out_Buf + size, "batch out of range");
+                    Check_Msg(Msgs[k].data, Msgs[k].len);
+                }
+                gets += n;
+                break;
+            default:
+                TEST_CHECK(Test_Name, MQ_peekMsgLen(&cq) == ((Ref.count == 0U)?-1:(int32_t)Ref.len[Ref.head]), "peek");
+                break;
+        }
+        TEST_CHECK(Test_Name, (Ref.count == 0U) == (CQ_getLength(&cq) == 0U), "length %u with %u messages", CQ_getLength(&cq), Ref.count);
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"random\",\"loops\":%u,\"puts\":%u,\"gets\":%u,\"wrap_puts\":%u}\n",
+           Test_Name, loops, puts, gets, wraps);
+}
+
+/**
+ * [Read_One 按指定方式取出一条消息]
+ * @param  cq   [环形缓冲区句柄]
+ * @param  type [取出方式]
+ * @return      [消息长度，无消息返回0]
+ */
+static uint32_t Read_One(CQ_handleTypeDef *cq, READ_TypeDef type)
+{
+    MQ_MsgTypeDef Msg;
+    int32_t len = 0;
+
+    switch(type)
+    {
+        case READ_SINGLE:
+            return MQ_getMsg(cq, Out_Buf, sizeof(Out_Buf));
+        case READ_BATCH:
+            if(MQ_getMsgBatch(cq, Out_Buf, sizeof(Out_Buf), &Msg, 1) == 0U)
+            {
+                return 0;
+            }
+            return Msg.len;
+        default:
+            /*先查看长度再按长度取出*/
+            len = MQ_peekMsgLen(cq);
+            if(len < 0)
+            {
+                return 0;
+            }
+            TEST_CHECK(Test_Name, MQ_getMsg(cq, Out_Buf, (uint32_t)len) == (uint32_t)len, "peek %d then get", len);
+            return (uint32_t)len;
+    }
+}
+
+/**
+ * [Test_Corrupt 第二条消息帧头损坏，首条与其后消息正确取出，队列不可停滞]
+ * @param type   [损坏类型]
+ * @param read   [取出方式]
+ * @param offset [起始偏移]
+ */
+static void Test_Corrupt(CORRUPT_TypeDef type, READ_TypeDef read, uint32_t offset)
+{
+    static const uint8_t Overflow[MQ_HEADER_MAX] = {0x81, 0x80, 0x80, 0x80, 0x70};
+    CQ_handleTypeDef cq;
+    uint8_t a[20];
+    uint8_t b[100];
+    uint8_t c[10];
+    uint32_t pos = 0;
+    uint32_t len = 0;
+
+    for(uint32_t k = 0; k < sizeof(a); k++)
+    {
+        a[k] = (uint8_t)Test_Rand(&Rand_State);
+    }
+    /*损坏消息数据全部为续位，重新对齐时不会被误认为帧头*/
+    memset(b, 0xFF, sizeof(b));
+    for(uint32_t k = 0; k < sizeof(c); k++)
+    {
+        c[k] = (uint8_t)Test_Rand(&Rand_State);
+    }
+
+    Ring_Setup(&cq, offset);
+    TEST_CHECK(Test_Name, MQ_putMsg(&cq, a, sizeof(a)) == sizeof(a), "put a");
+    pos = cq.entrance;
+    TEST_CHECK(Test_Name, MQ_putMsg(&cq, b, sizeof(b)) == sizeof(b), "put b");
+    /*长度超出时损坏的为最后一条消息*/
+    if(type != CORRUPT_TOO_LONG)
+    {
+        TEST_CHECK(Test_Name, MQ_putMsg(&cq, c, sizeof(c)) == sizeof(c), "put c");
+    }
+
+    switch(type)
+    {
+        case CORRUPT_CONTINUATION:
+            Ring_Buf[pos & (RING_SIZE - 1U)] = 0xFF;
+            break;
+        case CORRUPT_OVERFLOW:
+            /*截断后长度为1，未校验第5字节时会被当作有效消息*/
+            for(uint32_t k = 0; k < MQ_HEADER_MAX; k++)
+            {
+                Ring_Buf[(pos + k) & (RING_SIZE - 1U)] = Overflow[k];
+            }
+            break;
+        case CORRUPT_ZERO:
+            Ring_Buf[pos & (RING_SIZE - 1U)] = 0x00;
+            break;
+        default:
+            Ring_Buf[pos & (RING_SIZE - 1U)] = 0x7F;
+            break;
+    }
+
+    len = Read_One(&cq, read);
+    TEST_CHECK(Test_Name, len == sizeof(a) && memcmp(Out_Buf, a, len) == 0, "%s/%s: first message len %u",
+               Corrupt_Name[type], Read_Name[read], len);
+    if(type != CORRUPT_TOO_LONG)
+    {
+        len = Read_One(&cq, read);
+        TEST_CHECK(Test_Name, len == sizeof(c) && memcmp(Out_Buf, c, len) == 0, "%s/%s: resync message len %u",
+                   Corrupt_Name[type], Read_Name[read], len);
+    }
+    len = Read_One(&cq, read);
+    TEST_CHECK(Test_Name, len == 0U && CQ_getLength(&cq) == 0U, "%s/%s: stalled, len %u left %u",
+               Corrupt_Name[type], Read_Name[read], len, CQ_getLength(&cq));
+
+    /*之后的消息正常收发*/
+    TEST_CHECK(Test_Name, MQ_putMsg(&cq, c, sizeof(c)) == sizeof(c), "put after resync");
+    len = Read_One(&cq, read);
+    TEST_CHECK(Test_Name, len == sizeof(c) && memcmp(Out_Buf, c, len) == 0, "%s/%s: message after resync len %u",
+               Corrupt_Name[type], Read_Name[read], len);
+}
+
+/**
+ * [main 依次运行各组]
+ * @param  argc [参数个数]
+ * @param  argv [种子 随机操作次数]
+ * @return      [0 全部通过]
+ */
+int main(int argc, char **argv)
+{
+    static const uint32_t Offset_Table[] = {0, 1, RING_SIZE - 21U, RING_SIZE - 22U, RING_SIZE - 60U, RING_SIZE - 121U};
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x3E55U);
+    uint32_t loops = Test_Arg_U32(argc, argv, 2, 500000U);
+    CQ_handleTypeDef cq;
+
+    Rand_State = (seed == 0U)?1U:seed;
+
+    Ring_Setup(&cq, 0);
+    TEST_CHECK(Test_Name, MQ_putMsg(&cq, Msg_Buf, 0) == 0U && CQ_getLength(&cq) == 0U, "empty message accepted");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"reject_empty\"}\n", Test_Name);
+
+    Test_Random(loops);
+
+    for(uint32_t type = 0; type < CORRUPT_NUM; type++)
+    {
+        for(uint32_t read = 0; read < READ_NUM; read++)
+        {
+            for(uint32_t o = 0; o < sizeof(Offset_Table) / sizeof(Offset_Table[0]); o++)
+            {
+                Test_Corrupt((CORRUPT_TypeDef)type, (READ_TypeDef)read, Offset_Table[o]);
+            }
+        }
+        printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"corrupt_%s\",\"offsets\":%u}\n",
+               Test_Name, Corrupt_Name[type], (uint32_t)(sizeof(Offset_Table) / sizeof(Offset_Table[0])));
+    }
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,208 @@
+/**
+ *  @file nco_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 数控振荡器(NCO_xx)相位连续及电平测试
+ *
+ *  @details 用法: nco_test [种子]
+ *           1、continuity：随机分段改频(20Hz至7.9kHz)，改频前后相位累加器不变，
+ *              输出与双精度参考正弦逐点相差不超过SINE_ERR_MAX，改频处相邻点差值不超过最高频率下的斜率
+ *           2、level：NCO_dbfsToGain以0.1dB步进覆盖0至-120dBFS，与10^(dB/20)相差不超过GAIN_ERR_MAX，
+ *              整dB点与DT_Db_Gain_q31表换算值一致，超出范围时限幅或静音
+ *           3、render：1kHz整周期输出的峰值及有效值与设定电平一致
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include "Nco.h"
+#include "DspTables.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define SAMPLE_RATE         16000U
+#define SEGMENT_NUM         400U
+#define SEGMENT_MAX         300U    /**< 每段最多点数*/
+#define FREQ_MIN            20U
+#define FREQ_MAX            7900U
+#define SINE_ERR_MAX        2.0     /**< 满幅时与参考正弦的最大偏差，LSB*/
+#define GAIN_ERR_MAX        1.0     /**< Q15幅度最大偏差，LSB*/
+#define RENDER_SAMPLES      1600U   /**< 1kHz下100个整周期*/
+#define RMS_ERR_MAX_DB      0.02
+
+/** Private typedef ----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+static const float Render_Level[] = {0.f, -6.f, -20.f, -40.f, -60.f};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "nco_test";
+static int16_t Out[SEGMENT_MAX];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Test_Continuity 随机分段改频，逐点与参考正弦比对]
+ * @param seed [随机种子]
+ */
+static void Test_Continuity(uint32_t *seed)
+{
+    NCO_StateTypeDef nco;
+    uint32_t ref_phase = 0;
+    uint32_t phase = 0;
+    uint32_t len = 0;
+    float freq = 0;
+    float last_freq = 0;
+    double expect = 0;
+    double err = 0;
+    double max_err = 0;
+    double jump = 0;
+    double jump_max = 0;
+    int32_t last = 0;
+    uint32_t total = 0;
+
+    NCO_init(&nco, SAMPLE_RATE);
+    NCO_setLevel(&nco, 0.f);
+    NCO_setPhase(&nco, Test_Rand(seed));
+    ref_phase = nco.phase;
+    for(uint32_t n = 0; n < SEGMENT_NUM; n++)
+    {
+        freq = (float)(FREQ_MIN + Test_Rand_Range(seed, FREQ_MAX - FREQ_MIN)) + (float)(Test_Rand(seed) & 0xFFU) / 256.f;
+        phase = nco.phase;
+        TEST_CHECK(Test_Name, NCO_setFrequency(&nco, freq) == true, "continuity: set %.3f Hz", freq);
+        TEST_CHECK(Test_Name, nco.phase == phase, "continuity: segment %u phase changed by set frequency", n);
+        TEST_CHECK(Test_Name, fabs(NCO_getFrequency(&nco) - freq) < 0.01, "continuity: get %.4f Hz expect %.4f",
+                   NCO_getFrequency(&nco), freq);
+
+        len = 1U + Test_Rand_Range(seed, SEGMENT_MAX);
+        NCO_render(&nco, Out, 1, len);
+        for(uint32_t i = 0; i < len; i++)
+        {
+            expect = 32767.0 * sin(2.0 * M_PI * (double)ref_phase / 4294967296.0);
+            err = fabs(Out[i] - expect);
+            max_err = (err > max_err)?err:max_err;
+            TEST_CHECK(Test_Name, err <= SINE_ERR_MAX, "continuity: segment %u sample %u got %d expect %.1f", n, i, Out[i], expect);
+            ref_phase += nco.step;
+        }
+        /*改频处相邻点差值不超过两段中较高频率下的最大斜率*/
+        if(n > 0U)
+        {
+            jump = fabs((double)Out[0] - last);
+            jump_max = 32767.0 * 2.0 * sin(M_PI * fmax(freq, last_freq) / SAMPLE_RATE) + 2.0 * SINE_ERR_MAX;
+            TEST_CHECK(Test_Name, jump <= jump_max, "continuity: segment %u jump %.0f limit %.0f (%.1f -> %.1f Hz)",
+                       n, jump, jump_max, last_freq, freq);
+        }
+        TEST_CHECK(Test_Name, nco.phase == ref_phase, "continuity: segment %u phase 0x%08x expect 0x%08x", n, nco.phase, ref_phase);
+        last = Out[len - 1U];
+        last_freq = freq;
+        total += len;
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"continuity\",\"segments\":%u,\"samples\":%u,\"max_err_lsb\":%.2f}\n",
+           Test_Name, SEGMENT_NUM, total, max_err);
+}
+
+/**
+ * [Test_Level 电平转幅度与理论值及电平表比对]
+ */
+static void Test_Level(void)
+{
+    double expect = 0;
+    double err = 0;
+    double max_err = 0;
+    int32_t gain = 0;
+    int32_t table_gain = 0;
+
+    for(uint32_t tenth = 0; tenth <= DT_DB_GAIN_MIN * 10U; tenth++)
+    {
+        gain = NCO_dbfsToGain(-(float)tenth / 10.f);
+        expect = 32767.0 * pow(10.0, -(double)tenth / 200.0);
+        err = fabs(gain - expect);
+        max_err = (err > max_err)?err:max_err;
+        TEST_CHECK(Test_Name, err <= GAIN_ERR_MAX, "level: -%u.%u dBFS gain %d expect %.2f", tenth / 10U, tenth % 10U, gain, expect);
+    }
+    /*整dB点即电平表本身*/
+    for(uint32_t db = 0; db <= DT_DB_GAIN_MIN; db++)
+    {
+        expect = 2147483648.0 * pow(10.0, -(double)db / 20.0);
+        TEST_CHECK(Test_Name, fabs(DT_Db_Gain_q31[db] - fmin(expect, 2147483647.0)) <= 1.0, "level: table[%u] %d expect %.1f",
+                   db, DT_Db_Gain_q31[db], expect);
+        table_gain = (int32_t)(((int64_t)DT_Db_Gain_q31[db] * 32767 + 0x40000000) >> 31);
+        TEST_CHECK(Test_Name, NCO_dbfsToGain(-(float)db) == table_gain, "level: -%u dBFS gain %d table %d",
+                   db, NCO_dbfsToGain(-(float)db), table_gain);
+    }
+    TEST_CHECK(Test_Name, NCO_dbfsToGain(6.f) == NCO_dbfsToGain(0.f), "level: positive dBFS not clamped");
+    TEST_CHECK(Test_Name, NCO_dbfsToGain(NCO_LEVEL_MIN_DBFS - 0.5f) == 0, "level: below minimum not muted");
+    TEST_CHECK(Test_Name, NCO_dbfsToGain(NAN) == 0, "level: NaN not muted");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"level\",\"max_err_lsb\":%.3f}\n", Test_Name, max_err);
+}
+
+/**
+ * [Test_Render 输出峰值及有效值与设定电平比对]
+ */
+static void Test_Render(void)
+{
+    static int16_t Buf[RENDER_SAMPLES];
+    NCO_StateTypeDef nco;
+    int32_t peak = 0;
+    double power = 0;
+    double rms_db = 0;
+
+    for(uint32_t n = 0; n < sizeof(Render_Level) / sizeof(Render_Level[0]); n++)
+    {
+        NCO_init(&nco, SAMPLE_RATE);
+        NCO_setFrequency(&nco, 1000.f);
+        NCO_setLevel(&nco, Render_Level[n]);
+        NCO_render(&nco, Buf, 1, RENDER_SAMPLES);
+        peak = 0;
+        power = 0;
+        for(uint32_t i = 0; i < RENDER_SAMPLES; i++)
+        {
+            peak = (abs(Buf[i]) > peak)?abs(Buf[i]):peak;
+            power += (double)Buf[i] * Buf[i];
+        }
+        /*1kHz每周期16点，含90度相位点，峰值即幅度*/
+        TEST_CHECK(Test_Name, abs(peak - nco.gain) <= 1, "render: %.0f dBFS peak %d gain %d", Render_Level[n], peak, nco.gain);
+        rms_db = 10.0 * log10(power / RENDER_SAMPLES * 2.0 / (32767.0 * 32767.0));
+        TEST_CHECK(Test_Name, fabs(rms_db - Render_Level[n]) <= RMS_ERR_MAX_DB, "render: %.0f dBFS measured %.3f dBFS",
+                   Render_Level[n], rms_db);
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"render\",\"levels\":%u}\n",
+           Test_Name, (unsigned)(sizeof(Render_Level) / sizeof(Render_Level[0])));
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [main 依次运行各组测试]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x4E434F31U);
+
+    Test_Continuity(&seed);
+    Test_Level();
+    Test_Render();
+    return 0;
+}
+/******************************** End of file *********************************/
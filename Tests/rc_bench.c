@@ -0,0 +1,284 @@
+/**
+ *  @file rc_bench.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief Rice无损压缩主机端压缩率及耗时
+ *
+ *  @details 用法: rc_bench [帧数]
+ *           按Audio_Debug默认设置(2通道、每帧128点、16kHz)逐帧压缩，信号为：
+ *           1、SignalGen正弦1kHz，-6dBFS及-30dBFS，与设备端gen命令一致
+ *           2、合成语音：基频约95-220Hz的声门脉冲经三个共振峰滤波，元音交替，
+ *              音节间有停顿及-60dBFS底噪，并夹有清辅音噪声段
+ *           3、SignalGen白噪声-6dBFS，不可压缩的上限
+ *           每帧解码校验逐点一致，输出压缩率及每帧编解码耗时(主机时间，非MCU周期数)，
+ *           MCU周期数以设备端dbg codec命令读取
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include "RiceCodec.h"
+#include "SignalGen.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define SAMPLE_RATE         16000U
+#define CHANNELS            2U
+#define FRAME_SAMPLES       128U    /**< 与AUDIO_DEBUG_FRAME_MONO_SIZE一致*/
+#define FRAME_BYTES         (CHANNELS * FRAME_SAMPLES * 2U)
+#define FRAME_NUM_MAX       8192U
+
+/** Private typedef ----------------------------------------------------------*/
+/*信号类型*/
+typedef enum
+{
+    BENCH_SINE = 0,
+    BENCH_SINE_LOW,
+    BENCH_SPEECH,
+    BENCH_WHITE,
+    BENCH_NUM,
+}BENCH_TypeDef;
+
+/*二阶共振峰滤波器*/
+typedef struct
+{
+    double a1;
+    double a2;
+    double gain;
+    double y1;
+    double y2;
+}FORMANT_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const char *const Bench_Name[BENCH_NUM] = {"sine_1k_-6dBFS", "sine_1k_-30dBFS", "speech", "white_-6dBFS"};
+/*元音/a/ /i/ /u/前三个共振峰Hz*/
+static const double Vowel_Formant[3][3] = {{730, 1090, 2440}, {270, 2290, 3010}, {300, 870, 2240}};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static int16_t Pcm[CHANNELS][FRAME_NUM_MAX * FRAME_SAMPLES];
+static int16_t Decoded[CHANNELS * FRAME_SAMPLES];
+static uint8_t Coded[RC_FRAME_SIZE_MAX(CHANNELS, FRAME_SAMPLES)];
+static uint32_t Rand_State = 0x51C0FFEEU;
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Bench_Rand SignalGen随机数接口]
+ * @return [随机数]
+ */
+static uint32_t Bench_Rand(void)
+{
+    return Test_Rand(&Rand_State);
+}
+
+/**
+ * [Formant_Set 设置共振峰中心频率，带宽100Hz]
+ * @param f    [滤波器]
+ * @param freq [中心频率Hz]
+ */
+static void Formant_Set(FORMANT_TypeDef *f, double freq)
+{
+    double r = exp(-M_PI * 100.0 / SAMPLE_RATE);
+
+    f->a1 = 2.0 * r * cos(2.0 * M_PI * freq / SAMPLE_RATE);
+    f->a2 = -r * r;
+    f->gain = 1.0 - r;
+}
+
+/**
+ * [Formant_Run 滤波一点]
+ * @param  f [滤波器]
+ * @param  x [输入]
+ * @return   [输出]
+ */
+static double Formant_Run(FORMANT_TypeDef *f, double x)
+{
+    double y = f->gain * x + f->a1 * f->y1 + f->a2 * f->y2;
+
+    f->y2 = f->y1;
+    f->y1 = y;
+    return y;
+}
+
+/**
+ * [Fill_Speech 合成语音，两通道为不同说话人(基频及音节节奏不同)]
+ * @param samples [每通道点数]
+ */
+static void Fill_Speech(uint32_t samples)
+{
+    static double Buf[FRAME_NUM_MAX * FRAME_SAMPLES];
+    FORMANT_TypeDef formant[3];
+    double peak = 0;
+    double phase = 0;
+    double f0 = 0;
+    double x = 0;
+    double t = 0;
+    double syllable = 0;
+    double envelope = 0;
+    double rate = 0;
+    uint32_t vowel = 0;
+    uint32_t last_vowel = 0;
+
+    for(uint32_t ch = 0; ch < CHANNELS; ch++)
+    {
+        memset(formant, 0, sizeof(formant));
+        peak = 1e-9;
+        phase = 0;
+        /*每秒音节数*/
+        rate = (ch == 0U)?4.0:3.3;
+        last_vowel = UINT32_MAX;
+        for(uint32_t i = 0; i < samples; i++)
+        {
+            t = (double)i / SAMPLE_RATE;
+            /*音节：发声、清辅音、停顿*/
+            syllable = fmod(t * rate, 1.0);
+            vowel = (uint32_t)(t * rate) % 3U;
+            if(vowel != last_vowel)
+            {
+                for(uint32_t k = 0; k < 3U; k++)
+                {
+                    Formant_Set(&formant[k], Vowel_Formant[vowel][k]);
+                }
+                last_vowel = vowel;
+            }
+            f0 = (ch == 0U?110.0:190.0) * (1.0 + 0.15 * sin(2.0 * M_PI * 2.5 * t));
+            phase += f0 / SAMPLE_RATE;
+            x = 0;
+            if(syllable < 0.6)
+            {
+                /*声门脉冲，每周期一个*/
+                if(phase >= 1.0)
+                {
+                    phase -= 1.0;
+                    x = 1.0;
+                }
+                envelope = sin(M_PI * syllable / 0.6);
+            }
+            else if(syllable < 0.75)
+            {
+                /*清辅音*/
+                x = ((double)(Test_Rand(&Rand_State) & 0xFFFFU) / 32768.0 - 1.0) * 0.05;
+                envelope = 1.0;
+            }
+            else
+            {
+                envelope = 0;
+            }
+            x = Formant_Run(&formant[2], Formant_Run(&formant[1], Formant_Run(&formant[0], x))) * envelope;
+            Buf[i] = x;
+            peak = (fabs(x) > peak)?fabs(x):peak;
+        }
+        /*峰值-6dBFS，叠加-60dBFS底噪*/
+        for(uint32_t i = 0; i < samples; i++)
+        {
+            x = Buf[i] / peak * 16384.0 + ((double)(Test_Rand(&Rand_State) & 0xFFFFU) / 32768.0 - 1.0) * 32.0;
+            Pcm[ch][i] = (int16_t)lrint(x);
+        }
+    }
+}
+
+/**
+ * [Fill_Signal 生成测试信号]
+ * @param type    [信号类型]
+ * @param samples [每通道点数]
+ */
+static void Fill_Signal(BENCH_TypeDef type, uint32_t samples)
+{
+    static SG_HandleTypeDef sg;
+
+    if(type == BENCH_SPEECH)
+    {
+        Fill_Speech(samples);
+        return;
+    }
+    for(uint32_t ch = 0; ch < CHANNELS; ch++)
+    {
+        SG_init(&sg, SAMPLE_RATE, Bench_Rand);
+        if(type == BENCH_WHITE)
+        {
+            SG_setWhite(&sg, -6.f);
+        }
+        else
+        {
+            SG_setSine(&sg, 1000.f, (type == BENCH_SINE)?-6.f:-30.f);
+        }
+        SG_render(&sg, Pcm[ch], 1, samples);
+    }
+}
+
+/**
+ * [Run_Bench 逐帧压缩并校验]
+ * @param type   [信号类型]
+ * @param frames [帧数]
+ */
+static void Run_Bench(BENCH_TypeDef type, uint32_t frames)
+{
+    const int16_t *channels[CHANNELS];
+    uint64_t coded_bytes = 0;
+    uint64_t encode_ns = 0;
+    uint64_t decode_ns = 0;
+    uint64_t start = 0;
+    uint32_t size = 0;
+    uint32_t max_size = 0;
+
+    Fill_Signal(type, frames * FRAME_SAMPLES);
+    for(uint32_t n = 0; n < frames; n++)
+    {
+        for(uint32_t ch = 0; ch < CHANNELS; ch++)
+        {
+            channels[ch] = &Pcm[ch][n * FRAME_SAMPLES];
+        }
+        start = Test_Now_Ns();
+        size = RC_encodeFrame(channels, CHANNELS, FRAME_SAMPLES, Coded, sizeof(Coded));
+        encode_ns += Test_Now_Ns() - start;
+
+        start = Test_Now_Ns();
+        TEST_CHECK("rc_bench", RC_decodeFrame(Coded, size, CHANNELS, FRAME_SAMPLES, Decoded) == true, "%s frame %u", Bench_Name[type], n);
+        decode_ns += Test_Now_Ns() - start;
+        for(uint32_t i = 0; i < FRAME_SAMPLES; i++)
+        {
+            for(uint32_t ch = 0; ch < CHANNELS; ch++)
+            {
+                TEST_CHECK("rc_bench", Decoded[i * CHANNELS + ch] == channels[ch][i], "%s frame %u mismatch", Bench_Name[type], n);
+            }
+        }
+        coded_bytes += size;
+        max_size = (size > max_size)?size:max_size;
+    }
+    printf("{\"bench\":\"rice\",\"signal\":\"%s\",\"channels\":%u,\"frame_samples\":%u,\"frames\":%u,"
+           "\"ratio\":%.3f,\"max_frame_bytes\":%u,\"host_encode_ns_per_frame\":%.1f,\"host_decode_ns_per_frame\":%.1f}\n",
+           Bench_Name[type], CHANNELS, FRAME_SAMPLES, frames, (double)frames * FRAME_BYTES / (double)coded_bytes, max_size,
+           (double)encode_ns / frames, (double)decode_ns / frames);
+}
+
+/**
+ * [main 依次测量各信号]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t frames = Test_Arg_U32(argc, argv, 1, 4000U);
+
+    frames = (frames > FRAME_NUM_MAX)?FRAME_NUM_MAX:((frames == 0U)?1U:frames);
+    for(uint32_t type = 0; type < BENCH_NUM; type++)
+    {
+        Run_Bench((BENCH_TypeDef)type, frames);
+    }
+    return 0;
+}
+/******************************** End of file *********************************/
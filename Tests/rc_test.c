@@ -0,0 +1,286 @@
+/**
+ *  @file rc_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief Rice无损压缩(RC_xx)往返测试
+ *
+ *  @details 用法: rc_test [种子] [随机帧数]
+ *           1、frame：1-8通道、1-256点，各通道随机选取静音、直流、正弦、满幅方波、
+ *              白噪声、随机游走、脉冲信号，RC_encodeFrame后RC_decodeFrame逐点一致，
+ *              长度为4的整数倍且不超过RC_FRAME_SIZE_MAX
+ *           2、channels：各通道点数不同(分通道抽取)，RC_encodeChannels/RC_decodeChannels逐点一致
+ *           3、cap：输出区不足时返回0且不写出界，截断位流解码失败，位翻转不越界
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include "RiceCodec.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define SAMPLES_MAX         256U
+#define GUARD_SIZE          16U
+#define GUARD_BYTE          0xA5U
+#define OUT_SIZE            (RC_FRAME_SIZE_MAX(RC_CHANNEL_MAX, SAMPLES_MAX) + GUARD_SIZE)
+
+/** Private typedef ----------------------------------------------------------*/
+/*信号类型*/
+typedef enum
+{
+    SIGNAL_SILENCE = 0,
+    SIGNAL_DC,
+    SIGNAL_SINE,
+    SIGNAL_SQUARE,          /**< 满幅方波，残差超出16位，覆盖转义*/
+    SIGNAL_WHITE,           /**< 不可压缩，覆盖原始数据回退*/
+    SIGNAL_WALK,
+    SIGNAL_IMPULSE,
+    SIGNAL_NUM,
+}SIGNAL_TypeDef;
+
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "rc_test";
+static int16_t Pcm[RC_CHANNEL_MAX][SAMPLES_MAX];
+static int16_t Decoded[RC_CHANNEL_MAX * SAMPLES_MAX];
+static uint8_t Out[OUT_SIZE];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Fill_Signal 生成一通道测试信号]
+ * @param seed    [随机数状态]
+ * @param type    [信号类型]
+ * @param x       [输出]
+ * @param samples [点数]
+ */
+static void Fill_Signal(uint32_t *seed, SIGNAL_TypeDef type, int16_t *x, uint32_t samples)
+{
+    double amp = (double)(1U + Test_Rand_Range(seed, 32767U));
+    double freq = (double)(20U + Test_Rand_Range(seed, 7980U)) / 16000.0;
+    int32_t value = (int32_t)(Test_Rand(seed) & 0xFFFFU) - 32768;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        switch(type)
+        {
+            case SIGNAL_SILENCE:
+                x[i] = 0;
+                break;
+            case SIGNAL_DC:
+                x[i] = (int16_t)value;
+                break;
+            case SIGNAL_SINE:
+                x[i] = (int16_t)lrint(amp * sin(2.0 * M_PI * freq * i));
+                break;
+            case SIGNAL_SQUARE:
+                x[i] = ((i / (1U + (uint32_t)(freq * 16.0))) & 1U)?INT16_MAX:INT16_MIN;
+                break;
+            case SIGNAL_WHITE:
+                x[i] = (int16_t)Test_Rand(seed);
+                break;
+            case SIGNAL_WALK:
+                value += (int32_t)Test_Rand_Range(seed, 513U) - 256;
+                value = (value > INT16_MAX)?INT16_MAX:((value < INT16_MIN)?INT16_MIN:value);
+                x[i] = (int16_t)value;
+                break;
+            default:
+                x[i] = (Test_Rand_Range(seed, 16U) == 0U)?(int16_t)Test_Rand(seed):0;
+                break;
+        }
+    }
+}
+
+/**
+ * [Random_Samples 随机点数，偏向边界值]
+ * @param  seed [随机数状态]
+ * @return      [1-SAMPLES_MAX]
+ */
+static uint32_t Random_Samples(uint32_t *seed)
+{
+    static const uint32_t edge[] = {1, 2, 3, 4, 5, 127, 128, 255, 256};
+
+    if(Test_Rand_Range(seed, 2U) == 0U)
+    {
+        return edge[Test_Rand_Range(seed, sizeof(edge) / sizeof(edge[0]))];
+    }
+    return 1U + Test_Rand_Range(seed, SAMPLES_MAX);
+}
+
+/**
+ * [Guard_Intact 检查输出区指定位置之后未被写入]
+ * @param  from [起始字节]
+ * @return      [true未写入]
+ */
+static bool Guard_Intact(uint32_t from)
+{
+    for(uint32_t i = from; i < from + GUARD_SIZE && i < OUT_SIZE; i++)
+    {
+        if(Out[i] != GUARD_BYTE)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * [Test_Frame 等长通道往返]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Frame(uint32_t *seed, uint32_t frames)
+{
+    const int16_t *channels[RC_CHANNEL_MAX];
+    uint32_t ch_num = 0;
+    uint32_t samples = 0;
+    uint32_t size = 0;
+    uint64_t pcm_bytes = 0;
+    uint64_t coded_bytes = 0;
+
+    for(uint32_t loop = 0; loop < frames; loop++)
+    {
+        ch_num = 1U + Test_Rand_Range(seed, RC_CHANNEL_MAX);
+        samples = Random_Samples(seed);
+        for(uint32_t ch = 0; ch < ch_num; ch++)
+        {
+            Fill_Signal(seed, (SIGNAL_TypeDef)Test_Rand_Range(seed, SIGNAL_NUM), Pcm[ch], samples);
+            channels[ch] = Pcm[ch];
+        }
+        memset(Out, GUARD_BYTE, sizeof(Out));
+        size = RC_encodeFrame(channels, ch_num, samples, Out, RC_FRAME_SIZE_MAX(ch_num, samples));
+        TEST_CHECK(Test_Name, size > 0U && (size & 3U) == 0U && size <= RC_FRAME_SIZE_MAX(ch_num, samples),
+                   "frame: loop %u size %u for %u x %u", loop, size, ch_num, samples);
+        TEST_CHECK(Test_Name, Guard_Intact(RC_FRAME_SIZE_MAX(ch_num, samples)), "frame: loop %u wrote past cap", loop);
+        TEST_CHECK(Test_Name, RC_decodeFrame(Out, size, ch_num, samples, Decoded) == true, "frame: loop %u decode failed", loop);
+        for(uint32_t i = 0; i < samples; i++)
+        {
+            for(uint32_t ch = 0; ch < ch_num; ch++)
+            {
+                TEST_CHECK(Test_Name, Decoded[i * ch_num + ch] == Pcm[ch][i], "frame: loop %u ch%u sample %u %d expect %d",
+                           loop, ch, i, Decoded[i * ch_num + ch], Pcm[ch][i]);
+            }
+        }
+        pcm_bytes += ch_num * samples * 2U;
+        coded_bytes += size;
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"frame\",\"frames\":%u,\"ratio\":%.3f}\n",
+           Test_Name, frames, (double)pcm_bytes / (double)coded_bytes);
+}
+
+/**
+ * [Test_Channels 各通道点数不同的往返]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Channels(uint32_t *seed, uint32_t frames)
+{
+    const int16_t *channels[RC_CHANNEL_MAX];
+    uint16_t samples[RC_CHANNEL_MAX];
+    uint32_t ch_num = 0;
+    uint32_t size = 0;
+    uint32_t offset = 0;
+
+    for(uint32_t loop = 0; loop < frames; loop++)
+    {
+        ch_num = 1U + Test_Rand_Range(seed, RC_CHANNEL_MAX);
+        for(uint32_t ch = 0; ch < ch_num; ch++)
+        {
+            /*与分通道抽取一致：128点除以2的幂，或任意点数*/
+            samples[ch] = (uint16_t)((Test_Rand_Range(seed, 2U) == 0U)?(128U >> Test_Rand_Range(seed, 7U)):Random_Samples(seed));
+            Fill_Signal(seed, (SIGNAL_TypeDef)Test_Rand_Range(seed, SIGNAL_NUM), Pcm[ch], samples[ch]);
+            channels[ch] = Pcm[ch];
+        }
+        memset(Out, GUARD_BYTE, sizeof(Out));
+        size = RC_encodeChannels(channels, samples, ch_num, Out, RC_FRAME_SIZE_MAX(ch_num, SAMPLES_MAX));
+        TEST_CHECK(Test_Name, size > 0U && (size & 3U) == 0U, "channels: loop %u size %u", loop, size);
+        TEST_CHECK(Test_Name, RC_decodeChannels(Out, size, samples, ch_num, Decoded) == true, "channels: loop %u decode failed", loop);
+        offset = 0;
+        for(uint32_t ch = 0; ch < ch_num; ch++)
+        {
+            TEST_CHECK(Test_Name, memcmp(Decoded + offset, Pcm[ch], samples[ch] * sizeof(int16_t)) == 0,
+                       "channels: loop %u ch%u of %u samples mismatch", loop, ch, samples[ch]);
+            offset += samples[ch];
+        }
+    }
+    samples[0] = 0;
+    TEST_CHECK(Test_Name, RC_encodeChannels(channels, samples, 1, Out, sizeof(Out)) == 0U, "channels: zero samples accepted");
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"channels\",\"frames\":%u}\n", Test_Name, frames);
+}
+
+/**
+ * [Test_Cap 输出区不足、截断及位翻转]
+ * @param seed   [随机数状态]
+ * @param frames [帧数]
+ */
+static void Test_Cap(uint32_t *seed, uint32_t frames)
+{
+    const int16_t *channels[RC_CHANNEL_MAX];
+    uint32_t ch_num = 0;
+    uint32_t samples = 0;
+    uint32_t size = 0;
+    uint32_t cap = 0;
+    uint32_t flips = 0;
+
+    for(uint32_t loop = 0; loop < frames; loop++)
+    {
+        ch_num = 1U + Test_Rand_Range(seed, RC_CHANNEL_MAX);
+        samples = 4U + Test_Rand_Range(seed, SAMPLES_MAX - 3U);
+        for(uint32_t ch = 0; ch < ch_num; ch++)
+        {
+            Fill_Signal(seed, (SIGNAL_TypeDef)Test_Rand_Range(seed, SIGNAL_NUM), Pcm[ch], samples);
+            channels[ch] = Pcm[ch];
+        }
+        size = RC_encodeFrame(channels, ch_num, samples, Out, sizeof(Out));
+        TEST_CHECK(Test_Name, size > 0U, "cap: loop %u encode failed", loop);
+
+        /*输出区小于编码长度*/
+        cap = Test_Rand_Range(seed, size);
+        memset(Out, GUARD_BYTE, sizeof(Out));
+        TEST_CHECK(Test_Name, RC_encodeFrame(channels, ch_num, samples, Out, cap) == 0U, "cap: loop %u cap %u of %u accepted", loop, cap, size);
+        TEST_CHECK(Test_Name, Guard_Intact(cap), "cap: loop %u wrote past cap %u", loop, cap);
+
+        /*末4字节内必有数据位，截断后须解码失败*/
+        size = RC_encodeFrame(channels, ch_num, samples, Out, sizeof(Out));
+        TEST_CHECK(Test_Name, RC_decodeFrame(Out, size - 4U, ch_num, samples, Decoded) == false,
+                   "cap: loop %u truncated frame decoded", loop);
+
+        /*位翻转后结果不定，仅要求不越界、不停滞*/
+        Out[Test_Rand_Range(seed, size)] ^= (uint8_t)(1U << Test_Rand_Range(seed, 8U));
+        flips += (RC_decodeFrame(Out, size, ch_num, samples, Decoded) == false)?1U:0U;
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"cap\",\"frames\":%u,\"flip_rejected\":%u}\n",
+           Test_Name, frames, flips);
+}
+
+/**
+ * [main 依次运行各组]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t seed = Test_Arg_U32(argc, argv, 1, 0x2C0DEC01U);
+    uint32_t frames = Test_Arg_U32(argc, argv, 2, 20000U);
+
+    Test_Frame(&seed, frames);
+    Test_Channels(&seed, frames);
+    Test_Cap(&seed, frames / 4U + 1U);
+    return 0;
+}
+/******************************** End of file *********************************/
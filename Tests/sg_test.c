@@ -0,0 +1,245 @@
+/**
+ *  @file sg_test.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 信号发生器(SG_xx)MLS周期及扫频终止频率测试
+ *
+ *  @details 用法: sg_test
+ *           1、mls：阶数2至20，LFSR状态恰在2^order-1点后首次回到初值，正幅度点比负幅度点多一个，
+ *              阶数不超过MLS_CHECK_ORDER时第二周期逐点重复，循环自相关除零延迟外均为-1
+ *           2、chirp：线性及对数、升频及降频，最后一点的相位增量对应终止频率(误差不超过STEP_ERR_MAX)，
+ *              末尾CHIRP_WINDOW点过零测频与扫频规律在该段中点的频率相差不超过ZC_ERR_MAX，
+ *              扫完后增量回到起始频率
+ *           每组结果输出一行JSON
+ *
+ *  @version V1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include "SignalGen.h"
+#include "Test_Common.h"
+/** Private includes ---------------------------------------------------------*/
+
+/** Private defines ----------------------------------------------------------*/
+#define SAMPLE_RATE         16000U
+#define MLS_CHECK_ORDER     12U     /**< 逐点重复及自相关校验的最高阶数*/
+#define MLS_BUF_SIZE        ((1U << MLS_CHECK_ORDER) - 1U)
+#define CHIRP_LENGTH_MAX    32000U
+#define CHIRP_WINDOW        320U    /**< 过零测频窗长，20ms*/
+#define STEP_ERR_MAX        0.002   /**< 终止频率相对误差*/
+#define ZC_ERR_MAX          0.01    /**< 过零测频相对误差*/
+
+/** Private typedef ----------------------------------------------------------*/
+/*扫频用例*/
+typedef struct
+{
+    float freq_start;
+    float freq_end;
+    uint32_t length;
+    bool log;
+}CHIRP_CaseTypeDef;
+
+/** Private constants --------------------------------------------------------*/
+static const CHIRP_CaseTypeDef Chirp_Case[] =
+{
+    {100.f, 4000.f, 16000U, false},
+    {4000.f, 100.f, 8000U, false},
+    {20.f, 4000.f, 16000U, true},
+    {6000.f, 200.f, 32000U, true},
+};
+
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static const char *Test_Name = "sg_test";
+static int16_t Buf[CHIRP_LENGTH_MAX];
+static int16_t Mls_Buf[2][MLS_BUF_SIZE];
+
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Test_Mls 各阶MLS周期、平衡性及自相关]
+ */
+static void Test_Mls(void)
+{
+    SG_HandleTypeDef sg;
+    int16_t out = 0;
+    uint32_t period = 0;
+    uint32_t state = 0;
+    uint32_t count = 0;
+    int32_t high = 0;
+    int64_t corr = 0;
+
+    for(uint32_t order = SG_MLS_ORDER_MIN; order <= SG_MLS_ORDER_MAX; order++)
+    {
+        period = (1U << order) - 1U;
+        SG_init(&sg, SAMPLE_RATE, NULL);
+        TEST_CHECK(Test_Name, SG_setMls(&sg, (uint8_t)order, -6.f) == true, "mls: order %u rejected", order);
+        state = sg.u.mls.state;
+        high = 0;
+        for(count = 1; count <= period; count++)
+        {
+            SG_render(&sg, &out, 1, 1);
+            TEST_CHECK(Test_Name, out == sg.gain || out == -sg.gain, "mls: order %u sample %d", order, out);
+            high += (out > 0)?1:0;
+            if(count <= MLS_BUF_SIZE)
+            {
+                Mls_Buf[0][count - 1U] = out;
+            }
+            if(sg.u.mls.state == state)
+            {
+                break;
+            }
+        }
+        TEST_CHECK(Test_Name, count == period, "mls: order %u period %u expect %u", order, count, period);
+        TEST_CHECK(Test_Name, high == (int32_t)(1U << (order - 1U)), "mls: order %u ones %d expect %u", order, high, 1U << (order - 1U));
+
+        if(order > MLS_CHECK_ORDER)
+        {
+            continue;
+        }
+        /*第二周期逐点重复*/
+        SG_render(&sg, Mls_Buf[1], 1, period);
+        TEST_CHECK(Test_Name, memcmp(Mls_Buf[0], Mls_Buf[1], period * sizeof(int16_t)) == 0, "mls: order %u not periodic", order);
+        /*循环自相关，±1序列零延迟为period，其余为-1*/
+        for(uint32_t lag = 0; lag < period; lag++)
+        {
+            corr = 0;
+            for(uint32_t i = 0; i < period; i++)
+            {
+                corr += (Mls_Buf[0][i] > 0 ? 1 : -1) * (Mls_Buf[0][(i + lag) % period] > 0 ? 1 : -1);
+            }
+            TEST_CHECK(Test_Name, corr == ((lag == 0U)?(int64_t)period:-1), "mls: order %u lag %u autocorrelation %lld",
+                       order, lag, (long long)corr);
+        }
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"mls\",\"order_min\":%u,\"order_max\":%u}\n",
+           Test_Name, SG_MLS_ORDER_MIN, SG_MLS_ORDER_MAX);
+}
+
+/**
+ * [Chirp_Freq_At 扫频规律在第n点的频率]
+ * @param  c [用例]
+ * @param  n [点序号，可为小数]
+ * @return   [频率Hz]
+ */
+static double Chirp_Freq_At(const CHIRP_CaseTypeDef *c, double n)
+{
+    double t = n / (double)(c->length - 1U);
+
+    if(c->log == true)
+    {
+        return c->freq_start * pow((double)c->freq_end / c->freq_start, t);
+    }
+    return c->freq_start + ((double)c->freq_end - c->freq_start) * t;
+}
+
+/**
+ * [Zero_Cross_Freq 过零测频，过零位置线性插值]
+ * @param  data    [数据]
+ * @param  samples [点数]
+ * @param  mid     [输出首末过零点中点位置]
+ * @return         [频率Hz，过零不足两次返回0]
+ */
+static double Zero_Cross_Freq(const int16_t *data, uint32_t samples, double *mid)
+{
+    double first = -1;
+    double last = -1;
+    double pos = 0;
+    uint32_t cross = 0;
+
+    for(uint32_t i = 1; i < samples; i++)
+    {
+        if((data[i - 1U] < 0 && data[i] >= 0) || (data[i - 1U] >= 0 && data[i] < 0))
+        {
+            pos = (double)(i - 1U) + (double)data[i - 1U] / ((double)data[i - 1U] - data[i]);
+            first = (cross == 0U)?pos:first;
+            last = pos;
+            cross++;
+        }
+    }
+    if(cross < 2U)
+    {
+        return 0;
+    }
+    *mid = (first + last) * 0.5;
+    return (double)(cross - 1U) * 0.5 * SAMPLE_RATE / (last - first);
+}
+
+/**
+ * [Test_Chirp 扫频终止频率]
+ */
+static void Test_Chirp(void)
+{
+    SG_HandleTypeDef sg;
+    const CHIRP_CaseTypeDef *c = NULL;
+    uint32_t step_start = 0;
+    double end_freq = 0;
+    double err = 0;
+    double max_step_err = 0;
+    double max_zc_err = 0;
+    double zc_freq = 0;
+    double mid = 0;
+    double expect = 0;
+
+    for(uint32_t n = 0; n < sizeof(Chirp_Case) / sizeof(Chirp_Case[0]); n++)
+    {
+        c = &Chirp_Case[n];
+        SG_init(&sg, SAMPLE_RATE, NULL);
+        TEST_CHECK(Test_Name, SG_setChirp(&sg, c->freq_start, c->freq_end, c->length, c->log, -1.f) == true,
+                   "chirp: case %u rejected", n);
+        step_start = sg.u.chirp.step;
+
+        /*生成至最后一点之前，此时增量即最后一点的频率*/
+        SG_render(&sg, Buf, 1, c->length - 1U);
+        end_freq = (double)sg.u.chirp.step * SAMPLE_RATE / 4294967296.0;
+        err = fabs(end_freq - c->freq_end) / c->freq_end;
+        max_step_err = (err > max_step_err)?err:max_step_err;
+        TEST_CHECK(Test_Name, err <= STEP_ERR_MAX, "chirp: case %u end %.2f Hz expect %.2f", n, end_freq, c->freq_end);
+
+        SG_render(&sg, &Buf[c->length - 1U], 1, 1);
+        TEST_CHECK(Test_Name, sg.u.chirp.step == step_start && sg.u.chirp.count == 0U, "chirp: case %u did not restart", n);
+
+        /*末段过零测频*/
+        zc_freq = Zero_Cross_Freq(&Buf[c->length - CHIRP_WINDOW], CHIRP_WINDOW, &mid);
+        expect = Chirp_Freq_At(c, (double)(c->length - CHIRP_WINDOW) + mid);
+        err = fabs(zc_freq - expect) / expect;
+        max_zc_err = (err > max_zc_err)?err:max_zc_err;
+        TEST_CHECK(Test_Name, err <= ZC_ERR_MAX, "chirp: case %u zero crossing %.2f Hz expect %.2f", n, zc_freq, expect);
+    }
+    printf("{\"test\":\"%s\",\"result\":\"pass\",\"case\":\"chirp\",\"cases\":%u,\"max_end_err\":%.6f,\"max_zc_err\":%.6f}\n",
+           Test_Name, (unsigned)(sizeof(Chirp_Case) / sizeof(Chirp_Case[0])), max_step_err, max_zc_err);
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [main 依次运行各组测试]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    Test_Mls();
+    Test_Chirp();
+    return 0;
+}
+/******************************** End of file *********************************/
@@ -0,0 +1,270 @@
+/**
+ *  @file af_wav.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 调试音频帧解码为WAV文件(PC端)
+ *
+ *  @details 用法: af_wav <输入文件|-> <输出前缀> [原始采样率，缺省16000]
+ *           1、输入为串口或USB抓取的原始字节流，帧格式见AudioFrame.h，支持PCM、RICE及IMA-ADPCM
+ *           2、每个来源通道输出一个单声道WAV：<输出前缀>_ch<n>.wav，n为channel_map中的通道号，
+ *              采样率为原始采样率除以帧头decimation及该通道分频
+ *           3、同一通道采样率改变(如adpcm 16k切换为8k)时结束当前文件，另起<输出前缀>_ch<n>_<k>.wav
+ *           4、样点计数跳增时按丢失点数补零，保持时间轴连续，单次补零不超过AF_WAV_GAP_MAX秒
+ *           5、结束时在stderr输出解码统计
+ *           编译: make -C Tools
+ *
+ *  @version v1.0
+ */
+/** Includes -----------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+/* Private includes ----------------------------------------------------------*/
+#include "AudioFrame.h"
+/** Private typedef ----------------------------------------------------------*/
+/*单通道输出文件*/
+typedef struct
+{
+    FILE *fp;
+    uint32_t sample_rate;
+    uint32_t data_bytes;
+    uint32_t expect_counter;    /**< 下一帧期望的样点计数，未分频*/
+    uint32_t part;              /**< 同一通道的文件序号*/
+}WAV_OutTypeDef;
+
+/*解码上下文*/
+typedef struct
+{
+    const char *prefix;
+    uint32_t base_rate;
+    WAV_OutTypeDef out[16];     /**< 按channel_map位号索引*/
+}WAV_ContextTypeDef;
+/** Private macros -----------------------------------------------------------*/
+#define AF_WAV_GAP_MAX          10U     /**< 单次补零上限，秒*/
+#define AF_WAV_READ_SIZE        4096U
+/** Private constants --------------------------------------------------------*/
+static const char *const Event_Name[] = {"gap", "repeat", "crc_error", "resync", "decode_error"};
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [Wav_Close 回写WAV文件头并关闭]
+ * @param out [输出文件]
+ */
+static void Wav_Close(WAV_OutTypeDef *out)
+{
+    uint8_t header[AF_WAV_HEADER_SIZE];
+
+    if(out->fp == NULL)
+    {
+        return;
+    }
+    AF_wavHeader(header, 1, out->sample_rate, out->data_bytes);
+    fseek(out->fp, 0, SEEK_SET);
+    fwrite(header, 1, sizeof(header), out->fp);
+    fclose(out->fp);
+    out->fp = NULL;
+}
+
+/**
+ * [Wav_Open 打开通道输出文件，采样率改变时另起文件]
+ * @param  ctx         [上下文]
+ * @param  ch          [来源通道号]
+ * @param  sample_rate [采样率]
+ * @return             [输出文件，失败返回NULL]
+ */
+static WAV_OutTypeDef *Wav_Open(WAV_ContextTypeDef *ctx, uint32_t ch, uint32_t sample_rate)
+{
+    WAV_OutTypeDef *out = &ctx->out[ch];
+    uint8_t header[AF_WAV_HEADER_SIZE] = {0};
+    char name[512];
+
+    if(out->fp != NULL && out->sample_rate == sample_rate)
+    {
+        return out;
+    }
+    if(out->fp != NULL)
+    {
+        Wav_Close(out);
+        out->part++;
+    }
+    if(out->part == 0U)
+    {
+        snprintf(name, sizeof(name), "%s_ch%u.wav", ctx->prefix, (unsigned)ch);
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "%s_ch%u_%u.wav", ctx->prefix, (unsigned)ch, (unsigned)out->part);
+    }
+    out->fp = fopen(name, "wb");
+    if(out->fp == NULL)
+    {
+        perror(name);
+        return NULL;
+    }
+    /*文件头占位，关闭时回写长度*/
+    fwrite(header, 1, sizeof(header), out->fp);
+    out->sample_rate = sample_rate;
+    out->data_bytes = 0;
+    out->expect_counter = 0;
+    fprintf(stderr, "%s: %u Hz\n", name, (unsigned)sample_rate);
+    return out;
+}
+
+/**
+ * [Wav_Write 写入一个通道的数据，计数跳增时先补零]
+ * @param out     [输出文件]
+ * @param header  [帧头]
+ * @param factor  [该通道分频]
+ * @param data    [小端int16数据]
+ * @param stride  [点间隔，字节]
+ * @param samples [点数]
+ */
+static void Wav_Write(WAV_OutTypeDef *out, const AF_HeaderTypeDef *header, uint32_t factor,
+                      const uint8_t *data, uint32_t stride, uint32_t samples)
+{
+    static const uint8_t zero[2] = {0, 0};
+    int32_t diff = (int32_t)(header->sample_counter - out->expect_counter);
+    uint32_t fill = 0;
+
+    if(out->data_bytes > 0U && diff > 0)
+    {
+        fill = (uint32_t)diff / factor;
+        fill = (fill > out->sample_rate * AF_WAV_GAP_MAX)?out->sample_rate * AF_WAV_GAP_MAX:fill;
+        for(uint32_t i = 0; i < fill; i++)
+        {
+            fwrite(zero, 1, sizeof(zero), out->fp);
+        }
+        out->data_bytes += fill * 2U;
+    }
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        fwrite(data + i * stride, 1, 2, out->fp);
+    }
+    out->data_bytes += samples * 2U;
+    out->expect_counter = header->sample_counter + header->frame_samples;
+}
+
+/**
+ * [On_Frame 正确帧回调，按来源通道拆分写入]
+ * @param header [帧头]
+ * @param data   [小端int16数据]
+ * @param user   [上下文]
+ */
+static void On_Frame(const AF_HeaderTypeDef *header, const uint8_t *data, void *user)
+{
+    WAV_ContextTypeDef *ctx = (WAV_ContextTypeDef *)user;
+    uint32_t decimation = (header->decimation == 0U)?1U:header->decimation;
+    bool planar = (header->header_size == AF_HEADER_SIZE_MAX);
+    uint32_t offset = 0;
+    uint32_t bit = 0;
+    WAV_OutTypeDef *out = NULL;
+
+    for(uint32_t n = 0; n < header->channel_number; n++)
+    {
+        uint32_t factor = (n < AF_CHANNEL_MAX && header->channel_decimation[n] != 0U)?header->channel_decimation[n]:1U;
+        uint32_t samples = AF_channelSamples(header, n);
+
+        /*第n路数据对应channel_map中第n个置位，无对应位时按序号*/
+        while(bit < 16U && (header->channel_map & (1U << bit)) == 0U)
+        {
+            bit++;
+        }
+        out = Wav_Open(ctx, (bit < 16U)?bit:(n & 15U), ctx->base_rate / (decimation * factor));
+        if(out != NULL)
+        {
+            if(planar == true)
+            {
+                Wav_Write(out, header, factor, data + offset, 2U, samples);
+            }
+            else
+            {
+                Wav_Write(out, header, factor, data + n * 2U, header->channel_number * 2U, samples);
+            }
+        }
+        offset += samples * 2U;
+        bit++;
+    }
+}
+
+/**
+ * [On_Event 解码事件回调]
+ * @param event [事件]
+ * @param value [参数]
+ * @param user  [上下文]
+ */
+static void On_Event(AF_EVENT_ENUM_TypeDef event, uint32_t value, void *user)
+{
+    (void)user;
+    fprintf(stderr, "%s %u\n", Event_Name[event], (unsigned)value);
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [main 读取字节流解码并写WAV]
+ * @param  argc [参数个数]
+ * @param  argv [参数]
+ * @return      [0成功]
+ */
+int main(int argc, char **argv)
+{
+    static AF_DecoderTypeDef dec;
+    static WAV_ContextTypeDef ctx;
+    uint8_t buf[AF_WAV_READ_SIZE];
+    const AF_StatsTypeDef *stats = NULL;
+    FILE *in = NULL;
+    size_t len = 0;
+
+    if(argc < 3)
+    {
+        fprintf(stderr, "usage: %s <input|-> <output prefix> [sample rate, default 16000]\n", argv[0]);
+        return 2;
+    }
+    in = (strcmp(argv[1], "-") == 0)?stdin:fopen(argv[1], "rb");
+    if(in == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    ctx.prefix = argv[2];
+    ctx.base_rate = (argc > 3)?(uint32_t)strtoul(argv[3], NULL, 0):16000U;
+
+    AF_decoderInit(&dec, On_Frame, On_Event, &ctx);
+    while((len = fread(buf, 1, sizeof(buf), in)) > 0U)
+    {
+        AF_decoderPush(&dec, buf, (uint32_t)len);
+    }
+    if(in != stdin)
+    {
+        fclose(in);
+    }
+    for(uint32_t ch = 0; ch < sizeof(ctx.out) / sizeof(ctx.out[0]); ch++)
+    {
+        Wav_Close(&ctx.out[ch]);
+    }
+
+    stats = AF_decoderGetStats(&dec);
+    fprintf(stderr, "frames %u, gaps %u (%u samples), repeats %u, crc errors %u, decode errors %u, skipped %u bytes\n",
+            (unsigned)stats->frames, (unsigned)stats->gaps, (unsigned)stats->gap_samples, (unsigned)stats->repeats,
+            (unsigned)stats->crc_errors, (unsigned)stats->decode_errors, (unsigned)stats->skipped_bytes);
+    return 0;
+}
+/******************************** End of file *********************************/
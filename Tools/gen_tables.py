@@ -0,0 +1,372 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@file gen_tables.py
+
+@date 2026-10-17
+
+@author aron566
+
+@brief 生成Utilities/DspTables.c/.h：电平表、窗函数、Mel滤波器组、双二阶滤波器及半带FIR系数
+
+@details 1、仅依赖Python标准库，以双精度计算后量化为Q15/Q31/f32，结果与主机无关，
+            生成文件随工程提交，主机仿真与目标板使用同一份常量表.
+         2、修改参数后执行：python3 Tools/gen_tables.py [输出目录]，在仓库根目录外执行亦可，
+            缺省输出至Utilities；Tests下make test输出至临时目录并与已提交文件比对.
+         3、正弦表使用CMSIS-DSP的sinTable_q15/sinTable_q31/sinTable_f32，不再重复生成.
+
+@version v1.0
+"""
+import math
+import os
+import struct
+import sys
+
+# 参数
+SAMPLE_RATE = 16000
+FFT_SIZE = 512              # 窗长及Mel滤波器组FFT点数
+MEL_BANDS = 40
+MEL_FREQ_LOW = 20.0
+MEL_FREQ_HIGH = 8000.0
+DB_GAIN_MIN = 120           # 电平表范围0至-DB_GAIN_MIN dB，步进1dB，另有0.1dB细分表
+HPF_FREQ = 20.0             # 隔直高通截止频率
+HALFBAND_TAPS = 47
+HALFBAND_BETA = 5.65
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+OUT_DIR = os.path.join(ROOT, "Utilities")
+
+
+# 量化
+def q15(x):
+    return max(-32768, min(32767, int(round(x * 32768.0))))
+
+
+def q31(x):
+    return max(-2147483648, min(2147483647, int(round(x * 2147483648.0))))
+
+
+def f32(x):
+    x = struct.unpack("<f", struct.pack("<f", x))[0]
+    s = "%.9g" % x
+    if "." not in s and "e" not in s:
+        s += "."
+    return s + "f"
+
+
+def fmt_q31(x):
+    # INT32_MIN不可直接书写为字面量
+    return "(-2147483647-1)" if x == -2147483648 else str(x)
+
+
+# 窗函数，周期形式，用于分帧FFT
+def hann(n):
+    return [0.5 - 0.5 * math.cos(2.0 * math.pi * i / n) for i in range(n)]
+
+
+def blackman(n):
+    return [0.42 - 0.5 * math.cos(2.0 * math.pi * i / n) + 0.08 * math.cos(4.0 * math.pi * i / n) for i in range(n)]
+
+
+# Mel滤波器组，HTK刻度，三角形峰值为1，按各频点中心频率取值
+def hz_to_mel(f):
+    return 2595.0 * math.log10(1.0 + f / 700.0)
+
+
+def mel_to_hz(m):
+    return 700.0 * (10.0 ** (m / 2595.0) - 1.0)
+
+
+def mel_bank():
+    lo = hz_to_mel(MEL_FREQ_LOW)
+    hi = hz_to_mel(MEL_FREQ_HIGH)
+    edge = [mel_to_hz(lo + (hi - lo) * i / (MEL_BANDS + 1)) for i in range(MEL_BANDS + 2)]
+    bands = []
+    for b in range(MEL_BANDS):
+        left, center, right = edge[b], edge[b + 1], edge[b + 2]
+        weights = []
+        first = None
+        for k in range(FFT_SIZE // 2 + 1):
+            f = k * SAMPLE_RATE / FFT_SIZE
+            if left < f < right:
+                w = (f - left) / (center - left) if f <= center else (right - f) / (right - center)
+                if first is None:
+                    first = k
+                weights.append(w)
+        if first is None:
+            raise SystemExit("mel band %d has no FFT bin, reduce MEL_BANDS or raise FFT_SIZE" % b)
+        bands.append((first, weights))
+    return bands
+
+
+# 双二阶滤波器，返回[(b0, b1, b2, a1, a2)]，a0已归一
+def rbj_highpass(f0, q):
+    w0 = 2.0 * math.pi * f0 / SAMPLE_RATE
+    alpha = math.sin(w0) / (2.0 * q)
+    cw = math.cos(w0)
+    a0 = 1.0 + alpha
+    return [((1.0 + cw) / 2.0 / a0, -(1.0 + cw) / a0, (1.0 + cw) / 2.0 / a0, -2.0 * cw / a0, (1.0 - alpha) / a0)]
+
+
+def bilinear_pole(f):
+    # s = -2*pi*f映射至z平面
+    k = 2.0 * SAMPLE_RATE
+    s = -2.0 * math.pi * f
+    return (k + s) / (k - s)
+
+
+def biquad_response(sections, f):
+    z = complex(math.cos(2.0 * math.pi * f / SAMPLE_RATE), math.sin(2.0 * math.pi * f / SAMPLE_RATE))
+    h = 1.0
+    for b0, b1, b2, a1, a2 in sections:
+        h *= (b0 + b1 / z + b2 / z / z) / (1.0 + a1 / z + a2 / z / z)
+    return abs(h)
+
+
+A_WEIGHT_POLES = (20.598997, 107.65265, 737.86223, 12194.217)
+A_WEIGHT_CHECK = (31.5, 63.0, 125.0, 250.0, 500.0, 1000.0, 2000.0, 4000.0, 6300.0, 7000.0)
+
+
+def a_weighting_db(f):
+    # IEC 61672解析式
+    f1, f2, f3, f4 = A_WEIGHT_POLES
+    ff = f * f
+    h = f4 * f4 * ff * ff / ((ff + f1 * f1) * math.sqrt((ff + f2 * f2) * (ff + f3 * f3)) * (ff + f4 * f4))
+    return 20.0 * math.log10(h) - 20.0 * math.log10(a_weighting_ref())
+
+
+def a_weighting_ref():
+    f1, f2, f3, f4 = A_WEIGHT_POLES
+    ff = 1000.0 * 1000.0
+    return f4 * f4 * ff * ff / ((ff + f1 * f1) * math.sqrt((ff + f2 * f2) * (ff + f3 * f3)) * (ff + f4 * f4))
+
+
+def a_weighting_sections(a):
+    p1, p2, p3 = (bilinear_pole(f) for f in A_WEIGHT_POLES[:3])
+    sections = [
+        [1.0, a, 0.0, 0.0, 0.0],
+        [1.0, -2.0, 1.0, -2.0 * p1, p1 * p1],
+        [1.0, -2.0, 1.0, -(p2 + p3), p2 * p3],
+    ]
+    g = 1.0 / biquad_response(sections, 1000.0)
+    sections[0] = [c * g if i < 3 else c for i, c in enumerate(sections[0])]
+    return [tuple(s) for s in sections]
+
+
+def a_weighting_error(sections):
+    return max(abs(20.0 * math.log10(biquad_response(sections, f)) - a_weighting_db(f)) for f in A_WEIGHT_CHECK)
+
+
+def a_weighting():
+    # 低频三个极点双线性变换；12194Hz极点对高于奈奎斯特频率，以一阶FIR项(1 + a*z^-1)拟合，1kHz归一为0dB
+    best = min(range(-600, 601), key=lambda k: a_weighting_error(a_weighting_sections(k / 1000.0)))
+    return a_weighting_sections(best / 1000.0)
+
+
+def cmsis_biquad(sections):
+    # CMSIS DF1顺序{b0, b1, b2, -a1, -a2}，加0.0避免输出-0
+    coeffs = []
+    for b0, b1, b2, a1, a2 in sections:
+        coeffs += [b0, b1, b2, 0.0 - a1, 0.0 - a2]
+    shift = 0
+    while max(abs(c) for c in coeffs) / (1 << shift) >= 1.0:
+        shift += 1
+    return coeffs, shift
+
+
+# 半带低通，Kaiser窗，中心抽头固定为0.5
+def bessel_i0(x):
+    s = t = 1.0
+    k = 1
+    while t > 1e-12 * s:
+        t *= (x / 2.0 / k) ** 2
+        s += t
+        k += 1
+    return s
+
+
+def halfband():
+    m = HALFBAND_TAPS - 1
+    h = []
+    for i in range(HALFBAND_TAPS):
+        n = i - m / 2.0
+        ideal = 0.5 if n == 0 else math.sin(math.pi * n / 2.0) / (math.pi * n)
+        w = bessel_i0(HALFBAND_BETA * math.sqrt(max(0.0, 1.0 - (2.0 * i / m - 1.0) ** 2))) / bessel_i0(HALFBAND_BETA)
+        h.append(ideal * w)
+    s = sum(h)
+    h = [x / s for x in h]
+    h[m // 2] = 0.5
+    return h
+
+
+# 输出
+def c_array(ctype, name, values, per_line, width=0):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v).rjust(width) for v in values[i:i + per_line]))
+    return "const %s %s[%d] =\n{\n%s\n};\n" % (ctype, name, len(values), ",\n".join(lines))
+
+
+def main(out_dir):
+    db_int = [q31(10.0 ** (-k / 20.0)) for k in range(DB_GAIN_MIN + 1)]
+    db_frac = [q31(10.0 ** (-k / 200.0)) for k in range(10)]
+    windows = [("Hann", hann(FFT_SIZE)), ("Blackman", blackman(FFT_SIZE))]
+    bands = mel_bank()
+    mel_weights = [w for _, ws in bands for w in ws]
+    hpf, hpf_shift = cmsis_biquad(rbj_highpass(HPF_FREQ, 1.0 / math.sqrt(2.0)))
+    a_sections = a_weighting()
+    aw, aw_shift = cmsis_biquad(a_sections)
+    hb = [q15(x) for x in halfband()]
+
+    body = []
+    body.append("/*电平表：10^(-k/20)，k为0至%d dB*/\n" % DB_GAIN_MIN)
+    body.append(c_array("q31_t", "DT_Db_Gain_q31", [fmt_q31(v) for v in db_int], 6, 11))
+    body.append("\n/*电平细分表：10^(-k/200)，k为0至9，即0至-0.9dB*/\n")
+    body.append(c_array("q31_t", "DT_Db_Gain_Frac_q31", [fmt_q31(v) for v in db_frac], 5, 11))
+    for name, w in windows:
+        body.append("\n/*%s窗，周期形式，%d点*/\n" % (name, FFT_SIZE))
+        body.append(c_array("q15_t", "DT_%s_q15" % name, [q15(x) for x in w], 12, 6))
+        body.append("\n")
+        body.append(c_array("q31_t", "DT_%s_q31" % name, [fmt_q31(q31(x)) for x in w], 6, 11))
+        body.append("\n")
+        body.append(c_array("float32_t", "DT_%s_f32" % name, [f32(x) for x in w], 6, 15))
+    body.append("\n/*Mel滤波器组：%d带，%g-%gHz，%d点FFT，各带权重依次存放于DT_Mel_Weight*/\n"
+                % (MEL_BANDS, MEL_FREQ_LOW, MEL_FREQ_HIGH, FFT_SIZE))
+    body.append("const DT_MelBandTypeDef DT_Mel_Band[%d] =\n{\n" % MEL_BANDS)
+    offset = 0
+    rows = []
+    for first, ws in bands:
+        rows.append("    {%3d, %2d, %3d}" % (first, len(ws), offset))
+        offset += len(ws)
+    body.append(",\n".join(rows) + "\n};\n\n")
+    body.append(c_array("q15_t", "DT_Mel_Weight_q15", [q15(x) for x in mel_weights], 12, 6))
+    body.append("\n")
+    body.append(c_array("float32_t", "DT_Mel_Weight_f32", [f32(x) for x in mel_weights], 6, 15))
+    body.append("\n/*隔直高通：%gHz二阶Butterworth*/\n" % HPF_FREQ)
+    body.append(c_array("float32_t", "DT_Biquad_Hpf_f32", [f32(x) for x in hpf], 5, 15))
+    body.append("\n")
+    body.append(c_array("q31_t", "DT_Biquad_Hpf_q31", [fmt_q31(q31(x / (1 << hpf_shift))) for x in hpf], 5, 11))
+    body.append("\n/*A计权：3级，1kHz为0dB，%g-%gHz与IEC 61672偏差不超过%.2fdB*/\n"
+                % (A_WEIGHT_CHECK[0], A_WEIGHT_CHECK[-1], a_weighting_error(a_sections)))
+    body.append(c_array("float32_t", "DT_Biquad_A_Weight_f32", [f32(x) for x in aw], 5, 15))
+    body.append("\n")
+    body.append(c_array("q31_t", "DT_Biquad_A_Weight_q31", [fmt_q31(q31(x / (1 << aw_shift))) for x in aw], 5, 11))
+    body.append("\n/*半带低通，Kaiser窗(beta %g)，直流增益1，中心抽头0.5*/\n" % HALFBAND_BETA)
+    body.append(c_array("q15_t", "DT_Halfband_q15", hb, 12, 6))
+
+    header = HEADER_H.format(
+        fft=FFT_SIZE, bands=MEL_BANDS, weights=len(mel_weights), rate=SAMPLE_RATE, db=DB_GAIN_MIN,
+        hpf_shift=hpf_shift, aw_shift=aw_shift, taps=HALFBAND_TAPS)
+    source = HEADER_C + "".join(body) + FOOTER_C
+    os.makedirs(out_dir, exist_ok=True)
+    for name, text in (("DspTables.h", header), ("DspTables.c", source)):
+        with open(os.path.join(out_dir, name), "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+
+
+HEADER_H = """/**
+ *  @file DspTables.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 常量表：电平、窗函数、Mel滤波器组、双二阶滤波器及半带FIR系数
+ *
+ *  @details 由Tools/gen_tables.py生成，勿手工修改；正弦表使用CMSIS-DSP的sinTable_q15等
+ *
+ *  @version v1.0
+ */
+#ifndef DSPTABLES_H_
+#define DSPTABLES_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {{
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+/** Private includes ---------------------------------------------------------*/
+#include "arm_math.h"
+/** Private defines ----------------------------------------------------------*/
+#define DT_SAMPLE_RATE              {rate}U   /**< 滤波器组及滤波器设计采样率*/
+#define DT_FFT_SIZE                 {fft}U     /**< 窗长及Mel滤波器组FFT点数*/
+#define DT_MEL_BANDS                {bands}U
+#define DT_MEL_WEIGHT_NUM           {weights}U
+#define DT_DB_GAIN_MIN              {db}U     /**< 电平表下限-dB*/
+#define DT_BIQUAD_HPF_STAGES        1U
+#define DT_BIQUAD_HPF_POST_SHIFT    {hpf_shift}U       /**< q31系数右移位数，用于arm_biquad_cascade_df1_init_q31*/
+#define DT_BIQUAD_A_WEIGHT_STAGES   3U
+#define DT_BIQUAD_A_WEIGHT_POST_SHIFT {aw_shift}U
+#define DT_HALFBAND_TAPS            {taps}U
+/** Exported typedefines -----------------------------------------------------*/
+/** Mel带，权重为DT_Mel_Weight[offset]起num个，对应FFT频点first起*/
+typedef struct
+{{
+	uint16_t first;             /**< 起始频点*/
+	uint16_t num;               /**< 频点数*/
+	uint16_t offset;            /**< 权重偏移*/
+}}DT_MelBandTypeDef;
+/** Exported constants -------------------------------------------------------*/
+extern const q31_t DT_Db_Gain_q31[DT_DB_GAIN_MIN + 1U];
+extern const q31_t DT_Db_Gain_Frac_q31[10];
+extern const q15_t DT_Hann_q15[DT_FFT_SIZE];
+extern const q31_t DT_Hann_q31[DT_FFT_SIZE];
+extern const float32_t DT_Hann_f32[DT_FFT_SIZE];
+extern const q15_t DT_Blackman_q15[DT_FFT_SIZE];
+extern const q31_t DT_Blackman_q31[DT_FFT_SIZE];
+extern const float32_t DT_Blackman_f32[DT_FFT_SIZE];
+extern const DT_MelBandTypeDef DT_Mel_Band[DT_MEL_BANDS];
+extern const q15_t DT_Mel_Weight_q15[DT_MEL_WEIGHT_NUM];
+extern const float32_t DT_Mel_Weight_f32[DT_MEL_WEIGHT_NUM];
+/*双二阶系数按CMSIS DF1顺序{{b0, b1, b2, -a1, -a2}}*/
+extern const float32_t DT_Biquad_Hpf_f32[5U * DT_BIQUAD_HPF_STAGES];
+extern const q31_t DT_Biquad_Hpf_q31[5U * DT_BIQUAD_HPF_STAGES];
+extern const float32_t DT_Biquad_A_Weight_f32[5U * DT_BIQUAD_A_WEIGHT_STAGES];
+extern const q31_t DT_Biquad_A_Weight_q31[5U * DT_BIQUAD_A_WEIGHT_STAGES];
+extern const q15_t DT_Halfband_q15[DT_HALFBAND_TAPS];
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+#ifdef __cplusplus ///<end extern c
+}}
+#endif
+#endif
+/******************************** End of file *********************************/
+"""
+
+HEADER_C = """/**
+ *  @file DspTables.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 常量表
+ *
+ *  @details 由Tools/gen_tables.py生成，勿手工修改
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "DspTables.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+"""
+
+FOOTER_C = """
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
+"""
+
+if __name__ == "__main__":
+    main(sys.argv[1] if len(sys.argv) > 1 else OUT_DIR)
@@ -365,7 +365,11 @@ USBD_StatusTypeDef USBD_LL_Init(USBD_HandleTypeDef *pdev)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
   HAL_PCDEx_SetRxFiFo(&hpcd_USB_OTG_FS, 0x80);
   HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 0, 0x40);
-  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, 0x80);
+  /* Audio IN FIFO sized for one 8 channel 32-bit packet, total FS FIFO is 320 words */
+  HAL_PCDEx_SetTxFiFo(&hpcd_USB_OTG_FS, 1, AUDIO_PORT_TX_FIFO_WORDS);
+#if (0x80 + 0x40 + AUDIO_PORT_TX_FIFO_WORDS) > 320
+  #error "USB OTG FS FIFO exceeds 1.25 Kbytes"
+#endif
   }
   return USBD_OK;
 }
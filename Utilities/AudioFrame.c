@@ -0,0 +1,526 @@
+/**
+ *  @file AudioFrame.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 调试音频帧主机端流式解码
+ *
+ *  @details None
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <string.h>
+/* Private includes ----------------------------------------------------------*/
+#include "AudioFrame.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+static uint32_t AF_Crc_Table[256];
+static bool AF_Crc_Table_Ready = false;
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [AF_Read_U16 读取小端16位数据]
+ */
+static inline uint16_t AF_Read_U16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+/**
+ * [AF_Read_U32 读取小端32位数据]
+ */
+static inline uint32_t AF_Read_U32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * [AF_Crc_Table_Init 生成高位先行CRC32查找表]
+ */
+static void AF_Crc_Table_Init(void)
+{
+    uint32_t crc = 0;
+
+    for(uint32_t i = 0; i < 256U; i++)
+    {
+        crc = i << 24;
+        for(uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (crc & 0x80000000U)?((crc << 1) ^ AF_CRC_POLY):(crc << 1);
+        }
+        AF_Crc_Table[i] = crc;
+    }
+    AF_Crc_Table_Ready = true;
+}
+
+/**
+ * [AF_Header_Decode 解析帧头]
+ * @param data   [帧起始地址，至少AF_HEADER_SIZE字节]
+ * @param header [帧头输出]
+ */
+static void AF_Header_Decode(const uint8_t *data, AF_HeaderTypeDef *header)
+{
+    header->sync = AF_Read_U32(data);
+    header->version = data[4];
+    header->channel_number = data[5];
+    header->channel_map = AF_Read_U16(data + 6);
+    header->frame_samples = AF_Read_U16(data + 8);
+    header->header_size = AF_Read_U16(data + 10);
+    header->sample_counter = AF_Read_U32(data + 12);
+    header->timestamp_ms = AF_Read_U32(data + 16);
+    header->drop_count = AF_Read_U32(data + 20);
+    header->codec = data[24];
+    header->decimation = data[25];
+    header->payload_size = AF_Read_U16(data + 26);
+    for(uint32_t ch = 0; ch < AF_CHANNEL_MAX; ch++)
+    {
+        header->channel_decimation[ch] = 1;
+    }
+}
+
+/**
+ * [AF_Header_Valid 检查基本帧头]
+ * @param header [帧头]
+ * @return       [true有效]
+ */
+static bool AF_Header_Valid(const AF_HeaderTypeDef *header)
+{
+    if(header->version < AF_VERSION_MIN || header->version > AF_VERSION)
+    {
+        return false;
+    }
+    if(header->header_size != AF_HEADER_SIZE
+       && (header->version < 3U || header->header_size != AF_HEADER_SIZE_MAX))
+    {
+        return false;
+    }
+    return (header->channel_number > 0U && header->channel_number <= AF_CHANNEL_MAX
+            && header->frame_samples > 0U && header->frame_samples <= AF_FRAME_SAMPLES_MAX);
+}
+
+/**
+ * [AF_Header_Ext_Decode 解析并检查分频表]
+ * @param data   [帧起始地址，至少AF_HEADER_SIZE_MAX字节]
+ * @param header [帧头输出]
+ * @return       [true有效：分频为2的幂，且每通道点数为偶数]
+ */
+static bool AF_Header_Ext_Decode(const uint8_t *data, AF_HeaderTypeDef *header)
+{
+    uint32_t factor = 0;
+
+    for(uint32_t ch = 0; ch < header->channel_number; ch++)
+    {
+        factor = data[AF_HEADER_SIZE + ch];
+        if(factor == 0U || (factor & (factor - 1U)) != 0U
+           || (factor > 1U && (header->frame_samples % (2U * factor)) != 0U))
+        {
+            return false;
+        }
+        header->channel_decimation[ch] = (uint8_t)factor;
+    }
+    return true;
+}
+
+/**
+ * [AF_Total_Samples 本帧各通道点数之和]
+ * @param header [帧头]
+ * @return       [点数]
+ */
+static uint32_t AF_Total_Samples(const AF_HeaderTypeDef *header)
+{
+    uint32_t total = 0;
+
+    for(uint32_t ch = 0; ch < header->channel_number; ch++)
+    {
+        total += AF_channelSamples(header, ch);
+    }
+    return total;
+}
+
+/**
+ * [AF_Payload_Valid 检查数据长度与编码方式是否匹配]
+ * @param header [帧头]
+ * @return       [true有效]
+ */
+static bool AF_Payload_Valid(const AF_HeaderTypeDef *header)
+{
+    switch(header->codec)
+    {
+        case AF_CODEC_PCM:
+            return (header->payload_size == AF_Total_Samples(header) * 2U);
+        case AF_CODEC_RICE:
+            return ((header->payload_size & 3U) == 0U && header->payload_size > 0U
+                    && header->payload_size <= RC_FRAME_SIZE_MAX(header->channel_number, header->frame_samples));
+        case AF_CODEC_IMA_ADPCM:
+            return (header->header_size == AF_HEADER_SIZE
+                    && header->payload_size == AF_IMA_PAYLOAD_SIZE(header->channel_number, header->frame_samples));
+        default:
+            return false;
+    }
+}
+
+/**
+ * [AF_Decode_Payload 解压数据，输出小端PCM，含分频表时按通道依次存放，否则交织]
+ * @param dec    [解码器]
+ * @param header [帧头]
+ * @return       [PCM地址，解压失败返回NULL]
+ */
+static const uint8_t *AF_Decode_Payload(AF_DecoderTypeDef *dec, const AF_HeaderTypeDef *header)
+{
+    const uint8_t *payload = dec->buf + header->header_size;
+    uint32_t total = AF_Total_Samples(header);
+    uint8_t *pcm = (uint8_t *)dec->pcm;
+    uint16_t samples[AF_CHANNEL_MAX];
+    uint16_t value = 0;
+
+    if(header->codec == AF_CODEC_PCM)
+    {
+        return payload;
+    }
+    if(header->codec == AF_CODEC_RICE && header->header_size == AF_HEADER_SIZE_MAX)
+    {
+        for(uint32_t ch = 0; ch < header->channel_number; ch++)
+        {
+            samples[ch] = (uint16_t)AF_channelSamples(header, ch);
+        }
+        if(RC_decodeChannels(payload, header->payload_size, samples, header->channel_number, dec->pcm) == false)
+        {
+            return NULL;
+        }
+    }
+    else if(header->codec == AF_CODEC_RICE)
+    {
+        if(RC_decodeFrame(payload, header->payload_size, header->channel_number,
+                          header->frame_samples, dec->pcm) == false)
+        {
+            return NULL;
+        }
+    }
+    else
+    {
+        /*各通道一个IMA块*/
+        for(uint32_t ch = 0; ch < header->channel_number; ch++)
+        {
+            if(IMA_decodeBlock(payload + ch * IMA_BLOCK_SIZE(header->frame_samples),
+                               header->frame_samples, dec->pcm + ch, header->channel_number) == false)
+            {
+                return NULL;
+            }
+        }
+    }
+    /*与PCM帧一致按小端输出*/
+    for(uint32_t i = 0; i < total; i++)
+    {
+        value = (uint16_t)dec->pcm[i];
+        pcm[2U*i] = (uint8_t)value;
+        pcm[2U*i + 1U] = (uint8_t)(value >> 8);
+    }
+    return pcm;
+}
+
+/**
+ * [AF_Event 通知解码事件]
+ */
+static void AF_Event(AF_DecoderTypeDef *dec, AF_EVENT_ENUM_TypeDef event, uint32_t value)
+{
+    if(dec->on_event != NULL)
+    {
+        dec->on_event(event, value, dec->user);
+    }
+}
+
+/**
+ * [AF_Drop 移除缓冲区头部数据]
+ * @param dec [解码器]
+ * @param len [字节数]
+ */
+static void AF_Drop(AF_DecoderTypeDef *dec, uint32_t len)
+{
+    memmove(dec->buf, dec->buf + len, dec->len - len);
+    dec->len -= len;
+}
+
+/**
+ * [AF_Skip 失步时跳过数据，重新同步时合并报告]
+ * @param dec [解码器]
+ * @param len [字节数]
+ */
+static void AF_Skip(AF_DecoderTypeDef *dec, uint32_t len)
+{
+    dec->skip += len;
+    dec->stats.skipped_bytes += len;
+    AF_Drop(dec, len);
+}
+
+/**
+ * [AF_Check_Counter 检查样点计数连续性]
+ * @param dec    [解码器]
+ * @param header [帧头]
+ */
+static void AF_Check_Counter(AF_DecoderTypeDef *dec, const AF_HeaderTypeDef *header)
+{
+    AF_StreamTypeDef *stream = &dec->stream[0];
+    int32_t diff = 0;
+
+    for(uint32_t i = 0; i < AF_STREAM_MAX; i++)
+    {
+        if(dec->stream[i].valid == false || dec->stream[i].channel_map == header->channel_map)
+        {
+            stream = &dec->stream[i];
+            break;
+        }
+    }
+    if(stream->channel_map != header->channel_map)
+    {
+        stream->valid = false;
+        stream->channel_map = header->channel_map;
+    }
+
+    diff = (int32_t)(header->sample_counter - stream->expect_counter);
+    if(stream->valid == true && diff > 0)
+    {
+        dec->stats.gaps++;
+        dec->stats.gap_samples += (uint32_t)diff;
+        AF_Event(dec, AF_EVENT_GAP, (uint32_t)diff);
+    }
+    else if(stream->valid == true && diff < 0)
+    {
+        dec->stats.repeats++;
+        AF_Event(dec, AF_EVENT_REPEAT, (uint32_t)(-diff));
+    }
+    stream->expect_counter = header->sample_counter + header->frame_samples;
+    stream->valid = true;
+}
+
+/**
+ * [AF_Parse 解析缓冲区内的完整帧，数据不足时返回]
+ * @param dec [解码器]
+ */
+static void AF_Parse(AF_DecoderTypeDef *dec)
+{
+    AF_HeaderTypeDef header;
+    const uint8_t *pcm = NULL;
+    uint32_t offset = 0;
+    uint32_t size = 0;
+
+    for(;;)
+    {
+        /*搜索同步字，未找到时保留末尾3字节*/
+        offset = 0;
+        while(offset + 4U <= dec->len && AF_Read_U32(dec->buf + offset) != AF_SYNC_WORD)
+        {
+            offset++;
+        }
+        if(offset > 0U)
+        {
+            AF_Skip(dec, offset);
+        }
+        if(dec->len < AF_HEADER_SIZE)
+        {
+            return;
+        }
+
+        AF_Header_Decode(dec->buf, &header);
+        if(AF_Header_Valid(&header) == false)
+        {
+            /*数据中出现的伪同步字*/
+            AF_Skip(dec, 1);
+            continue;
+        }
+        if(dec->len < header.header_size)
+        {
+            return;
+        }
+        if((header.header_size == AF_HEADER_SIZE_MAX && AF_Header_Ext_Decode(dec->buf, &header) == false)
+           || AF_Payload_Valid(&header) == false)
+        {
+            AF_Skip(dec, 1);
+            continue;
+        }
+
+        size = header.header_size + header.payload_size + AF_CRC_SIZE;
+        if(dec->len < size)
+        {
+            return;
+        }
+        if(AF_crc32(AF_CRC_INIT, dec->buf, size - AF_CRC_SIZE) != AF_Read_U32(dec->buf + size - AF_CRC_SIZE))
+        {
+            dec->stats.crc_errors++;
+            AF_Event(dec, AF_EVENT_CRC_ERROR, size);
+            AF_Skip(dec, 1);
+            continue;
+        }
+
+        if(dec->skip > 0U)
+        {
+            AF_Event(dec, AF_EVENT_RESYNC, dec->skip);
+            dec->skip = 0;
+        }
+        AF_Check_Counter(dec, &header);
+        pcm = AF_Decode_Payload(dec, &header);
+        if(pcm == NULL)
+        {
+            /*帧完整但位流错误，整帧丢弃*/
+            dec->stats.decode_errors++;
+            AF_Event(dec, AF_EVENT_DECODE_ERROR, size);
+            AF_Drop(dec, size);
+            continue;
+        }
+        dec->stats.frames++;
+        dec->stats.payload_bytes += header.payload_size;
+        dec->stats.pcm_bytes += AF_Total_Samples(&header) * 2U;
+        if(dec->on_frame != NULL)
+        {
+            dec->on_frame(&header, pcm, dec->user);
+        }
+        AF_Drop(dec, size);
+    }
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [AF_crc32 软件计算CRC32，结果与STM32硬件CRC单元一致]
+ * @param  crc  [初值，首次为AF_CRC_INIT，分段计算时传入上次结果]
+ * @param  data [数据，按32位小端字处理]
+ * @param  len  [字节数，4的整数倍]
+ * @return      [CRC]
+ */
+uint32_t AF_crc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    if(AF_Crc_Table_Ready == false)
+    {
+        AF_Crc_Table_Init();
+    }
+
+    /*每个字高位字节先行*/
+    for(uint32_t i = 0; i + 4U <= len; i += 4U)
+    {
+        for(uint32_t byte = 4U; byte > 0U; byte--)
+        {
+            crc = (crc << 8) ^ AF_Crc_Table[(crc >> 24) ^ data[i + byte - 1U]];
+        }
+    }
+    return crc;
+}
+
+/**
+ * [AF_decoderInit 解码器初始化]
+ * @param dec      [解码器]
+ * @param on_frame [正确帧回调，可为NULL]
+ * @param on_event [事件回调，可为NULL]
+ * @param user     [回调参数]
+ */
+void AF_decoderInit(AF_DecoderTypeDef *dec, AF_FRAME_CALLBACK on_frame, AF_EVENT_CALLBACK on_event, void *user)
+{
+    memset(dec, 0, sizeof(AF_DecoderTypeDef));
+    dec->on_frame = on_frame;
+    dec->on_event = on_event;
+    dec->user = user;
+}
+
+/**
+ * [AF_decoderPush 输入任意长度字节流，完整帧在此函数内回调]
+ * @param dec  [解码器]
+ * @param data [数据]
+ * @param len  [字节数]
+ */
+void AF_decoderPush(AF_DecoderTypeDef *dec, const uint8_t *data, uint32_t len)
+{
+    uint32_t size = 0;
+
+    while(len > 0U)
+    {
+        size = (uint32_t)sizeof(dec->buf) - dec->len;
+        size = (len < size)?len:size;
+        memcpy(dec->buf + dec->len, data, size);
+        dec->len += size;
+        data += size;
+        len -= size;
+        AF_Parse(dec);
+        /*缓冲区满仍无法解析，丢弃1字节防止停滞*/
+        if(dec->len == sizeof(dec->buf))
+        {
+            AF_Skip(dec, 1);
+        }
+    }
+}
+
+/**
+ * [AF_decoderGetStats 获取解码统计]
+ * @param  dec [解码器]
+ * @return     [统计信息]
+ */
+const AF_StatsTypeDef *AF_decoderGetStats(const AF_DecoderTypeDef *dec)
+{
+    return &dec->stats;
+}
+
+/**
+ * [AF_wavHeader 生成16位PCM WAV文件头]
+ * @param out         [输出，AF_WAV_HEADER_SIZE字节]
+ * @param channels    [通道数]
+ * @param sample_rate [采样率，原始采样率除以帧头decimation]
+ * @param data_bytes  [PCM数据字节数，写完数据后可重新生成覆盖]
+ */
+void AF_wavHeader(uint8_t *out, uint16_t channels, uint32_t sample_rate, uint32_t data_bytes)
+{
+    uint32_t block_align = (uint32_t)channels * 2U;
+    uint32_t fields[] = {
+        0x46464952U, 36U + data_bytes, 0x45564157U,     /**< "RIFF" size "WAVE"*/
+        0x20746D66U, 16U, 1U | ((uint32_t)channels << 16),/**< "fmt " 16 PCM channels*/
+        sample_rate, sample_rate * block_align,
+        block_align | (16U << 16),                      /**< block_align bits*/
+        0x61746164U, data_bytes                         /**< "data" size*/
+    };
+
+    for(uint32_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+    {
+        out[4U*i] = (uint8_t)fields[i];
+        out[4U*i + 1U] = (uint8_t)(fields[i] >> 8);
+        out[4U*i + 2U] = (uint8_t)(fields[i] >> 16);
+        out[4U*i + 3U] = (uint8_t)(fields[i] >> 24);
+    }
+}
+
+/**
+ * [AF_channelSamples 获取某通道本帧点数]
+ * @param  header [帧头]
+ * @param  ch     [通道序号]
+ * @return        [frame_samples除以该通道分频]
+ */
+uint32_t AF_channelSamples(const AF_HeaderTypeDef *header, uint32_t ch)
+{
+    uint32_t factor = (ch < AF_CHANNEL_MAX)?header->channel_decimation[ch]:1U;
+
+    return header->frame_samples / ((factor == 0U)?1U:factor);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,167 @@
+/**
+ *  @file AudioFrame.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 调试音频帧格式及主机端流式解码
+ *
+ *  @details 1、帧格式：[帧头28字节][交织PCM或压缩数据][CRC32]，多字节字段均为小端
+ *           2、CRC32与STM32硬件CRC单元一致：多项式0x04C11DB7，初值0xFFFFFFFF，
+ *              按32位小端字输入、高位先行，不反转不异或，覆盖帧头与数据
+ *           3、帧长为4字节整数倍，解码器按字节搜索同步字，不要求传输按帧或按字对齐
+ *           4、解码器(AudioFrame.c)供PC端工具使用，不参与MCU编译，仅依赖标准C库
+ *           5、样点计数不连续时报告丢帧(gap)或重复帧(repeat)，CRC错误时跳过1字节重新同步，
+ *              计数按channel_map分别检查，串口多通道各自成帧交替发送时互不干扰
+ *           6、codec为AF_CODEC_RICE时数据为RiceCodec无损压缩位流，长度由payload_size给出，
+ *              解码器还原为交织PCM后回调，主机端需同时编译RiceCodec.c
+ *           7、codec为AF_CODEC_IMA_ADPCM时各通道依次为一个IMA块(见ImaAdpcm.h)，主机端需同时编译ImaAdpcm.c，
+ *              decimation为采样率分频，AF_wavHeader生成WAV文件头供保存解码数据
+ *           8、v3帧头长度为AF_HEADER_SIZE_MAX时，基本帧头后为各通道分频表(每通道1字节，2的幂)，
+ *              数据按通道依次存放，第n通道frame_samples/channel_decimation[n]点，仅支持PCM与RICE；
+ *              帧头长度为AF_HEADER_SIZE时与v2相同，数据交织
+ *
+ *  @version v1.0
+ */
+#ifndef AUDIOFRAME_H_
+#define AUDIOFRAME_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+#include "RiceCodec.h"
+#include "ImaAdpcm.h"
+/** Private defines ----------------------------------------------------------*/
+#define AF_SYNC_WORD            0x46445541U /**< 字节序列"AUDF"*/
+#define AF_VERSION              3U          /**< v2加入压缩类型及数据长度，v3加入分通道分频表*/
+#define AF_VERSION_MIN          2U          /**< 解码器支持的最低版本*/
+#define AF_HEADER_SIZE          28U         /**< 基本帧头字节数*/
+#define AF_HEADER_EXT_SIZE      8U          /**< 分频表字节数，AF_CHANNEL_MAX*/
+#define AF_HEADER_SIZE_MAX      (AF_HEADER_SIZE + AF_HEADER_EXT_SIZE)
+#define AF_CRC_SIZE             4U
+#define AF_CRC_POLY             0x04C11DB7U
+#define AF_CRC_INIT             0xFFFFFFFFU
+#define AF_WAV_HEADER_SIZE      44U
+#define AF_CHANNEL_MAX          8U
+#define AF_STREAM_MAX           AF_CHANNEL_MAX  /**< 分别检查样点计数的数据流数*/
+
+/*解码器支持的每通道最大点数*/
+#ifndef AF_FRAME_SAMPLES_MAX
+  #define AF_FRAME_SAMPLES_MAX  256U
+#endif
+/*压缩帧最大字节数，不小于同规格PCM帧*/
+#define AF_CODED_FRAME_SIZE_MAX(ch, samples)  (AF_HEADER_SIZE_MAX + RC_FRAME_SIZE_MAX(ch, samples) + AF_CRC_SIZE)
+#define AF_FRAME_SIZE_MAX       AF_CODED_FRAME_SIZE_MAX(AF_CHANNEL_MAX, AF_FRAME_SAMPLES_MAX)
+
+/** Exported typedefines -----------------------------------------------------*/
+/** 帧头，字段自然对齐无填充，前AF_HEADER_SIZE字节为基本帧头*/
+typedef struct
+{
+	uint32_t sync;              /**< AF_SYNC_WORD*/
+	uint8_t version;            /**< AF_VERSION*/
+	uint8_t channel_number;     /**< 交织通道数*/
+	uint16_t channel_map;       /**< bit n置1表示第n路数据有效*/
+	uint16_t frame_samples;     /**< 每通道点数*/
+	uint16_t header_size;       /**< 帧头字节数*/
+	uint32_t sample_counter;    /**< 本帧首点的每通道累计点数*/
+	uint32_t timestamp_ms;      /**< 本帧采集完成时刻*/
+	uint32_t drop_count;        /**< 设备端缓冲区累计丢弃点数(各通道合计)*/
+	uint8_t codec;              /**< AF_CODEC_ENUM_TypeDef*/
+	uint8_t decimation;         /**< 采样率分频，0与1均为原始采样率*/
+	uint16_t payload_size;      /**< 数据字节数，4的整数倍*/
+	uint8_t channel_decimation[AF_CHANNEL_MAX];/**< 各通道分频，帧头不含分频表时解码为1*/
+}AF_HeaderTypeDef;
+
+/** 数据编码方式*/
+typedef enum
+{
+	AF_CODEC_PCM = 0,           /**< 交织int16*/
+	AF_CODEC_RICE,              /**< RiceCodec无损压缩*/
+	AF_CODEC_IMA_ADPCM,         /**< IMA-ADPCM 4:1有损压缩*/
+}AF_CODEC_ENUM_TypeDef;
+
+/** 解码事件*/
+typedef enum
+{
+	AF_EVENT_GAP = 0,           /**< 样点计数跳增，value为丢失的每通道点数*/
+	AF_EVENT_REPEAT,            /**< 样点计数回退或重复，value为回退点数*/
+	AF_EVENT_CRC_ERROR,         /**< CRC校验失败，value为帧长*/
+	AF_EVENT_RESYNC,            /**< 重新同步，value为跳过的字节数*/
+	AF_EVENT_DECODE_ERROR,      /**< CRC正确但压缩数据无法解码，value为帧长*/
+}AF_EVENT_ENUM_TypeDef;
+
+/** 解码统计*/
+typedef struct
+{
+	uint32_t frames;            /**< 正确帧数*/
+	uint32_t gaps;              /**< 丢帧次数*/
+	uint32_t gap_samples;       /**< 丢失的每通道点数*/
+	uint32_t repeats;           /**< 重复帧次数*/
+	uint32_t crc_errors;        /**< CRC错误次数*/
+	uint32_t decode_errors;     /**< 解压失败次数*/
+	uint32_t payload_bytes;     /**< 正确帧数据字节数*/
+	uint32_t pcm_bytes;         /**< 正确帧还原后PCM字节数*/
+	uint32_t skipped_bytes;     /**< 同步时跳过的字节数*/
+}AF_StatsTypeDef;
+
+/*正确帧回调，data为小端int16数据，含分频表时按通道依次存放，否则交织*/
+typedef void (*AF_FRAME_CALLBACK)(const AF_HeaderTypeDef *header, const uint8_t *data, void *user);
+/*事件回调*/
+typedef void (*AF_EVENT_CALLBACK)(AF_EVENT_ENUM_TypeDef event, uint32_t value, void *user);
+
+/** 单个数据流的样点计数*/
+typedef struct
+{
+	uint16_t channel_map;       /**< 数据流标识*/
+	bool valid;
+	uint32_t expect_counter;    /**< 下一帧期望的样点计数*/
+}AF_StreamTypeDef;
+
+/** 流式解码器*/
+typedef struct
+{
+	uint8_t buf[AF_FRAME_SIZE_MAX];
+	int16_t pcm[AF_CHANNEL_MAX * AF_FRAME_SAMPLES_MAX];/**< 解压输出，回调前转为小端*/
+	uint32_t len;               /**< buf内待解析字节数*/
+	uint32_t skip;              /**< 当前连续跳过的字节数*/
+	AF_StreamTypeDef stream[AF_STREAM_MAX];/**< 按channel_map区分的样点计数，超出时覆盖首项*/
+	AF_FRAME_CALLBACK on_frame;
+	AF_EVENT_CALLBACK on_event;
+	void *user;
+	AF_StatsTypeDef stats;
+}AF_DecoderTypeDef;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*帧总字节数*/
+#define AF_FRAME_SIZE(ch, samples)  (AF_HEADER_SIZE + (uint32_t)(ch) * (uint32_t)(samples) * 2U + AF_CRC_SIZE)
+/*IMA-ADPCM数据字节数，补齐4字节*/
+#define AF_IMA_PAYLOAD_SIZE(ch, samples)  (((uint32_t)(ch) * IMA_BLOCK_SIZE(samples) + 3U) & ~3U)
+/*IMA-ADPCM帧总字节数*/
+#define AF_IMA_FRAME_SIZE(ch, samples)    (AF_HEADER_SIZE + AF_IMA_PAYLOAD_SIZE(ch, samples) + AF_CRC_SIZE)
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*软件计算CRC32，与STM32硬件CRC一致，len为4的整数倍*/
+uint32_t AF_crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+/*解码器初始化，回调可为NULL*/
+void AF_decoderInit(AF_DecoderTypeDef *dec, AF_FRAME_CALLBACK on_frame, AF_EVENT_CALLBACK on_event, void *user);
+/*输入任意长度字节流*/
+void AF_decoderPush(AF_DecoderTypeDef *dec, const uint8_t *data, uint32_t len);
+/*获取解码统计*/
+const AF_StatsTypeDef *AF_decoderGetStats(const AF_DecoderTypeDef *dec);
+/*生成16位PCM WAV文件头*/
+void AF_wavHeader(uint8_t *out, uint16_t channels, uint32_t sample_rate, uint32_t data_bytes);
+/*获取某通道本帧点数*/
+uint32_t AF_channelSamples(const AF_HeaderTypeDef *header, uint32_t ch);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -11,7 +11,7 @@
  *
  *  @details None
  *
- *  @version v1.3
+ *  @version v1.6
  */
 #ifdef __cplusplus ///<use C compiler
 extern "C" {
@@ -21,8 +21,19 @@ extern "C" {
 #include "CircularQueue.h"
 #if USE_LINUX_SYSTEM
 #include <sys/types.h>
+#include <stdatomic.h>
+#else
+#include "cmsis_compiler.h"
+#include "StaticArena.h"
 #endif
 /** Private typedef ----------------------------------------------------------*/
+/** 统计注册表节点*/
+typedef struct
+{
+    const char *name;
+    CQ_handleTypeDef *cb;
+    CQ_StatsTypeDef stats;
+}CQ_STATS_NODE_Typedef_t;
 /** Private macros -----------------------------------------------------------*/
 /**
  * @name 返回值定义
@@ -31,9 +42,52 @@ extern "C" {
 #define TRUE true
 #define FALSE false
 /** @}*/
+
+/**
+ * @name 内存管理接口，MCU端由静态内存池分配，不支持释放
+ * @{
+ */
+#if USE_LINUX_SYSTEM
+  #define CQ_MALLOC(size)   calloc(1, (size_t)(size))
+  #define CQ_FREE(ptr)      free(ptr)
+#else
+  #define CQ_MALLOC(size)   SA_alloc((uint32_t)(size), SA_ALIGN_DMA)
+  #define CQ_FREE(ptr)      ((void)(ptr))
+#endif
+/** @}*/
+
+/**
+ * @name 索引发布屏障
+ * @{
+ */
+#if USE_LINUX_SYSTEM
+  #define CQ_ACQUIRE_BARRIER()  atomic_thread_fence(memory_order_acquire)
+  #define CQ_RELEASE_BARRIER()  atomic_thread_fence(memory_order_release)
+#else
+  #define CQ_ACQUIRE_BARRIER()  __DMB()
+  #define CQ_RELEASE_BARRIER()  __DMB()
+#endif
+/** @}*/
+
+/**
+ * @name 元素位宽(字节数左移位数)
+ * @{
+ */
+#define CQ_ELEM_SHIFT_8BIT    0U
+#define CQ_ELEM_SHIFT_16BIT   1U
+#define CQ_ELEM_SHIFT_32BIT   2U
+/** @}*/
+
+/*两个16位数据打包为一个32位字，lo位于低地址，无DSP指令时以移位实现*/
+#if USE_LINUX_SYSTEM || !defined(__PKHBT)
+  #define CQ_PACK_16(lo, hi)    ((uint32_t)(lo) | ((uint32_t)(hi) << 16))
+#else
+  #define CQ_PACK_16(lo, hi)    __PKHBT((uint32_t)(lo), (uint32_t)(hi), 16)
+#endif
 /** Private constants --------------------------------------------------------*/
 /** Public variables ---------------------------------------------------------*/
 /** Private variables --------------------------------------------------------*/
+static CQ_STATS_NODE_Typedef_t CQ_Stats_List[CQ_STATS_MAX];
 /** Private function prototypes ----------------------------------------------*/
 /** Private user code --------------------------------------------------------*/
 
@@ -44,6 +98,476 @@ extern "C" {
 *
 ********************************************************************************
 */
+/**
+ * [CQ_Load_Exit 生产者读取消费者出口，屏障保证消费者读完数据后才复用该区域]
+ * @param  cb [环形缓冲区句柄]
+ * @return    [出口索引]
+ */
+static inline uint32_t CQ_Load_Exit(CQ_handleTypeDef *cb)
+{
+    uint32_t exit = cb->exit;
+    CQ_ACQUIRE_BARRIER();
+    return exit;
+}
+
+/**
+ * [CQ_Load_Entrance 消费者读取生产者入口，屏障保证读取到入口前已写入的数据]
+ * @param  cb [环形缓冲区句柄]
+ * @return    [入口索引]
+ */
+static inline uint32_t CQ_Load_Entrance(CQ_handleTypeDef *cb)
+{
+    uint32_t entrance = cb->entrance;
+    CQ_ACQUIRE_BARRIER();
+    return entrance;
+}
+
+/**
+ * [CQ_Publish_Entrance 生产者发布入口，数据写入完成后才对消费者可见]
+ * @param cb       [环形缓冲区句柄]
+ * @param entrance [新入口索引]
+ */
+static inline void CQ_Publish_Entrance(CQ_handleTypeDef *cb, uint32_t entrance)
+{
+    CQ_RELEASE_BARRIER();
+    cb->entrance = entrance;
+}
+
+/**
+ * [CQ_Publish_Exit 消费者发布出口，数据读取完成后才交还给生产者]
+ * @param cb   [环形缓冲区句柄]
+ * @param exit [新出口索引]
+ */
+static inline void CQ_Publish_Exit(CQ_handleTypeDef *cb, uint32_t exit)
+{
+    CQ_RELEASE_BARRIER();
+    cb->exit = exit;
+}
+
+/**
+ * [CQ_Stats_Write 生产者更新统计]
+ * @param cb   [环形缓冲区句柄]
+ * @param over [本次是否空间不足]
+ * @param len  [写入元素个数]
+ * @param fill [写入后水位]
+ */
+static inline void CQ_Stats_Write(CQ_handleTypeDef *cb, bool over, uint32_t len, uint32_t fill)
+{
+    CQ_StatsTypeDef *stats = cb->stats;
+    if(stats == NULL)
+    {
+        return;
+    }
+    if(over == true)
+    {
+        stats->overrun++;
+    }
+    stats->total_in += len;
+    if(fill > stats->max_fill)
+    {
+        stats->max_fill = fill;
+    }
+}
+
+/**
+ * [CQ_Stats_Read 消费者更新统计]
+ * @param cb   [环形缓冲区句柄]
+ * @param want [期望读取元素个数]
+ * @param fill [读取时水位]
+ */
+static inline void CQ_Stats_Read(CQ_handleTypeDef *cb, uint32_t want, uint32_t fill)
+{
+    CQ_StatsTypeDef *stats = cb->stats;
+    if(stats == NULL)
+    {
+        return;
+    }
+    if(fill < want)
+    {
+        stats->underrun++;
+    }
+    if(fill < stats->min_fill)
+    {
+        stats->min_fill = fill;
+    }
+}
+
+/**
+ * [CQ_CAS_Exit 比较并更新出口，覆盖模式下生产者与消费者均会修改出口]
+ * @param  cb      [环形缓冲区句柄]
+ * @param  expect  [期望的当前出口]
+ * @param  desired [新出口索引]
+ * @return         [true 更新成功]
+ */
+static inline bool CQ_CAS_Exit(CQ_handleTypeDef *cb, uint32_t expect, uint32_t desired)
+{
+#if USE_LINUX_SYSTEM
+    return __atomic_compare_exchange_n(&cb->exit, &expect, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#else
+    bool ret = false;
+    CQ_RELEASE_BARRIER();
+    if(__LDREXW(&cb->exit) != expect)
+    {
+        __CLREX();
+        return false;
+    }
+    /*中断返回会清除独占标记，被打断时STREX失败由调用者重试*/
+    ret = (__STREXW(desired, &cb->exit) == 0U);
+    CQ_ACQUIRE_BARRIER();
+    return ret;
+#endif
+}
+
+/**
+ * [CQ_Make_Room 覆盖模式下按整帧丢弃最旧数据，腾出写入空间]
+ * @param  cb       [环形缓冲区句柄]
+ * @param  entrance [当前入口]
+ * @param  len      [期望写入元素个数，不大于缓冲区大小]
+ * @return          [出口索引]
+ */
+static uint32_t CQ_Make_Room(CQ_handleTypeDef *cb, uint32_t entrance, uint32_t len)
+{
+    uint32_t exit = CQ_Load_Exit(cb);
+    uint32_t used = 0;
+    uint32_t drop = 0;
+
+    if(cb->policy != (uint8_t)CQ_POLICY_OVERWRITE_OLDEST)
+    {
+        return exit;
+    }
+
+    for(;;)
+    {
+        used = entrance - exit;
+        if(cb->size - used >= len)
+        {
+            return exit;
+        }
+        /*不足部分向上取整到帧，不超过已有数据*/
+        drop = len - (cb->size - used);
+        drop = ((drop + cb->frame_len - 1U) / cb->frame_len) * cb->frame_len;
+        drop = GET_MIN(drop, used);
+        if(CQ_CAS_Exit(cb, exit, exit + drop) == true)
+        {
+            cb->drop_count += drop;
+            return exit + drop;
+        }
+        /*消费者同时读走了数据，重新计算*/
+        exit = CQ_Load_Exit(cb);
+    }
+}
+
+/**
+ * [CQ_Put_Elements 加入数据，各位宽共用]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  sourceBuf [源地址]
+ * @param  len       [元素个数]
+ * @param  shift     [元素字节数左移位数]
+ * @return           [加入元素个数]
+ */
+static uint32_t CQ_Put_Elements(CQ_handleTypeDef *cb, const void *sourceBuf, uint32_t len, uint32_t shift)
+{
+    uint32_t size = 0;
+    uint32_t want = len;
+    uint32_t drops = cb->drop_count;
+    uint32_t entrance = cb->entrance;
+    uint32_t exit = 0;
+    uint32_t offset = entrance & (cb->size - 1);
+
+    /*覆盖模式下超出缓冲区的部分只保留最新数据*/
+    if(cb->policy == (uint8_t)CQ_POLICY_OVERWRITE_OLDEST && len > cb->size)
+    {
+        sourceBuf = (const uint8_t *)sourceBuf + ((len - cb->size) << shift);
+        cb->drop_count += len - cb->size;
+        len = cb->size;
+    }
+    exit = CQ_Make_Room(cb, entrance, len);
+
+    /*此次存入的实际大小，取 剩余空间 和 目标存入数量  两个值小的那个*/
+    len = GET_MIN(len, cb->size - entrance + exit);
+
+    /*&(size-1)代替取模运算，同上原理，得到此次存入队列入口到末尾的大小*/
+    size = GET_MIN(len, cb->size - offset);
+    memcpy(cb->Buffer.data8Buffer + (offset << shift), sourceBuf, size << shift);
+    memcpy(cb->Buffer.data8Buffer, (const uint8_t *)sourceBuf + (size << shift), (len - size) << shift);
+
+    /*利用无符号数据的溢出特性，数据写入完成后发布入口*/
+    CQ_Publish_Entrance(cb, entrance + len);
+    CQ_Stats_Write(cb, (len < want || cb->drop_count != drops), len, entrance + len - exit);
+
+    return len;
+}
+
+/**
+ * [CQ_Get_Elements 读取数据，各位宽共用]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  targetBuf [目标地址]
+ * @param  len       [元素个数]
+ * @param  shift     [元素字节数左移位数]
+ * @param  consume   [true 读取后释放空间]
+ * @return           [读取元素个数]
+ */
+static uint32_t CQ_Get_Elements(CQ_handleTypeDef *cb, void *targetBuf, uint32_t len, uint32_t shift, bool consume)
+{
+    uint32_t size = 0;
+    uint32_t want = len;
+    uint32_t exit = 0;
+    uint32_t entrance = 0;
+    uint32_t offset = 0;
+
+    for(;;)
+    {
+        exit = cb->exit;
+        entrance = CQ_Load_Entrance(cb);
+        offset = exit & (cb->size - 1);
+
+        /*此次读取的实际大小，取 可读 和 目标读取数量  两个值小的那个*/
+        len = GET_MIN(want, GET_MIN(entrance - exit, cb->size));
+        /*原理雷同存入*/
+        size = GET_MIN(len, cb->size - offset);
+        memcpy(targetBuf, cb->Buffer.data8Buffer + (offset << shift), size << shift);
+        memcpy((uint8_t *)targetBuf + (size << shift), cb->Buffer.data8Buffer, (len - size) << shift);
+
+        if(cb->policy != (uint8_t)CQ_POLICY_OVERWRITE_OLDEST)
+        {
+            if(consume == true)
+            {
+                /*利用无符号数据的溢出特性，数据读取完成后发布出口*/
+                CQ_Publish_Exit(cb, exit + len);
+            }
+            break;
+        }
+
+        /*覆盖模式：出口未被生产者推进则读取的数据有效，否则重新读取*/
+        if(consume == true)
+        {
+            if(CQ_CAS_Exit(cb, exit, exit + len) == true)
+            {
+                break;
+            }
+        }
+        else
+        {
+            CQ_ACQUIRE_BARRIER();
+            if(cb->exit == exit)
+            {
+                break;
+            }
+        }
+    }
+
+    CQ_Stats_Read(cb, want, GET_MIN(entrance - exit, cb->size));
+    if(consume == true && cb->stats != NULL)
+    {
+        cb->stats->total_out += len;
+    }
+    return len;
+}
+/**
+ * [CQ_Span_Calc 计算从指定索引开始的连续内存段]
+ * @param  cb    [环形缓冲区句柄]
+ * @param  start [起始索引]
+ * @param  len   [元素个数]
+ * @param  shift [元素字节数左移位数]
+ * @param  span  [输出内存段]
+ * @return       [元素个数]
+ */
+static uint32_t CQ_Span_Calc(CQ_handleTypeDef *cb, uint32_t start, uint32_t len, uint32_t shift, CQ_SpanTypeDef *span)
+{
+    uint32_t offset = start & (cb->size - 1);
+
+    span->first_len = GET_MIN(len, cb->size - offset);
+    span->first = cb->Buffer.data8Buffer + (offset << shift);
+    span->second_len = len - span->first_len;
+    span->second = cb->Buffer.data8Buffer;
+    return len;
+}
+
+/**
+ * [CQ_Reserve_Elements 预留写入空间，各位宽共用]
+ * @param  cb    [环形缓冲区句柄]
+ * @param  len   [期望元素个数]
+ * @param  shift [元素字节数左移位数]
+ * @param  span  [输出可写内存段]
+ * @return       [可写元素个数]
+ */
+static uint32_t CQ_Reserve_Elements(CQ_handleTypeDef *cb, uint32_t len, uint32_t shift, CQ_SpanTypeDef *span)
+{
+    uint32_t want = len;
+    uint32_t drops = cb->drop_count;
+    uint32_t entrance = cb->entrance;
+    uint32_t exit = 0;
+
+    if(cb->policy == (uint8_t)CQ_POLICY_OVERWRITE_OLDEST)
+    {
+        len = GET_MIN(len, cb->size);
+    }
+    exit = CQ_Make_Room(cb, entrance, len);
+
+    len = GET_MIN(len, cb->size - entrance + exit);
+    /*写入量与水位在CQ_commitWrite时统计*/
+    CQ_Stats_Write(cb, (len < want || cb->drop_count != drops), 0, 0);
+    return CQ_Span_Calc(cb, entrance, len, shift, span);
+}
+
+/**
+ * [CQ_16_Interleave_Frames 按通道数特化的整帧交织，每两点打包为一次32位写入]
+ * @param  Ptr      [目标地址，4字节对齐]
+ * @param  channels [各通道数据地址]
+ * @param  ch_num   [通道数，偶数]
+ * @param  stride   [同一通道相邻两点间隔]
+ * @param  index    [起始点序号]
+ * @param  frames   [帧数]
+ * @return          [下一帧点序号]
+ */
+static uint32_t CQ_16_Interleave_Frames(uint16_t *Ptr, const uint16_t * const *channels, uint32_t ch_num, uint32_t stride, uint32_t index, uint32_t frames)
+{
+    uint32_t *Word = (uint32_t *)Ptr;
+    const uint16_t *c0 = channels[0] + index;
+    const uint16_t *c1 = channels[1] + index;
+    const uint16_t *c2 = NULL;
+    const uint16_t *c3 = NULL;
+    uint32_t n = frames;
+
+    /*通道数分支置于点循环外*/
+    switch(ch_num)
+    {
+        case 2:
+            while(n-- > 0U)
+            {
+                *Word++ = CQ_PACK_16(*c0, *c1);
+                c0 += stride;
+                c1 += stride;
+            }
+            break;
+        case 4:
+            c2 = channels[2] + index;
+            c3 = channels[3] + index;
+            while(n-- > 0U)
+            {
+                Word[0] = CQ_PACK_16(*c0, *c1);
+                Word[1] = CQ_PACK_16(*c2, *c3);
+                Word += 2;
+                c0 += stride;
+                c1 += stride;
+                c2 += stride;
+                c3 += stride;
+            }
+            break;
+        case 8:
+            for(uint32_t i = 0; i < frames; i++)
+            {
+                Word[0] = CQ_PACK_16(channels[0][index], channels[1][index]);
+                Word[1] = CQ_PACK_16(channels[2][index], channels[3][index]);
+                Word[2] = CQ_PACK_16(channels[4][index], channels[5][index]);
+                Word[3] = CQ_PACK_16(channels[6][index], channels[7][index]);
+                Word += 4;
+                index += stride;
+            }
+            return index;
+        default:
+            /*6通道等：逐对通道写入*/
+            for(uint32_t i = 0; i < frames; i++)
+            {
+                for(uint32_t ch = 0; ch < ch_num; ch += 2U)
+                {
+                    *Word++ = CQ_PACK_16(channels[ch][index], channels[ch + 1U][index]);
+                }
+                index += stride;
+            }
+            return index;
+    }
+    return index + frames * stride;
+}
+
+/**
+ * [CQ_Peek_Elements 查看可读数据，各位宽共用]
+ * @param  cb    [环形缓冲区句柄]
+ * @param  len   [期望元素个数]
+ * @param  shift [元素字节数左移位数]
+ * @param  span  [输出可读内存段]
+ * @return       [可读元素个数]
+ */
+static uint32_t CQ_Peek_Elements(CQ_handleTypeDef *cb, uint32_t len, uint32_t shift, CQ_SpanTypeDef *span)
+{
+    uint32_t exit = cb->exit;
+    uint32_t entrance = CQ_Load_Entrance(cb);
+
+    CQ_Stats_Read(cb, len, GET_MIN(entrance - exit, cb->size));
+    len = GET_MIN(len, entrance - exit);
+    return CQ_Span_Calc(cb, exit, len, shift, span);
+}
+/**
+ * [CQ_Span_Byte 读取连续段内指定偏移的字节]
+ * @param  span   [内存段]
+ * @param  offset [偏移]
+ * @return        [数据]
+ */
+static inline uint8_t CQ_Span_Byte(const CQ_SpanTypeDef *span, uint32_t offset)
+{
+    return (offset < span->first_len)?((const uint8_t *)span->first)[offset]
+                                     :((const uint8_t *)span->second)[offset - span->first_len];
+}
+
+/**
+ * [CQ_Skip_To_Pattern 按连续段整块查找帧头，一次更新出口丢弃无效数据]
+ * @param  cb          [环形缓冲区句柄]
+ * @param  pattern     [帧头字节序列]
+ * @param  pattern_len [帧头长度]
+ * @return             [找到帧头时返回缓冲区可读长度，否则返回0并保留不足一个帧头的尾部数据]
+ */
+static uint32_t CQ_Skip_To_Pattern(CQ_handleTypeDef *cb, const uint8_t *pattern, uint32_t pattern_len)
+{
+    CQ_SpanTypeDef Span;
+    const uint8_t *Ptr = NULL;
+    uint32_t offset = 0;
+    uint32_t index = 0;
+    uint32_t len = CQ_Peek_Elements(cb, CQ_getLength(cb), CQ_ELEM_SHIFT_8BIT, &Span);
+
+    if(len < pattern_len)
+    {
+        return 0;
+    }
+
+    while(offset + pattern_len <= len)
+    {
+        /*memchr按字长扫描当前连续段，定位帧头首字节*/
+        if(offset < Span.first_len)
+        {
+            Ptr = (const uint8_t *)memchr((const uint8_t *)Span.first + offset, pattern[0], Span.first_len - offset);
+            offset = (Ptr == NULL)?Span.first_len:(uint32_t)(Ptr - (const uint8_t *)Span.first);
+        }
+        else
+        {
+            Ptr = (const uint8_t *)memchr((const uint8_t *)Span.second + (offset - Span.first_len), pattern[0], len - offset);
+            offset = (Ptr == NULL)?len:Span.first_len + (uint32_t)(Ptr - (const uint8_t *)Span.second);
+        }
+        if(Ptr == NULL || offset + pattern_len > len)
+        {
+            continue;
+        }
+
+        /*校验其余帧头字节，可跨越回绕处*/
+        for(index = 1; index < pattern_len; index++)
+        {
+            if(CQ_Span_Byte(&Span, offset + index) != pattern[index])
+            {
+                break;
+            }
+        }
+        if(index == pattern_len)
+        {
+            CQ_ManualOffsetInc(cb, offset);
+            return CQ_getLength(cb);
+        }
+        offset++;
+    }
+
+    /*未找到帧头*/
+    CQ_ManualOffsetInc(cb, len - (pattern_len - 1));
+    return 0;
+}
+
 /** Public application code --------------------------------------------------*/
 /*******************************************************************************
 *
@@ -77,6 +601,10 @@ bool CQ_init(CQ_handleTypeDef *CircularQueue ,uint8_t *memAdd ,uint32_t len)
 
     memset(CircularQueue->Buffer.data8Buffer, 0, len);
     CircularQueue->entrance = CircularQueue->exit = 0;
+    CircularQueue->policy = (uint8_t)CQ_POLICY_DROP_NEWEST;
+    CircularQueue->frame_len = 1;
+    CircularQueue->drop_count = 0;
+    CircularQueue->stats = NULL;
 
     return TRUE;
 }
@@ -88,7 +616,8 @@ bool CQ_init(CQ_handleTypeDef *CircularQueue ,uint8_t *memAdd ,uint32_t len)
  */
 bool CQ_isEmpty(CQ_handleTypeDef *CircularQueue)
 {
-    if (CircularQueue->entrance == CircularQueue->exit)
+    uint32_t exit = CircularQueue->exit;
+    if (CircularQueue->entrance == exit)
     {
         return TRUE;
     }
@@ -105,7 +634,8 @@ bool CQ_isEmpty(CQ_handleTypeDef *CircularQueue)
  */
 bool CQ_isFull(CQ_handleTypeDef *CircularQueue)
 {
-    if ((CircularQueue->entrance - CircularQueue->exit) == CircularQueue->size)
+    uint32_t exit = CircularQueue->exit;
+    if ((CircularQueue->entrance - exit) == CircularQueue->size)
     {
         return TRUE;
     }
@@ -122,7 +652,10 @@ bool CQ_isFull(CQ_handleTypeDef *CircularQueue)
  */
 uint32_t CQ_getLength(CQ_handleTypeDef*CircularQueue)
 {
-    return (CircularQueue->entrance - CircularQueue->exit) > CircularQueue->size?CircularQueue->size:(CircularQueue->entrance - CircularQueue->exit);
+    /*两端索引各读取一次，避免读取过程中被另一端修改*/
+    uint32_t exit = CircularQueue->exit;
+    uint32_t len = CircularQueue->entrance - exit;
+    return len > CircularQueue->size?CircularQueue->size:len;
 }
 
 /**
@@ -144,19 +677,7 @@ void CQ_emptyData(CQ_handleTypeDef*CircularQueue)
  */
 uint32_t CQ_getData(CQ_handleTypeDef *CircularQueue ,uint8_t *targetBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-
-    /*此次读取的实际大小，取 可读 和 目标读取数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->entrance - CircularQueue->exit);
-    /*原理雷同存入*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->exit & (CircularQueue->size - 1)));
-    memcpy(targetBuf, CircularQueue->Buffer.data8Buffer + (CircularQueue->exit & (CircularQueue->size - 1)), size);
-    memcpy(targetBuf + size, CircularQueue->Buffer.data8Buffer, len - size);
-  
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->exit += len;
-
-    return len;
+    return CQ_Get_Elements(CircularQueue, targetBuf, len, CQ_ELEM_SHIFT_8BIT, true);
 }
 
 
@@ -169,19 +690,7 @@ uint32_t CQ_getData(CQ_handleTypeDef *CircularQueue ,uint8_t *targetBuf ,uint32_
  */
 uint32_t CQ_putData(CQ_handleTypeDef *CircularQueue ,const uint8_t * sourceBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-    /*此次存入的实际大小，取 剩余空间 和 目标存入数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->size - CircularQueue->entrance + CircularQueue->exit);
-    
-    /*&(size-1)代替取模运算，同上原理，得到此次存入队列入口到末尾的大小*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->entrance & (CircularQueue->size - 1)));
-    memcpy(CircularQueue->Buffer.data8Buffer + (CircularQueue->entrance & (CircularQueue->size - 1)), sourceBuf, size);
-    memcpy(CircularQueue->Buffer.data8Buffer, sourceBuf + size, len - size);
-
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->entrance += len;
-
-    return len;
+    return CQ_Put_Elements(CircularQueue, sourceBuf, len, CQ_ELEM_SHIFT_8BIT);
 }
 
 /**
@@ -196,18 +705,32 @@ uint32_t DQ_putData(CQ_handleTypeDef *CircularQueue ,const uint8_t * sourceBuf ,
     uint32_t size = 0;
     uint32_t lenth = 1;
     uint32_t pack_len = len;
+    uint32_t entrance = CircularQueue->entrance;
+    uint32_t exit = CQ_Load_Exit(CircularQueue);
+    uint32_t offset = entrance & (CircularQueue->size - 1);
+    /*帧头仅一字节，更长的数据包使用MQ_putMsg*/
+    if(pack_len > 0xFFU)
+    {
+        return 0;
+    }
     /*取可存储大小 和 需存大小 小的值*/
-    len = GET_MIN(len+lenth, CircularQueue->size - CircularQueue->entrance + CircularQueue->exit);//长度上头部加上数据长度记录
+    len = GET_MIN(len+lenth, CircularQueue->size - entrance + exit);//长度上头部加上数据长度记录
+    if(len < lenth)
+    {
+        CQ_Stats_Write(CircularQueue, true, 0, 0);
+        return 0;
+    }
 
   /*对kfifo->size取模运算可以转化为与运算，如：kfifo->in % kfifo->size 可以转化为 kfifo->in & (kfifo->size – 1)*/
     /*&(size-1)代替取模运算，同上原理，得到此次存入队列入口到末尾的大小*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->entrance & (CircularQueue->size - 1)));
-    memcpy(CircularQueue->Buffer.data8Buffer + (CircularQueue->entrance & (CircularQueue->size - 1)), &pack_len, lenth);
-    memcpy(CircularQueue->Buffer.data8Buffer + (CircularQueue->entrance & (CircularQueue->size - 1))+lenth, sourceBuf, size-lenth);
+    size = GET_MIN(len, CircularQueue->size - offset);
+    memcpy(CircularQueue->Buffer.data8Buffer + offset, &pack_len, lenth);
+    memcpy(CircularQueue->Buffer.data8Buffer + offset + lenth, sourceBuf, size-lenth);
     memcpy(CircularQueue->Buffer.data8Buffer, sourceBuf + size - lenth, len - size);
 
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->entrance += len;
+    /*利用无符号数据的溢出特性，帧头与数据一并发布*/
+    CQ_Publish_Entrance(CircularQueue, entrance + len);
+    CQ_Stats_Write(CircularQueue, (len < pack_len + lenth), len, entrance + len - exit);
 
     return len;
 }
@@ -220,24 +743,17 @@ uint32_t DQ_putData(CQ_handleTypeDef *CircularQueue ,const uint8_t * sourceBuf ,
  */
 uint32_t DQ_getData(CQ_handleTypeDef *CircularQueue ,uint8_t *targetBuf)
 {
-    uint32_t size = 0;
     uint32_t len = 0;
     /*存储帧头 长度信息*/
     uint8_t package_len[1];
     /*获取长度信息*/
-    CQ_getData(CircularQueue, (uint8_t *)package_len, 1);
+    if(CQ_getData(CircularQueue, (uint8_t *)package_len, 1) == 0)
+    {
+        return 0;
+    }
     len = package_len[0];
     /*此次读取的实际大小，取 剩余可读 和 目标读取数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->entrance - CircularQueue->exit);
-    /*原理雷同存入*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->exit & (CircularQueue->size - 1)));
-    memcpy(targetBuf, CircularQueue->Buffer.data8Buffer + (CircularQueue->exit & (CircularQueue->size - 1)), size);
-    memcpy(targetBuf + size, CircularQueue->Buffer.data8Buffer, len - size);
-  
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->exit += len;
-
-    return len;
+    return CQ_Get_Elements(CircularQueue, targetBuf, len, CQ_ELEM_SHIFT_8BIT, true);
 }
 
 /**
@@ -253,21 +769,8 @@ uint32_t DQ_getData(CQ_handleTypeDef *CircularQueue ,uint8_t *targetBuf)
   */  
 uint32_t CQ_skipInvaildU8Header(CQ_handleTypeDef *cb, uint8_t header_data)
 {
-    uint8_t header = 0;
-    while(CQ_getLength(cb) > 0)
-    {
-        header = CQ_ManualGet_Offset_Data(cb, 0);
-        /*判断帧头*/
-        if(header != header_data)
-        {
-            CQ_ManualOffsetInc(cb, 1);
-        }
-        else
-        {
-            return CQ_getLength(cb);
-        }
-    }
-    return 0;
+    const uint8_t pattern[1] = {header_data};
+    return CQ_Skip_To_Pattern(cb, pattern, sizeof(pattern));
 }
 
 /**
@@ -283,22 +786,8 @@ uint32_t CQ_skipInvaildU8Header(CQ_handleTypeDef *cb, uint8_t header_data)
   */  
 uint32_t CQ_skipInvaildU16Header(CQ_handleTypeDef *cb, uint16_t header_data)
 {
-    uint16_t header = 0;
-    while(CQ_getLength(cb) >= 2)
-    {
-        header = CQ_ManualGet_Offset_Data(cb, 0);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 1))<<8);
-        /*判断帧头*/
-        if(header != header_data)
-        {
-            CQ_ManualOffsetInc(cb, 1);
-        }
-        else
-        {
-            return CQ_getLength(cb);
-        }
-    }
-    return 0;
+    const uint8_t pattern[2] = {(uint8_t)header_data, (uint8_t)(header_data >> 8)};
+    return CQ_Skip_To_Pattern(cb, pattern, sizeof(pattern));
 }
 
 /**
@@ -314,24 +803,9 @@ uint32_t CQ_skipInvaildU16Header(CQ_handleTypeDef *cb, uint16_t header_data)
   */  
 uint32_t CQ_skipInvaildU32Header(CQ_handleTypeDef *cb, uint32_t header_data)
 {
-    uint32_t header = 0;
-    while(CQ_getLength(cb) >= 4)
-    {
-        header = CQ_ManualGet_Offset_Data(cb, 0);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 1))<<8);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 2))<<16);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 3))<<24);
-        /*判断帧头*/
-        if(header != header_data)
-        {
-            CQ_ManualOffsetInc(cb, 1);
-        }
-        else
-        {
-            return CQ_getLength(cb);
-        }
-    }
-    return 0;
+    const uint8_t pattern[4] = {(uint8_t)header_data, (uint8_t)(header_data >> 8),
+                                (uint8_t)(header_data >> 16), (uint8_t)(header_data >> 24)};
+    return CQ_Skip_To_Pattern(cb, pattern, sizeof(pattern));
 }
 
 /**
@@ -347,22 +821,8 @@ uint32_t CQ_skipInvaildU32Header(CQ_handleTypeDef *cb, uint32_t header_data)
   */  
 uint32_t CQ_skipInvaildModbusU16Header(CQ_handleTypeDef *cb, uint16_t header_data)
 {
-    uint16_t header = 0;
-    while(CQ_getLength(cb) >= 2)
-    {
-        header = (((uint16_t)CQ_ManualGet_Offset_Data(cb, 0))<<8);
-        header |= CQ_ManualGet_Offset_Data(cb, 1);
-        /*判断帧头*/
-        if(header != header_data)
-        {
-            CQ_ManualOffsetInc(cb, 1);
-        }
-        else
-        {
-            return CQ_getLength(cb);
-        }
-    }
-    return 0;
+    const uint8_t pattern[2] = {(uint8_t)(header_data >> 8), (uint8_t)header_data};
+    return CQ_Skip_To_Pattern(cb, pattern, sizeof(pattern));
 }
 
 /**
@@ -378,24 +838,9 @@ uint32_t CQ_skipInvaildModbusU16Header(CQ_handleTypeDef *cb, uint16_t header_dat
   */  
 uint32_t CQ_skipInvaildModbusU32Header(CQ_handleTypeDef *cb, uint32_t header_data)
 {
-    uint32_t header = 0;
-    while(CQ_getLength(cb) >= 4)
-    {
-        header = (((uint16_t)CQ_ManualGet_Offset_Data(cb, 0))<<24);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 1))<<16);
-        header |= (((uint16_t)CQ_ManualGet_Offset_Data(cb, 2))<<8);
-        header |= CQ_ManualGet_Offset_Data(cb, 3);
-        /*判断帧头*/
-        if(header != header_data)
-        {
-            CQ_ManualOffsetInc(cb, 1);
-        }
-        else
-        {
-            return CQ_getLength(cb);
-        }
-    }
-    return 0;
+    const uint8_t pattern[4] = {(uint8_t)(header_data >> 24), (uint8_t)(header_data >> 16),
+                                (uint8_t)(header_data >> 8), (uint8_t)header_data};
+    return CQ_Skip_To_Pattern(cb, pattern, sizeof(pattern));
 }
 
 /**
@@ -407,16 +852,7 @@ uint32_t CQ_skipInvaildModbusU32Header(CQ_handleTypeDef *cb, uint32_t header_dat
  */
 uint32_t CQ_ManualGetData(CQ_handleTypeDef *CircularQueue ,uint8_t *targetBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-
-    /*此次读取的实际大小，取 可读 和 目标读取数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->entrance - CircularQueue->exit);
-    /*原理雷同存入*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->exit & (CircularQueue->size - 1)));
-    memcpy(targetBuf, CircularQueue->Buffer.data8Buffer + (CircularQueue->exit & (CircularQueue->size - 1)), size);
-    memcpy(targetBuf + size, CircularQueue->Buffer.data8Buffer, len - size);
-    
-    return len;
+    return CQ_Get_Elements(CircularQueue, targetBuf, len, CQ_ELEM_SHIFT_8BIT, false);
 }
 
 /**
@@ -441,8 +877,304 @@ uint8_t CQ_ManualGet_Offset_Data(CQ_handleTypeDef *CircularQueue, uint32_t index
  */
 void CQ_ManualOffsetInc(CQ_handleTypeDef *CircularQueue ,uint32_t len)
 {
-  len = GET_MIN(CQ_getLength(CircularQueue), len);  
-  CircularQueue->exit += len;
+  uint32_t exit = 0;
+  uint32_t size = 0;
+
+  if(CircularQueue->policy != (uint8_t)CQ_POLICY_OVERWRITE_OLDEST)
+  {
+    len = GET_MIN(CQ_getLength(CircularQueue), len);  
+    CQ_Publish_Exit(CircularQueue, CircularQueue->exit + len);
+  }
+  else
+  {
+    /*覆盖模式下生产者可能同时推进出口*/
+    do
+    {
+      exit = CircularQueue->exit;
+      size = GET_MIN(GET_MIN(CQ_Load_Entrance(CircularQueue) - exit, CircularQueue->size), len);
+    }while(CQ_CAS_Exit(CircularQueue, exit, exit + size) == false);
+    len = size;
+  }
+
+  if(CircularQueue->stats != NULL)
+  {
+    CircularQueue->stats->total_out += len;
+  }
+}
+
+/**
+ * [CQ_registerStats 注册缓冲区统计]
+ * @param  cb   [环形缓冲区句柄]
+ * @param  name [名称，用于打印]
+ * @return      [注册成功状态]
+ */
+bool CQ_registerStats(CQ_handleTypeDef *cb, const char *name)
+{
+    CQ_STATS_NODE_Typedef_t *Node = NULL;
+
+    if(cb == NULL)
+    {
+        return FALSE;
+    }
+    for(uint32_t i = 0; i < CQ_STATS_MAX; i++)
+    {
+        /*重复初始化后再次注册，沿用已有统计*/
+        if(CQ_Stats_List[i].cb == cb)
+        {
+            Node = &CQ_Stats_List[i];
+            break;
+        }
+        if(Node == NULL && CQ_Stats_List[i].cb == NULL)
+        {
+            Node = &CQ_Stats_List[i];
+        }
+    }
+    if(Node == NULL)
+    {
+        return FALSE;
+    }
+    if(Node->cb != cb)
+    {
+        memset(&Node->stats, 0, sizeof(CQ_StatsTypeDef));
+        Node->stats.min_fill = UINT32_MAX;
+        Node->cb = cb;
+    }
+    Node->name = name;
+    cb->stats = &Node->stats;
+    return TRUE;
+}
+
+/**
+ * [CQ_getStats 获取缓冲区统计]
+ * @param  cb [环形缓冲区句柄]
+ * @return    [统计，未注册返回NULL]
+ */
+const CQ_StatsTypeDef *CQ_getStats(CQ_handleTypeDef *cb)
+{
+    return cb->stats;
+}
+
+/**
+ * [CQ_resetStats 清零缓冲区统计，生产者、消费者运行时清零可能丢失当次更新]
+ * @param cb [环形缓冲区句柄]
+ */
+void CQ_resetStats(CQ_handleTypeDef *cb)
+{
+    if(cb->stats == NULL)
+    {
+        return;
+    }
+    memset(cb->stats, 0, sizeof(CQ_StatsTypeDef));
+    cb->stats->min_fill = UINT32_MAX;
+}
+
+/**
+ * [CQ_resetAllStats 清零所有已注册缓冲区统计，运行时清零可能丢失当次更新]
+ */
+void CQ_resetAllStats(void)
+{
+    for(uint32_t i = 0; i < CQ_STATS_MAX; i++)
+    {
+        if(CQ_Stats_List[i].cb != NULL)
+        {
+            CQ_resetStats(CQ_Stats_List[i].cb);
+        }
+    }
+}
+
+/**
+ * [CQ_dumpStats 打印所有已注册缓冲区统计]
+ */
+void CQ_dumpStats(void)
+{
+    const CQ_StatsTypeDef *Stats = NULL;
+
+    printf("name        size  fill  max   min   overrun  underrun total_in   total_out  drop\r\n");
+    for(uint32_t i = 0; i < CQ_STATS_MAX; i++)
+    {
+        if(CQ_Stats_List[i].cb == NULL)
+        {
+            continue;
+        }
+        Stats = &CQ_Stats_List[i].stats;
+        printf("%-11s %-5u %-5u %-5u %-5u %-8u %-8u %-10u %-10u %u\r\n",
+               (CQ_Stats_List[i].name == NULL)?"-":CQ_Stats_List[i].name,
+               (unsigned)CQ_Stats_List[i].cb->size,
+               (unsigned)CQ_getLength(CQ_Stats_List[i].cb),
+               (unsigned)Stats->max_fill,
+               (unsigned)((Stats->min_fill == UINT32_MAX)?0U:Stats->min_fill),
+               (unsigned)Stats->overrun,
+               (unsigned)Stats->underrun,
+               (unsigned)Stats->total_in,
+               (unsigned)Stats->total_out,
+               (unsigned)CQ_Stats_List[i].cb->drop_count);
+    }
+}
+
+/**
+ * [CQ_setPolicy 设置缓冲区满时写入策略]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  policy    [写入策略]
+ * @param  frame_len [覆盖模式下丢弃单位(元素个数)，不可大于缓冲区大小]
+ * @return           [设置成功状态]
+ */
+bool CQ_setPolicy(CQ_handleTypeDef *cb, CQ_POLICY_ENUM_TypeDef policy, uint32_t frame_len)
+{
+    if(frame_len == 0 || frame_len > cb->size)
+    {
+        return FALSE;
+    }
+    cb->frame_len = frame_len;
+    cb->policy = (uint8_t)policy;
+    return TRUE;
+}
+
+/**
+ * [CQ_getDropCount 获取覆盖模式下已丢弃元素总数]
+ * @param  cb [环形缓冲区句柄]
+ * @return    [丢弃元素总数]
+ */
+uint32_t CQ_getDropCount(CQ_handleTypeDef *cb)
+{
+    return cb->drop_count;
+}
+
+/**
+ * [CQ_reserveWrite 预留写入空间，生产者直接在缓冲区内写入后调用CQ_commitWrite发布]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望写入长度]
+ * @param  span          [可写内存段，回绕时分为两段]
+ * @return               [可写入的长度]
+ */
+uint32_t CQ_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Reserve_Elements(CircularQueue, len, CQ_ELEM_SHIFT_8BIT, span);
+}
+
+/**
+ * [CQ_commitWrite 发布预留区内已写入的数据]
+ * @param CircularQueue [环形缓冲区句柄]
+ * @param len           [已写入长度，不可大于预留长度]
+ */
+void CQ_commitWrite(CQ_handleTypeDef *CircularQueue, uint32_t len)
+{
+    uint32_t entrance = CircularQueue->entrance;
+    uint32_t exit = CQ_Load_Exit(CircularQueue);
+
+    len = GET_MIN(len, CircularQueue->size - entrance + exit);
+    CQ_Publish_Entrance(CircularQueue, entrance + len);
+    CQ_Stats_Write(CircularQueue, false, len, entrance + len - exit);
+}
+
+/**
+ * [CQ_peekRead 查看可读数据，消费者直接读取缓冲区后调用CQ_consumeRead释放]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望读取长度]
+ * @param  span          [可读内存段，回绕时分为两段]
+ * @return               [可读取的长度]
+ */
+uint32_t CQ_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Peek_Elements(CircularQueue, len, CQ_ELEM_SHIFT_8BIT, span);
+}
+
+/**
+ * [CQ_consumeRead 释放已读取的数据]
+ * @param CircularQueue [环形缓冲区句柄]
+ * @param len           [已读取长度]
+ */
+void CQ_consumeRead(CQ_handleTypeDef *CircularQueue, uint32_t len)
+{
+    CQ_ManualOffsetInc(CircularQueue, len);
+}
+
+/**
+ * [CQ_DMA_init DMA环形缓冲区初始化，DMA为生产者，缓冲区长度需与DMA循环传输长度一致]
+ * @param  cb         [DMA环形缓冲区句柄]
+ * @param  memAdd     [DMA目标存储区]
+ * @param  len        [缓冲区大小，2的n次方]
+ * @param  dma_remain [DMA剩余传输计数寄存器地址]
+ * @return            [初始化成功状态]
+ */
+bool CQ_DMA_init(CQ_DMA_handleTypeDef *cb, uint8_t *memAdd, uint32_t len, const volatile uint32_t *dma_remain)
+{
+    if(dma_remain == NULL)
+    {
+        return FALSE;
+    }
+    if(CQ_init(&cb->cq, memAdd, len) == FALSE)
+    {
+        return FALSE;
+    }
+    cb->dma_remain = dma_remain;
+    cb->last_pos = (len - *dma_remain) & (len - 1);
+    cb->laps = 0;
+    cb->lap_ref = 0;
+    return TRUE;
+}
+
+/**
+ * [CQ_DMA_sync 依据DMA剩余计数更新入口，消费者可在任意时刻按点读取]
+ * @param  cb [DMA环形缓冲区句柄]
+ * @return    [可读长度，不超过size-(size>>CQ_DMA_GUARD_SHIFT)]
+ * @note      缓冲区应为每次读取量的数倍并在写满一圈前多次同步；
+ *            未在传输完成中断中调用CQ_DMA_lapComplete时，两次同步间隔需小于写满一圈的时间
+ */
+uint32_t CQ_DMA_sync(CQ_DMA_handleTypeDef *cb)
+{
+    uint32_t size = cb->cq.size;
+    uint32_t limit = size - (size >> CQ_DMA_GUARD_SHIFT);
+    /*先取圈数再取写位置，其间回绕时由写位置回绕计入*/
+    uint32_t laps = cb->laps;
+    uint32_t pos = (size - *cb->dma_remain) & (size - 1);
+    uint32_t missed = 0;
+    uint32_t entrance = 0;
+    uint32_t exit = cb->cq.exit;
+    bool over = false;
+
+    /*写位置回绕计一圈，传输完成中断尚未执行时先行计入*/
+    if(pos < cb->last_pos)
+    {
+        cb->lap_ref++;
+    }
+    missed = laps - cb->lap_ref;
+    if((int32_t)missed > 0)
+    {
+        /*中断计数多于回绕次数：两次同步间DMA已写满整圈，写位置相同时同样可识别*/
+        cb->lap_ref = laps;
+    }
+    else
+    {
+        /*未使用中断计数时圈数仅由回绕得出，保持最多领先一圈*/
+        if((int32_t)missed < -1)
+        {
+            cb->lap_ref = laps + 1U;
+        }
+        missed = 0;
+    }
+    entrance = cb->cq.entrance + ((pos - cb->last_pos) & (size - 1)) + missed * size;
+
+    cb->last_pos = pos;
+    /*读取滞后将被DMA覆盖，丢弃最旧数据并留出余量*/
+    if(entrance - exit > limit)
+    {
+        over = true;
+        exit = entrance - limit;
+        CQ_Publish_Exit(&cb->cq, exit);
+    }
+    /*DMA为生产者，写入侧统计由同步时代为更新*/
+    CQ_Stats_Write(&cb->cq, over, entrance - cb->cq.entrance, entrance - exit);
+    CQ_Publish_Entrance(&cb->cq, entrance);
+    return entrance - exit;
+}
+
+/**
+ * [CQ_DMA_lapComplete DMA写满一圈，在循环DMA传输完成中断中调用]
+ * @param cb [DMA环形缓冲区句柄]
+ */
+void CQ_DMA_lapComplete(CQ_DMA_handleTypeDef *cb)
+{
+    cb->laps++;
 }
 
 /**
@@ -457,27 +1189,28 @@ CQ_handleTypeDef *cb_create(uint32_t buffsize)
       return NULL;
   }
   
-  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)calloc(1, sizeof(CQ_handleTypeDef));
+  uint8_t *buf = NULL;
+  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)CQ_MALLOC(sizeof(CQ_handleTypeDef));
   if(NULL == cb)
   {
     return NULL;
   }
   buffsize = (buffsize <= 2048 ? buffsize : 2048);
-  cb->size = buffsize;
-  cb->exit = 0;
-  cb->entrance = 0;
   //the buff never release!
-  cb->Buffer.data8Buffer = (uint8_t *)calloc((size_t)cb->size, sizeof(uint8_t));
-  if(NULL == cb->Buffer.data8Buffer)
+  buf = (uint8_t *)CQ_MALLOC(buffsize * sizeof(uint8_t));
+  if(NULL == buf)
   {
+    CQ_FREE(cb);
     return NULL;
   }
+  /*与静态初始化一致，不依赖内存池清零*/
+  CQ_init(cb, buf, buffsize);
   cb->is_malloc = true;
   return cb;
 }
 
 /**
- * @brief 删除一个缓冲区
+ * @brief 删除一个缓冲区，MCU端内存池不回收，仅主机端释放内存
  * 
  * @param CircularQueue 
  */
@@ -491,8 +1224,8 @@ void cb_delete(CQ_handleTypeDef *CircularQueue)
     {
         return;
     }
-    free(CircularQueue->Buffer.data8Buffer);
-    free(CircularQueue);
+    CQ_FREE(CircularQueue->Buffer.data8Buffer);
+    CQ_FREE(CircularQueue);
 }
 
 /**
@@ -520,10 +1253,39 @@ bool CQ_16_init(CQ_handleTypeDef *CircularQueue ,uint16_t *memAdd ,uint32_t len)
 
     memset(CircularQueue->Buffer.data16Buffer, 0, len*2);
     CircularQueue->entrance = CircularQueue->exit = 0;
+    CircularQueue->policy = (uint8_t)CQ_POLICY_DROP_NEWEST;
+    CircularQueue->frame_len = 1;
+    CircularQueue->drop_count = 0;
+    CircularQueue->stats = NULL;
 
     return TRUE;
 }
 
+/**
+ * [CQ_DMA_16_init 16bit DMA环形缓冲区初始化，DMA为生产者]
+ * @param  cb         [DMA环形缓冲区句柄]
+ * @param  memAdd     [DMA目标存储区]
+ * @param  len        [缓冲区长度，2的n次方]
+ * @param  dma_remain [DMA剩余传输计数寄存器地址]
+ * @return            [初始化成功状态]
+ */
+bool CQ_DMA_16_init(CQ_DMA_handleTypeDef *cb, uint16_t *memAdd, uint32_t len, const volatile uint32_t *dma_remain)
+{
+    if(dma_remain == NULL)
+    {
+        return FALSE;
+    }
+    if(CQ_16_init(&cb->cq, memAdd, len) == FALSE)
+    {
+        return FALSE;
+    }
+    cb->dma_remain = dma_remain;
+    cb->last_pos = (len - *dma_remain) & (len - 1);
+    cb->laps = 0;
+    cb->lap_ref = 0;
+    return TRUE;
+}
+
 /**
  * [cb_16create 动态申请并初始化环形缓冲区]
  * @param  buffsize [申请环形缓冲区大小]
@@ -536,22 +1298,23 @@ CQ_handleTypeDef *cb_16create(uint32_t buffsize)
         return NULL;
     }
   
-  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)calloc(1, sizeof(CQ_handleTypeDef));
+  uint16_t *buf = NULL;
+  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)CQ_MALLOC(sizeof(CQ_handleTypeDef));
   if(NULL == cb)
   {
     return NULL;
   }
   buffsize = (buffsize <= 2048 ? buffsize : 2048);
-  cb->size = buffsize;
-  cb->exit = 0;
-  cb->entrance = 0;
   //the buff never release!
-  cb->Buffer.data16Buffer = (uint16_t *)calloc((size_t)cb->size, sizeof(uint16_t));
-  if(NULL == cb->Buffer.data16Buffer)
+  buf = (uint16_t *)CQ_MALLOC(buffsize * sizeof(uint16_t));
+  if(NULL == buf)
   {
+    CQ_FREE(cb);
     return NULL;
   }
-    cb->is_malloc = true;
+  /*与静态初始化一致，不依赖内存池清零*/
+  CQ_16_init(cb, buf, buffsize);
+  cb->is_malloc = true;
   return cb;
 }
 
@@ -564,26 +1327,174 @@ CQ_handleTypeDef *cb_16create(uint32_t buffsize)
  */
 uint32_t CQ_16getData(CQ_handleTypeDef *CircularQueue ,uint16_t *targetBuf ,uint32_t len)
 {
+    return CQ_Get_Elements(CircularQueue, targetBuf, len, CQ_ELEM_SHIFT_16BIT, true);
+}
+
+
+/**
+ * [CQ_16_reserveWrite 预留16bit写入空间]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望写入长度]
+ * @param  span          [可写内存段]
+ * @return               [可写入的长度]
+ */
+uint32_t CQ_16_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Reserve_Elements(CircularQueue, len, CQ_ELEM_SHIFT_16BIT, span);
+}
+
+/**
+ * [CQ_16_peekRead 查看16bit可读数据]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望读取长度]
+ * @param  span          [可读内存段]
+ * @return               [可读取的长度]
+ */
+uint32_t CQ_16_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Peek_Elements(CircularQueue, len, CQ_ELEM_SHIFT_16BIT, span);
+}
+
+/**
+ * [CQ_16putInterleaved 多通道数据交织后直接写入缓冲区，空间不足时仅写入完整帧，覆盖模式下超出缓冲区时保留最新帧]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  channels      [各通道数据地址]
+ * @param  ch_num        [通道数]
+ * @param  stride        [同一通道相邻两点间隔(元素个数)，连续存放为1]
+ * @param  frames        [每通道点数]
+ * @return               [写入的帧数]
+ */
+uint32_t CQ_16putInterleaved(CQ_handleTypeDef *CircularQueue, const uint16_t * const *channels, uint32_t ch_num, uint32_t stride, uint32_t frames)
+{
+    CQ_SpanTypeDef Span;
+    uint16_t *Ptr = NULL;
+    uint32_t want = frames;
     uint32_t size = 0;
-    uint32_t len_temp = 0;
-    uint32_t size_temp = 0;
-    /*此次读取的实际大小，取 可读 和 目标读取数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->entrance - CircularQueue->exit);
-    /*原理雷同存入*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->exit & (CircularQueue->size - 1)));
-    
-    len_temp = 2*len;
-    size_temp = 2*size;
-
-    memcpy(targetBuf, CircularQueue->Buffer.data16Buffer + (CircularQueue->exit & (CircularQueue->size - 1)), size_temp);
-    memcpy(targetBuf + size, CircularQueue->Buffer.data16Buffer, len_temp - size_temp);
-  
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->exit += len;
+    uint32_t len = 0;
+    uint32_t ch = 0;
+    uint32_t index = 0;
+    uint32_t n = 0;
 
-    return len;
+    if(ch_num == 0)
+    {
+        return 0;
+    }
+    len = CQ_Reserve_Elements(CircularQueue, frames * ch_num, CQ_ELEM_SHIFT_16BIT, &Span);
+    frames = len / ch_num;
+    len = frames * ch_num;
+
+    /*覆盖模式下仅在超出缓冲区时帧数不足，跳过最旧的帧，与CQ_xxputData一致*/
+    if(CircularQueue->policy == (uint8_t)CQ_POLICY_OVERWRITE_OLDEST && frames < want)
+    {
+        index = (want - frames) * stride;
+        CircularQueue->drop_count += (want - frames) * ch_num;
+    }
+
+    /*依次写入两段连续区，通道序号与点序号跨段延续*/
+    for(uint32_t seg = 0; seg < 2U; seg++)
+    {
+        Ptr = (uint16_t *)((seg == 0U)?Span.first:Span.second);
+        size = (seg == 0U)?GET_MIN(len, Span.first_len):(len - GET_MIN(len, Span.first_len));
+        while(size > 0U)
+        {
+            /*位于帧起始且4字节对齐时整帧写入，其余逐点写入*/
+            if(ch == 0U && (ch_num & 1U) == 0U && size >= ch_num && ((uintptr_t)Ptr & 3U) == 0U)
+            {
+                n = size / ch_num;
+                index = CQ_16_Interleave_Frames(Ptr, channels, ch_num, stride, index, n);
+                Ptr += n * ch_num;
+                size -= n * ch_num;
+                continue;
+            }
+            *Ptr++ = channels[ch][index];
+            size--;
+            if(++ch == ch_num)
+            {
+                ch = 0;
+                index += stride;
+            }
+        }
+    }
+
+    CQ_commitWrite(CircularQueue, len);
+    return frames;
 }
 
+/**
+ * [CQ_16getDeinterleaved 由交织缓冲区按通道取出数据，仅取出完整帧]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  channels      [各通道目标地址，为NULL的通道丢弃]
+ * @param  ch_num        [缓冲区内交织通道数]
+ * @param  stride        [目标区同一通道相邻两点间隔(元素个数)，连续存放为1]
+ * @param  frames        [期望读取帧数]
+ * @return               [读取的帧数]
+ */
+uint32_t CQ_16getDeinterleaved(CQ_handleTypeDef *CircularQueue, uint16_t * const *channels, uint32_t ch_num, uint32_t stride, uint32_t frames)
+{
+    CQ_SpanTypeDef Span;
+    const uint16_t *Ptr = NULL;
+    uint32_t want = frames;
+    uint32_t exit = 0;
+    uint32_t avail = 0;
+    uint32_t size = 0;
+    uint32_t len = 0;
+    uint32_t ch = 0;
+    uint32_t index = 0;
+
+    if(ch_num == 0)
+    {
+        return 0;
+    }
+
+    for(;;)
+    {
+        exit = CircularQueue->exit;
+        avail = GET_MIN(CQ_Load_Entrance(CircularQueue) - exit, CircularQueue->size);
+        frames = GET_MIN(want, avail / ch_num);
+        len = frames * ch_num;
+        CQ_Span_Calc(CircularQueue, exit, len, CQ_ELEM_SHIFT_16BIT, &Span);
+
+        /*依次读取两段连续区，按通道分发到各目标区*/
+        ch = 0;
+        index = 0;
+        for(uint32_t seg = 0; seg < 2U; seg++)
+        {
+            Ptr = (const uint16_t *)((seg == 0U)?Span.first:Span.second);
+            size = (seg == 0U)?Span.first_len:Span.second_len;
+            while(size-- > 0U)
+            {
+                if(channels[ch] != NULL)
+                {
+                    channels[ch][index] = *Ptr;
+                }
+                Ptr++;
+                if(++ch == ch_num)
+                {
+                    ch = 0;
+                    index += stride;
+                }
+            }
+        }
+
+        if(CircularQueue->policy != (uint8_t)CQ_POLICY_OVERWRITE_OLDEST)
+        {
+            CQ_Publish_Exit(CircularQueue, exit + len);
+            break;
+        }
+        /*覆盖模式：读取期间被覆盖则重新读取*/
+        if(CQ_CAS_Exit(CircularQueue, exit, exit + len) == true)
+        {
+            break;
+        }
+    }
+
+    CQ_Stats_Read(CircularQueue, want * ch_num, avail);
+    if(CircularQueue->stats != NULL)
+    {
+        CircularQueue->stats->total_out += len;
+    }
+    return frames;
+}
 
 /**
  * [CQ_16putData 加入数据]
@@ -594,25 +1505,7 @@ uint32_t CQ_16getData(CQ_handleTypeDef *CircularQueue ,uint16_t *targetBuf ,uint
  */
 uint32_t CQ_16putData(CQ_handleTypeDef *CircularQueue ,const uint16_t *sourceBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-    uint32_t len_temp = 0;
-    uint32_t size_temp = 0;
-    /*此次存入的实际大小，取 剩余空间 和 目标存入数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->size - CircularQueue->entrance + CircularQueue->exit);
-    
-    /*&(size-1)代替取模运算，同上原理，得到此次存入队列入口到末尾的大小*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->entrance & (CircularQueue->size - 1)));
-
-    len_temp = 2*len;
-    size_temp = 2*size;
-
-    memcpy(CircularQueue->Buffer.data16Buffer + (CircularQueue->entrance & (CircularQueue->size - 1)), sourceBuf, size_temp);
-    memcpy(CircularQueue->Buffer.data16Buffer, sourceBuf + size, len_temp - size_temp);
-
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->entrance += len; //写入数据记录
-
-    return len;
+    return CQ_Put_Elements(CircularQueue, sourceBuf, len, CQ_ELEM_SHIFT_16BIT);
 }
 
 /**
@@ -640,6 +1533,10 @@ bool CQ_32_init(CQ_handleTypeDef *CircularQueue, uint32_t *memAdd, uint32_t len)
 
     memset(CircularQueue->Buffer.data32Buffer, 0, len*4);
     CircularQueue->entrance = CircularQueue->exit = 0;
+    CircularQueue->policy = (uint8_t)CQ_POLICY_DROP_NEWEST;
+    CircularQueue->frame_len = 1;
+    CircularQueue->drop_count = 0;
+    CircularQueue->stats = NULL;
 
     return TRUE;
 }
@@ -656,22 +1553,22 @@ CQ_handleTypeDef *cb_32create(uint32_t buffsize)
         return NULL;
     }
   
-  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)calloc(1, sizeof(CQ_handleTypeDef));
+  uint32_t *buf = NULL;
+  CQ_handleTypeDef *cb = (CQ_handleTypeDef *)CQ_MALLOC(sizeof(CQ_handleTypeDef));
   if(NULL == cb)
   {
     return NULL;
   }
   buffsize = (buffsize <= 2048 ? buffsize : 2048);
-  cb->size = buffsize;
-  cb->exit = 0;
-  cb->entrance = 0;
-
-  cb->Buffer.data32Buffer = (uint32_t *)calloc((size_t)cb->size, sizeof(uint32_t));
-  if(NULL == cb->Buffer.data32Buffer)
+  buf = (uint32_t *)CQ_MALLOC(buffsize * sizeof(uint32_t));
+  if(NULL == buf)
   {
+    CQ_FREE(cb);
     return NULL;
   }
-    cb->is_malloc = true;
+  /*与静态初始化一致，不依赖内存池清零*/
+  CQ_32_init(cb, buf, buffsize);
+  cb->is_malloc = true;
   return cb;
 }
 
@@ -684,25 +1581,31 @@ CQ_handleTypeDef *cb_32create(uint32_t buffsize)
  */
 uint32_t CQ_32putData(CQ_handleTypeDef *CircularQueue ,const uint32_t * sourceBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-    uint32_t len_temp = 0;
-    uint32_t size_temp = 0;
-    /*此次存入的实际大小，取 剩余空间 和 目标存入数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->size - CircularQueue->entrance + CircularQueue->exit);
-    
-    /*&(size-1)代替取模运算，同上原理，得到此次存入队列入口到末尾的大小*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->entrance & (CircularQueue->size - 1)));
-
-    len_temp = 4*len;
-    size_temp = 4*size;
-
-    memcpy(CircularQueue->Buffer.data32Buffer + (CircularQueue->entrance & (CircularQueue->size - 1)), sourceBuf, size_temp);
-    memcpy(CircularQueue->Buffer.data32Buffer, sourceBuf + size, len_temp - size_temp);
+    return CQ_Put_Elements(CircularQueue, sourceBuf, len, CQ_ELEM_SHIFT_32BIT);
+}
 
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->entrance += len;
+/**
+ * [CQ_32_reserveWrite 预留32bit写入空间]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望写入长度]
+ * @param  span          [可写内存段]
+ * @return               [可写入的长度]
+ */
+uint32_t CQ_32_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Reserve_Elements(CircularQueue, len, CQ_ELEM_SHIFT_32BIT, span);
+}
 
-    return len;
+/**
+ * [CQ_32_peekRead 查看32bit可读数据]
+ * @param  CircularQueue [环形缓冲区句柄]
+ * @param  len           [期望读取长度]
+ * @param  span          [可读内存段]
+ * @return               [可读取的长度]
+ */
+uint32_t CQ_32_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span)
+{
+    return CQ_Peek_Elements(CircularQueue, len, CQ_ELEM_SHIFT_32BIT, span);
 }
 
 /**
@@ -714,24 +1617,7 @@ uint32_t CQ_32putData(CQ_handleTypeDef *CircularQueue ,const uint32_t * sourceBu
  */
 uint32_t CQ_32getData(CQ_handleTypeDef *CircularQueue ,uint32_t *targetBuf ,uint32_t len)
 {
-    uint32_t size = 0;
-    uint32_t len_temp = 0;
-    uint32_t size_temp = 0;
-    /*此次读取的实际大小，取 可读 和 目标读取数量  两个值小的那个*/
-    len = GET_MIN(len, CircularQueue->entrance - CircularQueue->exit);
-    /*原理雷同存入*/
-    size = GET_MIN(len, CircularQueue->size - (CircularQueue->exit & (CircularQueue->size - 1)));
-    
-    len_temp = 4*len;
-    size_temp = 4*size;
-
-    memcpy(targetBuf, CircularQueue->Buffer.data32Buffer + (CircularQueue->exit & (CircularQueue->size - 1)), size_temp);
-    memcpy(targetBuf + size, CircularQueue->Buffer.data32Buffer, len_temp - size_temp);
-    
-    /*利用无符号数据的溢出特性*/
-    CircularQueue->exit += len;
-
-    return len;
+    return CQ_Get_Elements(CircularQueue, targetBuf, len, CQ_ELEM_SHIFT_32BIT, true);
 }
 
 #ifdef __cplusplus ///<end extern c
@@ -6,8 +6,22 @@
  *  @author aron566
  *
  *  @brief 缓冲区大小需为2的n次方(最高位为1其余为0)
+ *
+ *  @details 单生产者单消费者(SPSC)无锁:
+ *           1、入口entrance仅由生产者写入，出口exit仅由消费者写入
+ *           2、数据拷贝完成后才以屏障方式发布索引，可在中断与主循环间直接使用无需关中断
+ *           3、CQ_init/CQ_emptyData会同时复位两端索引，需在生产者、消费者均停止时调用
+ *
+ *           覆盖模式(CQ_POLICY_OVERWRITE_OLDEST):
+ *           1、缓冲区满时生产者以整帧为单位丢弃最旧数据，出口改为比较交换更新
+ *           2、CQ_xxgetData读取期间若被覆盖会自动重读，peek/consume期间需保证生产者不会打断消费者
+ *           3、DQ_putData不受策略影响
+ *
+ *           统计(CQ_registerStats注册后启用):
+ *           1、最高/最低水位、空间不足与数据不足次数、累计写入/读出元素数
+ *           2、生产者、消费者各自只更新自己一侧的统计项，无需关中断
  *  
- *  @version v1.3
+ *  @version v1.6
  */
 #ifndef CIRCULARQUEUE_H_
 #define CIRCULARQUEUE_H_
@@ -23,8 +37,48 @@ extern "C" {
 #include <string.h>
 /** Private includes ---------------------------------------------------------*/
 /** Private defines ----------------------------------------------------------*/
+#ifndef USE_LINUX_SYSTEM
+  #define USE_LINUX_SYSTEM    0   /**< 主机端(Linux)编译时置1*/
+#endif
+
+/*生产者、消费者索引间隔，主机端按Cache行隔离避免伪共享，M4无Cache不填充*/
+#ifndef CQ_CACHE_LINE_SIZE
+  #if USE_LINUX_SYSTEM
+    #define CQ_CACHE_LINE_SIZE  64U
+  #else
+    #define CQ_CACHE_LINE_SIZE  0U
+  #endif
+#endif
+
+/*可注册统计的缓冲区数量*/
+#ifndef CQ_STATS_MAX
+  #define CQ_STATS_MAX        8U
+#endif
+
+/*DMA环形缓冲区可读上限为size-(size>>CQ_DMA_GUARD_SHIFT)，留出余量避免读取正被DMA覆盖的数据*/
+#ifndef CQ_DMA_GUARD_SHIFT
+  #define CQ_DMA_GUARD_SHIFT  2U
+#endif
     
 /** Exported typedefines -----------------------------------------------------*/
+/*缓冲区满时写入策略*/
+typedef enum
+{
+	CQ_POLICY_DROP_NEWEST = 0,      /**< 截断新数据(默认)*/
+	CQ_POLICY_OVERWRITE_OLDEST,     /**< 整帧丢弃最旧数据，限制实时数据延迟*/
+}CQ_POLICY_ENUM_TypeDef;
+
+/** 缓冲区统计*/
+typedef struct
+{
+	uint32_t max_fill;            /**< 写入后最高水位(生产者更新)*/
+	uint32_t min_fill;            /**< 读取时最低水位(消费者更新)*/
+	uint32_t overrun;             /**< 空间不足次数，含截断与覆盖(生产者更新)*/
+	uint32_t underrun;            /**< 可读数据不足次数(消费者更新)*/
+	uint32_t total_in;            /**< 累计写入元素数(生产者更新)*/
+	uint32_t total_out;           /**< 累计读出元素数(消费者更新)*/
+}CQ_StatsTypeDef;
+
 /** 数据结构体*/
 typedef struct
 {
@@ -35,11 +89,40 @@ typedef struct
 		uint64_t 	*data64Buffer;	/**< for 64bit buffer*/
 	}Buffer;
 	uint32_t size;
-	uint32_t entrance;
-	uint32_t exit;
 	bool is_malloc;
+	uint8_t policy;               /**< 写入策略 CQ_POLICY_ENUM_TypeDef*/
+	uint32_t frame_len;           /**< 覆盖模式丢弃单位(元素个数)*/
+	volatile uint32_t drop_count; /**< 覆盖模式已丢弃元素总数(生产者独占写入)*/
+	CQ_StatsTypeDef *stats;       /**< 统计，未注册时为NULL*/
+	volatile uint32_t entrance;   /**< 生产者独占写入*/
+#if CQ_CACHE_LINE_SIZE > 0
+	uint8_t entrance_pad[CQ_CACHE_LINE_SIZE - sizeof(uint32_t)];
+#endif
+	volatile uint32_t exit;       /**< 消费者独占写入*/
+#if CQ_CACHE_LINE_SIZE > 0
+	uint8_t exit_pad[CQ_CACHE_LINE_SIZE - sizeof(uint32_t)];
+#endif
 }CQ_handleTypeDef;
 
+/** DMA环形缓冲区，生产者为循环模式DMA，入口由DMA剩余传输计数推导*/
+typedef struct
+{
+	CQ_handleTypeDef cq;                  /**< 环形队列，同步后按常规接口读取*/
+	const volatile uint32_t *dma_remain;  /**< DMA剩余传输计数寄存器(NDTR)*/
+	uint32_t last_pos;                    /**< 上次同步时DMA写位置*/
+	volatile uint32_t laps;               /**< DMA传输完成(写满一圈)次数，传输完成中断中累加*/
+	uint32_t lap_ref;                     /**< 同步已计入的圈数*/
+}CQ_DMA_handleTypeDef;
+
+/** 缓冲区内连续内存段，回绕时拆分为两段*/
+typedef struct
+{
+	void *first;            /**< 第一段起始地址*/
+	uint32_t first_len;     /**< 第一段元素个数*/
+	void *second;           /**< 第二段起始地址(缓冲区头部)*/
+	uint32_t second_len;    /**< 第二段元素个数*/
+}CQ_SpanTypeDef;
+
 /*缓冲区大小*/
 typedef enum
 {
@@ -80,9 +163,38 @@ uint32_t CQ_skipInvaildModbusU32Header(CQ_handleTypeDef *cb, uint32_t header_dat
 /*低位在前-高位在后*/
 uint32_t CQ_skipInvaildU32Header(CQ_handleTypeDef *cb, uint32_t header_data);
 uint32_t CQ_skipInvaildU16Header(CQ_handleTypeDef *cb, uint16_t header_data);
+/*设置缓冲区满时写入策略，frame_len为覆盖模式下丢弃单位，需在CQ_xx_init之后调用*/
+bool CQ_setPolicy(CQ_handleTypeDef *cb, CQ_POLICY_ENUM_TypeDef policy, uint32_t frame_len);
+/*获取覆盖模式下已丢弃元素总数*/
+uint32_t CQ_getDropCount(CQ_handleTypeDef *cb);
+/*注册缓冲区统计，需在CQ_xx_init之后调用，重复注册同一缓冲区时保留已有统计*/
+bool CQ_registerStats(CQ_handleTypeDef *cb, const char *name);
+/*获取缓冲区统计，未注册返回NULL*/
+const CQ_StatsTypeDef *CQ_getStats(CQ_handleTypeDef *cb);
+/*清零缓冲区统计*/
+void CQ_resetStats(CQ_handleTypeDef *cb);
+/*清零所有已注册缓冲区统计*/
+void CQ_resetAllStats(void);
+/*打印所有已注册缓冲区统计*/
+void CQ_dumpStats(void);
 /*删除一个由cb_xxcreate创建的缓冲区*/
 void cb_delete(CQ_handleTypeDef *CircularQueue);
 
+/*============================ DMA Ring ===============================*/
+/*DMA环形缓冲区初始化，需在启动循环DMA之前调用*/
+bool CQ_DMA_init(CQ_DMA_handleTypeDef *cb, uint8_t *memAdd, uint32_t len, const volatile uint32_t *dma_remain);
+bool CQ_DMA_16_init(CQ_DMA_handleTypeDef *cb, uint16_t *memAdd, uint32_t len, const volatile uint32_t *dma_remain);
+/*依据DMA剩余计数更新入口，返回可读长度，消费者读取前调用*/
+uint32_t CQ_DMA_sync(CQ_DMA_handleTypeDef *cb);
+/*DMA传输完成中断中调用，用于识别两次同步间写满整圈*/
+void CQ_DMA_lapComplete(CQ_DMA_handleTypeDef *cb);
+
+/*============================ Zero Copy ==============================*/
+/*提交预留区内已写入的数据，与CQ_xx_reserveWrite配合使用*/
+void CQ_commitWrite(CQ_handleTypeDef *CircularQueue, uint32_t len);
+/*释放已读取的数据，与CQ_xx_peekRead配合使用*/
+void CQ_consumeRead(CQ_handleTypeDef *CircularQueue, uint32_t len);
+
 /*===========================8 Bit Option==============================*/
 bool CQ_init(CQ_handleTypeDef *CircularQueue, uint8_t *memAdd, uint32_t len);
 /*分配一个缓冲区并进行初始化--替代--CQ_init*/
@@ -99,6 +211,10 @@ uint32_t DQ_getData(CQ_handleTypeDef *CircularQueue, uint8_t *targetBuf);
 uint32_t CQ_ManualGetData(CQ_handleTypeDef *CircularQueue, uint8_t *targetBuf, uint32_t len);
 /*修改后的获取数据操作--读取指定偏移的数据，不会减小缓冲区长度,目的为了验证数据，判断帧头等*/
 uint8_t CQ_ManualGet_Offset_Data(CQ_handleTypeDef *CircularQueue, uint32_t index);
+/*预留写入空间--返回缓冲区内可直接写入的内存段*/
+uint32_t CQ_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
+/*查看可读数据--返回缓冲区内可直接读取的内存段，不会减小缓冲区长度*/
+uint32_t CQ_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
 
 /*===========================16 Bit Option==============================*/
 /*16bit环形缓冲区初始化*/
@@ -109,6 +225,14 @@ CQ_handleTypeDef *cb_16create(uint32_t buffsize);
 uint32_t CQ_16putData(CQ_handleTypeDef *CircularQueue, const uint16_t * sourceBuf, uint32_t len);
 /*取出16bit类型数据*/
 uint32_t CQ_16getData(CQ_handleTypeDef *CircularQueue, uint16_t *targetBuf, uint32_t len);
+/*预留16bit写入空间*/
+uint32_t CQ_16_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
+/*查看16bit可读数据*/
+uint32_t CQ_16_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
+/*多通道16bit数据交织写入，返回写入帧数*/
+uint32_t CQ_16putInterleaved(CQ_handleTypeDef *CircularQueue, const uint16_t * const *channels, uint32_t ch_num, uint32_t stride, uint32_t frames);
+/*由交织缓冲区按通道取出16bit数据，返回读取帧数*/
+uint32_t CQ_16getDeinterleaved(CQ_handleTypeDef *CircularQueue, uint16_t * const *channels, uint32_t ch_num, uint32_t stride, uint32_t frames);
 
 /*===========================32 Bit Option==============================*/
 /*32bit环形缓冲区初始化*/
@@ -119,6 +243,10 @@ CQ_handleTypeDef *cb_32create(uint32_t buffsize);
 uint32_t CQ_32putData(CQ_handleTypeDef *CircularQueue, const uint32_t * sourceBuf, uint32_t len);
 /*取出32bit类型数据*/
 uint32_t CQ_32getData(CQ_handleTypeDef *CircularQueue, uint32_t *targetBuf, uint32_t len);
+/*预留32bit写入空间*/
+uint32_t CQ_32_reserveWrite(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
+/*查看32bit可读数据*/
+uint32_t CQ_32_peekRead(CQ_handleTypeDef *CircularQueue, uint32_t len, CQ_SpanTypeDef *span);
 
 #ifdef __cplusplus ///<end extern c
 }
@@ -0,0 +1,731 @@
+/**
+ *  @file DspTables.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 常量表
+ *
+ *  @details 由Tools/gen_tables.py生成，勿手工修改
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "DspTables.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/*电平表：10^(-k/20)，k为0至120 dB*/
+const q31_t DT_Db_Gain_q31[121] =
+{
+     2147483647,  1913946816,  1705806895,  1520301996,  1354970580,  1207618800,
+     1076291389,   959245710,   854928639,   761955951,   679093957,   605243126,
+      539423504,   480761704,   428479319,   381882595,   340353221,   303340128,
+      270352174,   240951628,   214748365,   191394682,   170580690,   152030200,
+      135497058,   120761880,   107629139,    95924571,    85492864,    76195595,
+       67909396,    60524313,    53942350,    48076170,    42847932,    38188260,
+       34035322,    30334013,    27035217,    24095163,    21474836,    19139468,
+       17058069,    15203020,    13549706,    12076188,    10762914,     9592457,
+        8549286,     7619560,     6790940,     6052431,     5394235,     4807617,
+        4284793,     3818826,     3403532,     3033401,     2703522,     2409516,
+        2147484,     1913947,     1705807,     1520302,     1354971,     1207619,
+        1076291,      959246,      854929,      761956,      679094,      605243,
+         539424,      480762,      428479,      381883,      340353,      303340,
+         270352,      240952,      214748,      191395,      170581,      152030,
+         135497,      120762,      107629,       95925,       85493,       76196,
+          67909,       60524,       53942,       48076,       42848,       38188,
+          34035,       30334,       27035,       24095,       21475,       19139,
+          17058,       15203,       13550,       12076,       10763,        9592,
+           8549,        7620,        6791,        6052,        5394,        4808,
+           4285,        3819,        3404,        3033,        2704,        2410,
+           2147
+};
+
+/*电平细分表：10^(-k/200)，k为0至9，即0至-0.9dB*/
+const q31_t DT_Db_Gain_Frac_q31[10] =
+{
+     2147483647,  2122901606,  2098600952,  2074578466,  2050830962,
+     2027355295,  2004148350,  1981207054,  1958528364,  1936109276
+};
+
+/*Hann窗，周期形式，512点*/
+const q15_t DT_Hann_q15[512] =
+{
+         0,      1,      5,     11,     20,     31,     44,     60,     79,    100,    123,    149,
+       177,    208,    241,    277,    315,    355,    398,    443,    491,    541,    593,    648,
+       705,    765,    827,    891,    958,   1027,   1098,   1171,   1247,   1325,   1406,   1488,
+      1573,   1660,   1749,   1841,   1935,   2030,   2128,   2229,   2331,   2435,   2542,   2651,
+      2761,   2874,   2989,   3105,   3224,   3345,   3468,   3592,   3719,   3847,   3978,   4110,
+      4244,   4380,   4518,   4657,   4799,   4942,   5087,   5233,   5381,   5531,   5682,   5835,
+      5990,   6146,   6304,   6463,   6624,   6786,   6950,   7115,   7282,   7449,   7619,   7789,
+      7961,   8134,   8308,   8484,   8661,   8839,   9018,   9198,   9379,   9561,   9745,   9929,
+     10114,  10300,  10487,  10676,  10864,  11054,  11245,  11436,  11628,  11821,  12014,  12208,
+     12403,  12598,  12794,  12991,  13188,  13385,  13583,  13781,  13980,  14179,  14378,  14578,
+     14778,  14978,  15179,  15379,  15580,  15781,  15982,  16183,  16384,  16585,  16786,  16987,
+     17188,  17389,  17589,  17790,  17990,  18190,  18390,  18589,  18788,  18987,  19185,  19383,
+     19580,  19777,  19974,  20170,  20365,  20560,  20754,  20947,  21140,  21332,  21523,  21714,
+     21904,  22092,  22281,  22468,  22654,  22839,  23023,  23207,  23389,  23570,  23750,  23929,
+     24107,  24284,  24460,  24634,  24807,  24979,  25149,  25319,  25486,  25653,  25818,  25982,
+     26144,  26305,  26464,  26622,  26778,  26933,  27086,  27237,  27387,  27535,  27681,  27826,
+     27969,  28111,  28250,  28388,  28524,  28658,  28790,  28921,  29049,  29176,  29300,  29423,
+     29544,  29663,  29779,  29894,  30007,  30117,  30226,  30333,  30437,  30539,  30640,  30738,
+     30833,  30927,  31019,  31108,  31195,  31280,  31362,  31443,  31521,  31597,  31670,  31741,
+     31810,  31877,  31941,  32003,  32063,  32120,  32175,  32227,  32277,  32325,  32370,  32413,
+     32453,  32491,  32527,  32560,  32591,  32619,  32645,  32668,  32689,  32708,  32724,  32737,
+     32748,  32757,  32763,  32767,  32767,  32767,  32763,  32757,  32748,  32737,  32724,  32708,
+     32689,  32668,  32645,  32619,  32591,  32560,  32527,  32491,  32453,  32413,  32370,  32325,
+     32277,  32227,  32175,  32120,  32063,  32003,  31941,  31877,  31810,  31741,  31670,  31597,
+     31521,  31443,  31362,  31280,  31195,  31108,  31019,  30927,  30833,  30738,  30640,  30539,
+     30437,  30333,  30226,  30117,  30007,  29894,  29779,  29663,  29544,  29423,  29300,  29176,
+     29049,  28921,  28790,  28658,  28524,  28388,  28250,  28111,  27969,  27826,  27681,  27535,
+     27387,  27237,  27086,  26933,  26778,  26622,  26464,  26305,  26144,  25982,  25818,  25653,
+     25486,  25319,  25149,  24979,  24807,  24634,  24460,  24284,  24107,  23929,  23750,  23570,
+     23389,  23207,  23023,  22839,  22654,  22468,  22281,  22092,  21904,  21714,  21523,  21332,
+     21140,  20947,  20754,  20560,  20365,  20170,  19974,  19777,  19580,  19383,  19185,  18987,
+     18788,  18589,  18390,  18190,  17990,  17790,  17589,  17389,  17188,  16987,  16786,  16585,
+     16384,  16183,  15982,  15781,  15580,  15379,  15179,  14978,  14778,  14578,  14378,  14179,
+     13980,  13781,  13583,  13385,  13188,  12991,  12794,  12598,  12403,  12208,  12014,  11821,
+     11628,  11436,  11245,  11054,  10864,  10676,  10487,  10300,  10114,   9929,   9745,   9561,
+      9379,   9198,   9018,   8839,   8661,   8484,   8308,   8134,   7961,   7789,   7619,   7449,
+      7282,   7115,   6950,   6786,   6624,   6463,   6304,   6146,   5990,   5835,   5682,   5531,
+      5381,   5233,   5087,   4942,   4799,   4657,   4518,   4380,   4244,   4110,   3978,   3847,
+      3719,   3592,   3468,   3345,   3224,   3105,   2989,   2874,   2761,   2651,   2542,   2435,
+      2331,   2229,   2128,   2030,   1935,   1841,   1749,   1660,   1573,   1488,   1406,   1325,
+      1247,   1171,   1098,   1027,    958,    891,    827,    765,    705,    648,    593,    541,
+       491,    443,    398,    355,    315,    277,    241,    208,    177,    149,    123,    100,
+        79,     60,     44,     31,     20,     11,      5,      1
+};
+
+const q31_t DT_Hann_q31[512] =
+{
+              0,       80851,      323391,      727584,     1293369,     2020661,
+        2909350,     3959303,     5170360,     6542341,     8075038,     9768221,
+       11621634,    13634998,    15808011,    18140345,    20631648,    23281546,
+       26089639,    29055505,    32178697,    35458744,    38895153,    42487406,
+       46234962,    50137257,    54193703,    58403690,    62766582,    67281724,
+       71948434,    76766012,    81733730,    86850840,    92116573,    97530136,
+      103090712,   108797464,   114649534,   120646039,   126786077,   133068723,
+      139493031,   146058034,   152762742,   159606146,   166587216,   173704900,
+      180958126,   188345802,   195866815,   203520034,   211304304,   219218454,
+      227261293,   235431608,   243728170,   252149729,   260695016,   269362745,
+      278151611,   287060290,   296087440,   305231702,   314491699,   323866036,
+      333353302,   342952067,   352660887,   362478299,   372402824,   382432969,
+      392567222,   402804057,   413141934,   423579294,   434114566,   444746164,
+      455472486,   466291918,   477202829,   488203576,   499292504,   510467941,
+      521728206,   533071601,   544496420,   556000941,   567583432,   579242148,
+      590975335,   602781224,   614658038,   626603989,   638617276,   650696092,
+      662838617,   675043023,   687307471,   699630115,   712009098,   724442558,
+      736928620,   749465405,   762051025,   774683585,   787361181,   800081906,
+      812843842,   825645069,   838483659,   851357677,   864265186,   877204241,
+      890172894,   903169191,   916191177,   929236889,   942304362,   955391630,
+      968496721,   981617661,   994752475,  1007899185,  1021055810,  1034220369,
+     1047390881,  1060565360,  1073741824,  1086918288,  1100092767,  1113263279,
+     1126427838,  1139584463,  1152731173,  1165865987,  1178986927,  1192092018,
+     1205179286,  1218246759,  1231292471,  1244314457,  1257310754,  1270279407,
+     1283218462,  1296125971,  1308999989,  1321838579,  1334639806,  1347401742,
+     1360122467,  1372800063,  1385432623,  1398018243,  1410555028,  1423041090,
+     1435474550,  1447853533,  1460176177,  1472440625,  1484645031,  1496787556,
+     1508866372,  1520879659,  1532825610,  1544702424,  1556508313,  1568241500,
+     1579900216,  1591482707,  1602987228,  1614412047,  1625755442,  1637015707,
+     1648191144,  1659280072,  1670280819,  1681191730,  1692011162,  1702737484,
+     1713369082,  1723904354,  1734341714,  1744679591,  1754916426,  1765050679,
+     1775080824,  1785005349,  1794822761,  1804531581,  1814130346,  1823617612,
+     1832991949,  1842251946,  1851396208,  1860423358,  1869332037,  1878120903,
+     1886788632,  1895333919,  1903755478,  1912052040,  1920222355,  1928265194,
+     1936179344,  1943963614,  1951616833,  1959137846,  1966525522,  1973778748,
+     1980896432,  1987877502,  1994720906,  2001425614,  2007990617,  2014414925,
+     2020697571,  2026837609,  2032834114,  2038686184,  2044392936,  2049953512,
+     2055367075,  2060632808,  2065749918,  2070717636,  2075535214,  2080201924,
+     2084717066,  2089079958,  2093289945,  2097346391,  2101248686,  2104996242,
+     2108588495,  2112024904,  2115304951,  2118428143,  2121394009,  2124202102,
+     2126852000,  2129343303,  2131675637,  2133848650,  2135862014,  2137715427,
+     2139408610,  2140941307,  2142313288,  2143524345,  2144574298,  2145462987,
+     2146190279,  2146756064,  2147160257,  2147402797,  2147483647,  2147402797,
+     2147160257,  2146756064,  2146190279,  2145462987,  2144574298,  2143524345,
+     2142313288,  2140941307,  2139408610,  2137715427,  2135862014,  2133848650,
+     2131675637,  2129343303,  2126852000,  2124202102,  2121394009,  2118428143,
+     2115304951,  2112024904,  2108588495,  2104996242,  2101248686,  2097346391,
+     2093289945,  2089079958,  2084717066,  2080201924,  2075535214,  2070717636,
+     2065749918,  2060632808,  2055367075,  2049953512,  2044392936,  2038686184,
+     2032834114,  2026837609,  2020697571,  2014414925,  2007990617,  2001425614,
+     1994720906,  1987877502,  1980896432,  1973778748,  1966525522,  1959137846,
+     1951616833,  1943963614,  1936179344,  1928265194,  1920222355,  1912052040,
+     1903755478,  1895333919,  1886788632,  1878120903,  1869332037,  1860423358,
+     1851396208,  1842251946,  1832991949,  1823617612,  1814130346,  1804531581,
+     1794822761,  1785005349,  1775080824,  1765050679,  1754916426,  1744679591,
+     1734341714,  1723904354,  1713369082,  1702737484,  1692011162,  1681191730,
+     1670280819,  1659280072,  1648191144,  1637015707,  1625755442,  1614412047,
+     1602987228,  1591482707,  1579900216,  1568241500,  1556508313,  1544702424,
+     1532825610,  1520879659,  1508866372,  1496787556,  1484645031,  1472440625,
+     1460176177,  1447853533,  1435474550,  1423041090,  1410555028,  1398018243,
+     1385432623,  1372800063,  1360122467,  1347401742,  1334639806,  1321838579,
+     1308999989,  1296125971,  1283218462,  1270279407,  1257310754,  1244314457,
+     1231292471,  1218246759,  1205179286,  1192092018,  1178986927,  1165865987,
+     1152731173,  1139584463,  1126427838,  1113263279,  1100092767,  1086918288,
+     1073741824,  1060565360,  1047390881,  1034220369,  1021055810,  1007899185,
+      994752475,   981617661,   968496721,   955391630,   942304362,   929236889,
+      916191177,   903169191,   890172894,   877204241,   864265186,   851357677,
+      838483659,   825645069,   812843842,   800081906,   787361181,   774683585,
+      762051025,   749465405,   736928620,   724442558,   712009098,   699630115,
+      687307471,   675043023,   662838617,   650696092,   638617276,   626603989,
+      614658038,   602781224,   590975335,   579242148,   567583432,   556000941,
+      544496420,   533071601,   521728206,   510467941,   499292504,   488203576,
+      477202829,   466291918,   455472486,   444746164,   434114566,   423579294,
+      413141934,   402804057,   392567222,   382432969,   372402824,   362478299,
+      352660887,   342952067,   333353302,   323866036,   314491699,   305231702,
+      296087440,   287060290,   278151611,   269362745,   260695016,   252149729,
+      243728170,   235431608,   227261293,   219218454,   211304304,   203520034,
+      195866815,   188345802,   180958126,   173704900,   166587216,   159606146,
+      152762742,   146058034,   139493031,   133068723,   126786077,   120646039,
+      114649534,   108797464,   103090712,    97530136,    92116573,    86850840,
+       81733730,    76766012,    71948434,    67281724,    62766582,    58403690,
+       54193703,    50137257,    46234962,    42487406,    38895153,    35458744,
+       32178697,    29055505,    26089639,    23281546,    20631648,    18140345,
+       15808011,    13634998,    11621634,     9768221,     8075038,     6542341,
+        5170360,     3959303,     2909350,     2020661,     1293369,      727584,
+         323391,       80851
+};
+
+const float32_t DT_Hann_f32[512] =
+{
+                0.f, 3.76490789e-05f, 0.000150590655f, 0.000338807702f, 0.000602271874f, 0.000940943544f,
+     0.00135477167f,   0.0018436939f,  0.00240763673f,  0.00304651493f,  0.00376023259f,  0.00454868237f,
+     0.00541174505f,  0.00634929072f,  0.00736117875f,  0.00844725594f,  0.00960735977f,   0.0108413147f,
+      0.0121489353f,   0.0135300243f,    0.014984373f,   0.0165117644f,   0.0181119666f,   0.0197847411f,
+      0.0215298329f,   0.0233469792f,     0.02523591f,   0.0271963365f,   0.0292279683f,   0.0313304923f,
+      0.0335035995f,   0.0357469581f,    0.038060233f,    0.040443074f,   0.0428951234f,   0.0454160087f,
+      0.0480053537f,   0.0506627671f,   0.0533878505f,   0.0561801903f,   0.0590393692f,   0.0619649515f,
+      0.0649565011f,   0.0680135712f,   0.0711356923f,   0.0743224025f,   0.0775732175f,   0.0808876455f,
+      0.0842651948f,   0.0877053514f,   0.0912075937f,   0.0947714001f,   0.0983962342f,    0.102081545f,
+       0.105826788f,    0.109631389f,    0.113494776f,    0.117416367f,     0.12139558f,    0.125431806f,
+        0.12952444f,    0.133672863f,    0.137876466f,    0.142134592f,    0.146446615f,    0.150811881f,
+       0.155229732f,      0.1596995f,    0.164220527f,    0.168792114f,    0.173413575f,    0.178084224f,
+       0.182803363f,    0.187570259f,    0.192384198f,     0.19724448f,    0.202150345f,    0.207101077f,
+       0.212095901f,    0.217134088f,    0.222214878f,    0.227337509f,    0.232501194f,    0.237705156f,
+       0.242948622f,    0.248230815f,    0.253550917f,    0.258908123f,    0.264301628f,    0.269730657f,
+       0.275194347f,    0.280691892f,    0.286222458f,     0.29178521f,    0.297379345f,    0.303003967f,
+       0.308658272f,    0.314341396f,    0.320052475f,    0.325790673f,    0.331555068f,    0.337344855f,
+       0.343159139f,    0.348997027f,    0.354857653f,    0.360740155f,    0.366643608f,    0.372567177f,
+       0.378509909f,     0.38447094f,    0.390449375f,    0.396444321f,    0.402454853f,    0.408480048f,
+       0.414519042f,     0.42057094f,    0.426634759f,    0.432709634f,    0.438794672f,     0.44488889f,
+       0.450991422f,    0.457101345f,    0.463217705f,    0.469339639f,    0.475466162f,     0.48159638f,
+         0.4877294f,    0.493864238f,            0.5f,    0.506135762f,    0.512270629f,     0.51840359f,
+       0.524533808f,    0.530660391f,    0.536782265f,    0.542898655f,    0.549008548f,     0.55511111f,
+       0.561205328f,    0.567290366f,    0.573365211f,     0.57942909f,    0.585480928f,    0.591519952f,
+       0.597545147f,    0.603555679f,    0.609550595f,     0.61552906f,    0.621490061f,    0.627432823f,
+       0.633356392f,    0.639259815f,    0.645142317f,    0.651003003f,    0.656840861f,    0.662655175f,
+       0.668444932f,    0.674209356f,    0.679947495f,    0.685658574f,    0.691341698f,    0.696996033f,
+       0.702620685f,     0.70821476f,    0.713777542f,    0.719308138f,    0.724805653f,    0.730269372f,
+       0.735698342f,    0.741091907f,    0.746449113f,    0.751769185f,    0.757051349f,    0.762294829f,
+       0.767498791f,     0.77266252f,    0.777785122f,    0.782865882f,    0.787904084f,    0.792898953f,
+       0.797849655f,    0.802755535f,    0.807615817f,    0.812429726f,    0.817196667f,    0.821915746f,
+       0.826586425f,    0.831207871f,    0.835779488f,      0.8403005f,    0.844770253f,    0.849188149f,
+       0.853553414f,    0.857865393f,    0.862123549f,    0.866327107f,     0.87047559f,    0.874568224f,
+       0.878604412f,    0.882583618f,    0.886505246f,     0.89036864f,    0.894173205f,    0.897918463f,
+       0.901603758f,    0.905228615f,    0.908792436f,    0.912294626f,    0.915734828f,    0.919112325f,
+        0.92242676f,    0.925677598f,      0.9288643f,    0.931986451f,    0.935043514f,    0.938035071f,
+       0.940960646f,    0.943819821f,    0.946612179f,    0.949337244f,    0.951994658f,    0.954584002f,
+       0.957104862f,    0.959556937f,    0.961939752f,    0.964253068f,    0.966496408f,    0.968669534f,
+       0.970772028f,    0.972803652f,    0.974764109f,    0.976653039f,    0.978470147f,    0.980215251f,
+       0.981888056f,    0.983488262f,    0.985015631f,    0.986469984f,    0.987851083f,     0.98915869f,
+       0.990392625f,     0.99155277f,    0.992638826f,    0.993650734f,    0.994588256f,    0.995451331f,
+       0.996239781f,    0.996953487f,     0.99759239f,    0.998156309f,    0.998645246f,    0.999059081f,
+       0.999397755f,    0.999661207f,    0.999849439f,     0.99996233f,             1.f,     0.99996233f,
+       0.999849439f,    0.999661207f,    0.999397755f,    0.999059081f,    0.998645246f,    0.998156309f,
+        0.99759239f,    0.996953487f,    0.996239781f,    0.995451331f,    0.994588256f,    0.993650734f,
+       0.992638826f,     0.99155277f,    0.990392625f,     0.98915869f,    0.987851083f,    0.986469984f,
+       0.985015631f,    0.983488262f,    0.981888056f,    0.980215251f,    0.978470147f,    0.976653039f,
+       0.974764109f,    0.972803652f,    0.970772028f,    0.968669534f,    0.966496408f,    0.964253068f,
+       0.961939752f,    0.959556937f,    0.957104862f,    0.954584002f,    0.951994658f,    0.949337244f,
+       0.946612179f,    0.943819821f,    0.940960646f,    0.938035071f,    0.935043514f,    0.931986451f,
+         0.9288643f,    0.925677598f,     0.92242676f,    0.919112325f,    0.915734828f,    0.912294626f,
+       0.908792436f,    0.905228615f,    0.901603758f,    0.897918463f,    0.894173205f,     0.89036864f,
+       0.886505246f,    0.882583618f,    0.878604412f,    0.874568224f,     0.87047559f,    0.866327107f,
+       0.862123549f,    0.857865393f,    0.853553414f,    0.849188149f,    0.844770253f,      0.8403005f,
+       0.835779488f,    0.831207871f,    0.826586425f,    0.821915746f,    0.817196667f,    0.812429726f,
+       0.807615817f,    0.802755535f,    0.797849655f,    0.792898953f,    0.787904084f,    0.782865882f,
+       0.777785122f,     0.77266252f,    0.767498791f,    0.762294829f,    0.757051349f,    0.751769185f,
+       0.746449113f,    0.741091907f,    0.735698342f,    0.730269372f,    0.724805653f,    0.719308138f,
+       0.713777542f,     0.70821476f,    0.702620685f,    0.696996033f,    0.691341698f,    0.685658574f,
+       0.679947495f,    0.674209356f,    0.668444932f,    0.662655175f,    0.656840861f,    0.651003003f,
+       0.645142317f,    0.639259815f,    0.633356392f,    0.627432823f,    0.621490061f,     0.61552906f,
+       0.609550595f,    0.603555679f,    0.597545147f,    0.591519952f,    0.585480928f,     0.57942909f,
+       0.573365211f,    0.567290366f,    0.561205328f,     0.55511111f,    0.549008548f,    0.542898655f,
+       0.536782265f,    0.530660391f,    0.524533808f,     0.51840359f,    0.512270629f,    0.506135762f,
+               0.5f,    0.493864238f,      0.4877294f,     0.48159638f,    0.475466162f,    0.469339639f,
+       0.463217705f,    0.457101345f,    0.450991422f,     0.44488889f,    0.438794672f,    0.432709634f,
+       0.426634759f,     0.42057094f,    0.414519042f,    0.408480048f,    0.402454853f,    0.396444321f,
+       0.390449375f,     0.38447094f,    0.378509909f,    0.372567177f,    0.366643608f,    0.360740155f,
+       0.354857653f,    0.348997027f,    0.343159139f,    0.337344855f,    0.331555068f,    0.325790673f,
+       0.320052475f,    0.314341396f,    0.308658272f,    0.303003967f,    0.297379345f,     0.29178521f,
+       0.286222458f,    0.280691892f,    0.275194347f,    0.269730657f,    0.264301628f,    0.258908123f,
+       0.253550917f,    0.248230815f,    0.242948622f,    0.237705156f,    0.232501194f,    0.227337509f,
+       0.222214878f,    0.217134088f,    0.212095901f,    0.207101077f,    0.202150345f,     0.19724448f,
+       0.192384198f,    0.187570259f,    0.182803363f,    0.178084224f,    0.173413575f,    0.168792114f,
+       0.164220527f,      0.1596995f,    0.155229732f,    0.150811881f,    0.146446615f,    0.142134592f,
+       0.137876466f,    0.133672863f,     0.12952444f,    0.125431806f,     0.12139558f,    0.117416367f,
+       0.113494776f,    0.109631389f,    0.105826788f,    0.102081545f,   0.0983962342f,   0.0947714001f,
+      0.0912075937f,   0.0877053514f,   0.0842651948f,   0.0808876455f,   0.0775732175f,   0.0743224025f,
+      0.0711356923f,   0.0680135712f,   0.0649565011f,   0.0619649515f,   0.0590393692f,   0.0561801903f,
+      0.0533878505f,   0.0506627671f,   0.0480053537f,   0.0454160087f,   0.0428951234f,    0.040443074f,
+       0.038060233f,   0.0357469581f,   0.0335035995f,   0.0313304923f,   0.0292279683f,   0.0271963365f,
+        0.02523591f,   0.0233469792f,   0.0215298329f,   0.0197847411f,   0.0181119666f,   0.0165117644f,
+       0.014984373f,   0.0135300243f,   0.0121489353f,   0.0108413147f,  0.00960735977f,  0.00844725594f,
+     0.00736117875f,  0.00634929072f,  0.00541174505f,  0.00454868237f,  0.00376023259f,  0.00304651493f,
+     0.00240763673f,   0.0018436939f,  0.00135477167f, 0.000940943544f, 0.000602271874f, 0.000338807702f,
+    0.000150590655f, 3.76490789e-05f
+};
+
+/*Blackman窗，周期形式，512点*/
+const q15_t DT_Blackman_q15[512] =
+{
+         0,      0,      2,      4,      7,     11,     16,     22,     29,     36,     45,     54,
+        64,     76,     88,    101,    115,    130,    146,    163,    181,    200,    221,    242,
+       264,    287,    311,    336,    363,    390,    419,    448,    479,    511,    545,    579,
+       615,    651,    690,    729,    770,    811,    855,    899,    945,    993,   1041,   1091,
+      1143,   1196,   1250,   1306,   1364,   1423,   1483,   1545,   1609,   1674,   1741,   1810,
+      1880,   1952,   2025,   2100,   2177,   2256,   2336,   2419,   2503,   2589,   2676,   2766,
+      2857,   2951,   3046,   3143,   3242,   3343,   3445,   3550,   3657,   3766,   3876,   3989,
+      4104,   4220,   4339,   4460,   4583,   4708,   4835,   4963,   5094,   5228,   5363,   5500,
+      5639,   5780,   5924,   6069,   6217,   6366,   6518,   6671,   6827,   6985,   7144,   7306,
+      7470,   7635,   7803,   7973,   8144,   8318,   8493,   8671,   8850,   9031,   9214,   9399,
+      9586,   9774,   9964,  10156,  10350,  10545,  10742,  10941,  11141,  11343,  11546,  11751,
+     11958,  12166,  12375,  12585,  12797,  13011,  13225,  13441,  13658,  13876,  14095,  14316,
+     14537,  14759,  14983,  15207,  15432,  15657,  15884,  16111,  16339,  16567,  16796,  17026,
+     17256,  17486,  17717,  17948,  18179,  18410,  18642,  18873,  19105,  19336,  19567,  19799,
+     20030,  20260,  20491,  20720,  20950,  21179,  21407,  21635,  21862,  22088,  22313,  22538,
+     22762,  22984,  23206,  23426,  23645,  23863,  24079,  24295,  24508,  24721,  24931,  25140,
+     25348,  25553,  25757,  25959,  26159,  26357,  26553,  26747,  26939,  27129,  27316,  27501,
+     27683,  27863,  28041,  28216,  28389,  28558,  28725,  28890,  29051,  29210,  29366,  29519,
+     29668,  29815,  29959,  30099,  30237,  30371,  30501,  30629,  30753,  30874,  30991,  31105,
+     31215,  31322,  31425,  31525,  31621,  31713,  31802,  31886,  31967,  32045,  32118,  32188,
+     32254,  32316,  32374,  32428,  32478,  32524,  32566,  32604,  32639,  32669,  32695,  32717,
+     32736,  32750,  32760,  32766,  32767,  32766,  32760,  32750,  32736,  32717,  32695,  32669,
+     32639,  32604,  32566,  32524,  32478,  32428,  32374,  32316,  32254,  32188,  32118,  32045,
+     31967,  31886,  31802,  31713,  31621,  31525,  31425,  31322,  31215,  31105,  30991,  30874,
+     30753,  30629,  30501,  30371,  30237,  30099,  29959,  29815,  29668,  29519,  29366,  29210,
+     29051,  28890,  28725,  28558,  28389,  28216,  28041,  27863,  27683,  27501,  27316,  27129,
+     26939,  26747,  26553,  26357,  26159,  25959,  25757,  25553,  25348,  25140,  24931,  24721,
+     24508,  24295,  24079,  23863,  23645,  23426,  23206,  22984,  22762,  22538,  22313,  22088,
+     21862,  21635,  21407,  21179,  20950,  20720,  20491,  20260,  20030,  19799,  19567,  19336,
+     19105,  18873,  18642,  18410,  18179,  17948,  17717,  17486,  17256,  17026,  16796,  16567,
+     16339,  16111,  15884,  15657,  15432,  15207,  14983,  14759,  14537,  14316,  14095,  13876,
+     13658,  13441,  13225,  13011,  12797,  12585,  12375,  12166,  11958,  11751,  11546,  11343,
+     11141,  10941,  10742,  10545,  10350,  10156,   9964,   9774,   9586,   9399,   9214,   9031,
+      8850,   8671,   8493,   8318,   8144,   7973,   7803,   7635,   7470,   7306,   7144,   6985,
+      6827,   6671,   6518,   6366,   6217,   6069,   5924,   5780,   5639,   5500,   5363,   5228,
+      5094,   4963,   4835,   4708,   4583,   4460,   4339,   4220,   4104,   3989,   3876,   3766,
+      3657,   3550,   3445,   3343,   3242,   3143,   3046,   2951,   2857,   2766,   2676,   2589,
+      2503,   2419,   2336,   2256,   2177,   2100,   2025,   1952,   1880,   1810,   1741,   1674,
+      1609,   1545,   1483,   1423,   1364,   1306,   1250,   1196,   1143,   1091,   1041,    993,
+       945,    899,    855,    811,    770,    729,    690,    651,    615,    579,    545,    511,
+       479,    448,    419,    390,    363,    336,    311,    287,    264,    242,    221,    200,
+       181,    163,    146,    130,    115,    101,     88,     76,     64,     54,     45,     36,
+        29,     22,     16,     11,      7,      4,      2,      0
+};
+
+const q31_t DT_Blackman_q31[512] =
+{
+              0,       29108,      116452,      262088,      466111,      728655,
+        1049889,     1430021,     1869297,     2367999,     2926447,     3544996,
+        4224040,     4964006,     5765358,     6628595,     7554251,     8542894,
+        9595125,    10711580,    11892925,    13139859,    14453114,    15833452,
+       17281662,    18798567,    20385015,    22041883,    23770075,    25570521,
+       27444177,    29392021,    31415058,    33514312,    35690831,    37945684,
+       40279956,    42694755,    45191203,    47770441,    50433624,    53181923,
+       56016518,    58938606,    61949393,    65050093,    68241930,    71526136,
+       74903947,    78376607,    81945360,    85611454,    89376140,    93240665,
+       97206278,   101274223,   105445740,   109722066,   114104428,   118594047,
+      123192136,   127899894,   132718511,   137649161,   142693007,   147851193,
+      153124848,   158515080,   164022979,   169649613,   175396029,   181263248,
+      187252268,   193364059,   199599565,   205959699,   212445347,   219057360,
+      225796558,   232663729,   239659624,   246784957,   254040406,   261426611,
+      268944171,   276593645,   284375549,   292290358,   300338501,   308520363,
+      316836282,   325286550,   333871410,   342591057,   351445635,   360435237,
+      369559905,   378819630,   388214345,   397743934,   407408222,   417206981,
+      427139925,   437206712,   447406942,   457740156,   468205836,   478803407,
+      489532231,   500391611,   511380789,   522498945,   533745199,   545118607,
+      556618163,   568242800,   579991387,   591862729,   603855570,   615968589,
+      628200401,   640549559,   653014553,   665593807,   678285684,   691088482,
+      704000436,   717019719,   730144440,   743372647,   756702323,   770131391,
+      783657712,   797279086,   810993250,   824797885,   838690607,   852668976,
+      866730493,   880872600,   895092682,   909388065,   923756024,   938193773,
+      952698475,   967267239,   981897119,   996585120,  1011328194,  1026123244,
+     1040967122,  1055856634,  1070788539,  1085759550,  1100766333,  1115805514,
+     1130873673,  1145967352,  1161083051,  1176217232,  1191366319,  1206526700,
+     1221694730,  1236866728,  1252038982,  1267207750,  1282369260,  1297519714,
+     1312655285,  1327772124,  1342866357,  1357934090,  1372971408,  1387974377,
+     1402939047,  1417861452,  1432737614,  1447563542,  1462335234,  1477048679,
+     1491699862,  1506284759,  1520799345,  1535239592,  1549601472,  1563880959,
+     1578074028,  1592176664,  1606184853,  1620094593,  1633901892,  1647602769,
+     1661193257,  1674669405,  1688027278,  1701262962,  1714372561,  1727352205,
+     1740198044,  1752906256,  1765473048,  1777894654,  1790167340,  1802287405,
+     1814251180,  1826055035,  1837695377,  1849168651,  1860471343,  1871599984,
+     1882551146,  1893321448,  1903907557,  1914306187,  1924514104,  1934528124,
+     1944345118,  1953962011,  1963375784,  1972583475,  1981582181,  1990369061,
+     1998941333,  2007296279,  2015431247,  2023343646,  2031030956,  2038490722,
+     2045720559,  2052718151,  2059481256,  2066007700,  2072295385,  2078342287,
+     2084146456,  2089706019,  2095019179,  2100084218,  2104899495,  2109463450,
+     2113774603,  2117831554,  2121632984,  2125177657,  2128464420,  2131492203,
+     2134260018,  2136766965,  2139012224,  2140995064,  2142714837,  2144170981,
+     2145363021,  2146290568,  2146953318,  2147351055,  2147483647,  2147351055,
+     2146953318,  2146290568,  2145363021,  2144170981,  2142714837,  2140995064,
+     2139012224,  2136766965,  2134260018,  2131492203,  2128464420,  2125177657,
+     2121632984,  2117831554,  2113774603,  2109463450,  2104899495,  2100084218,
+     2095019179,  2089706019,  2084146456,  2078342287,  2072295385,  2066007700,
+     2059481256,  2052718151,  2045720559,  2038490722,  2031030956,  2023343646,
+     2015431247,  2007296279,  1998941333,  1990369061,  1981582181,  1972583475,
+     1963375784,  1953962011,  1944345118,  1934528124,  1924514104,  1914306187,
+     1903907557,  1893321448,  1882551146,  1871599984,  1860471343,  1849168651,
+     1837695377,  1826055035,  1814251180,  1802287405,  1790167340,  1777894654,
+     1765473048,  1752906256,  1740198044,  1727352205,  1714372561,  1701262962,
+     1688027278,  1674669405,  1661193257,  1647602769,  1633901892,  1620094593,
+     1606184853,  1592176664,  1578074028,  1563880959,  1549601472,  1535239592,
+     1520799345,  1506284759,  1491699862,  1477048679,  1462335234,  1447563542,
+     1432737614,  1417861452,  1402939047,  1387974377,  1372971408,  1357934090,
+     1342866357,  1327772124,  1312655285,  1297519714,  1282369260,  1267207750,
+     1252038982,  1236866728,  1221694730,  1206526700,  1191366319,  1176217232,
+     1161083051,  1145967352,  1130873673,  1115805514,  1100766333,  1085759550,
+     1070788539,  1055856634,  1040967122,  1026123244,  1011328194,   996585120,
+      981897119,   967267239,   952698475,   938193773,   923756024,   909388065,
+      895092682,   880872600,   866730493,   852668976,   838690607,   824797885,
+      810993250,   797279086,   783657712,   770131391,   756702323,   743372647,
+      730144440,   717019719,   704000436,   691088482,   678285684,   665593807,
+      653014553,   640549559,   628200401,   615968589,   603855570,   591862729,
+      579991387,   568242800,   556618163,   545118607,   533745199,   522498945,
+      511380789,   500391611,   489532231,   478803407,   468205836,   457740156,
+      447406942,   437206712,   427139925,   417206981,   407408222,   397743934,
+      388214345,   378819630,   369559905,   360435237,   351445635,   342591057,
+      333871410,   325286550,   316836282,   308520363,   300338501,   292290358,
+      284375549,   276593645,   268944171,   261426611,   254040406,   246784957,
+      239659624,   232663729,   225796558,   219057360,   212445347,   205959699,
+      199599565,   193364059,   187252268,   181263248,   175396029,   169649613,
+      164022979,   158515080,   153124848,   147851193,   142693007,   137649161,
+      132718511,   127899894,   123192136,   118594047,   114104428,   109722066,
+      105445740,   101274223,    97206278,    93240665,    89376140,    85611454,
+       81945360,    78376607,    74903947,    71526136,    68241930,    65050093,
+       61949393,    58938606,    56016518,    53181923,    50433624,    47770441,
+       45191203,    42694755,    40279956,    37945684,    35690831,    33514312,
+       31415058,    29392021,    27444177,    25570521,    23770075,    22041883,
+       20385015,    18798567,    17281662,    15833452,    14453114,    13139859,
+       11892925,    10711580,     9595125,     8542894,     7554251,     6628595,
+        5765358,     4964006,     4224040,     3544996,     2926447,     2367999,
+        1869297,     1430021,     1049889,      728655,      466111,      262088,
+         116452,       29108
+};
+
+const float32_t DT_Blackman_f32[512] =
+{
+    -1.38777878e-17f, 1.35545761e-05f, 5.42271482e-05f, 0.000122044243f, 0.000217050037f, 0.000339306309f,
+     0.00048889243f, 0.000665905303f, 0.000870459073f,  0.00110268535f,  0.00136273296f,  0.00165076752f,
+      0.0019669719f,  0.00231154542f,  0.00268470403f,  0.00308668008f,  0.00351772248f,  0.00397809502f,
+     0.00446807826f,  0.00498796813f,  0.00553807477f,  0.00611872366f,  0.00673025567f,  0.00737302564f,
+     0.00804740097f,  0.00875376444f,  0.00949251186f,   0.0102640511f,   0.0110688033f,   0.0119072022f,
+      0.0127796903f,   0.0136867268f,   0.0146287763f,   0.0156063177f,   0.0166198388f,   0.0176698361f,
+      0.0187568162f,    0.019881295f,   0.0210437942f,   0.0222448446f,   0.0234849863f,   0.0247647632f,
+      0.0260847248f,   0.0274454281f,   0.0288474336f,   0.0302913096f,    0.031777624f,   0.0333069526f,
+       0.034879867f,   0.0364969522f,   0.0381587818f,   0.0398659408f,   0.0416190103f,   0.0434185676f,
+      0.0452652015f,   0.0471594855f,   0.0491020009f,   0.0510933176f,    0.053134013f,   0.0552246571f,
+      0.0573658086f,   0.0595580302f,   0.0618018731f,   0.0640978888f,   0.0664466098f,   0.0688485801f,
+      0.0713043138f,   0.0738143325f,   0.0763791502f,   0.0789992586f,    0.081675142f,   0.0844072774f,
+       0.087196134f,    0.090042159f,   0.0929457918f,   0.0959074572f,   0.0989275724f,    0.102006532f,
+       0.105144717f,    0.108342491f,    0.111600205f,    0.114918202f,     0.11829678f,    0.121736251f,
+       0.125236884f,    0.128798947f,    0.132422686f,    0.136108309f,    0.139856011f,    0.143665984f,
+       0.147538394f,    0.151473358f,    0.155470997f,      0.1595314f,    0.163654625f,    0.167840734f,
+       0.172089741f,     0.17640163f,    0.180776387f,    0.185213953f,    0.189714238f,    0.194277138f,
+       0.198902532f,    0.203590244f,    0.208340093f,    0.213151872f,    0.218025327f,    0.222960204f,
+       0.227956206f,    0.233013004f,    0.238130242f,    0.243307531f,    0.248544469f,    0.253840625f,
+       0.259195536f,    0.264608681f,    0.270079523f,    0.275607556f,    0.281192154f,     0.28683272f,
+         0.2925286f,    0.298279136f,    0.304083586f,    0.309941262f,     0.31585139f,    0.321813166f,
+       0.327825755f,    0.333888322f,    0.340000004f,    0.346159875f,    0.352366984f,    0.358620375f,
+       0.364919066f,    0.371262014f,    0.377648175f,    0.384076446f,    0.390545756f,     0.39705494f,
+       0.403602839f,    0.410188258f,    0.416810006f,    0.423466831f,    0.430157423f,    0.436880529f,
+       0.443634808f,    0.450418919f,    0.457231462f,    0.464071125f,    0.470936388f,     0.47782588f,
+       0.484738082f,    0.491671562f,    0.498624772f,    0.505596161f,    0.512584269f,    0.519587457f,
+       0.526604116f,    0.533632636f,    0.540671408f,    0.547718823f,    0.554773152f,    0.561832786f,
+       0.568895936f,    0.575960934f,    0.583026111f,    0.590089619f,     0.59714973f,    0.604204714f,
+       0.611252725f,    0.618292093f,    0.625320852f,    0.632337332f,    0.639339626f,    0.646325946f,
+       0.653294384f,    0.660243213f,    0.667170465f,    0.674074292f,    0.680952907f,    0.687804401f,
+       0.694626868f,    0.701418519f,    0.708177388f,    0.714901626f,    0.721589446f,    0.728238821f,
+       0.734847963f,    0.741415024f,    0.747938097f,    0.754415333f,    0.760844886f,    0.767224848f,
+       0.773553371f,    0.779828727f,    0.786048949f,    0.792212307f,    0.798316956f,    0.804361045f,
+       0.810342848f,    0.816260576f,    0.822112441f,    0.827896714f,    0.833611608f,    0.839255452f,
+       0.844826519f,    0.850323141f,    0.855743587f,    0.861086249f,    0.866349459f,    0.871531665f,
+         0.8766312f,    0.881646514f,    0.886576056f,    0.891418278f,    0.896171689f,    0.900834858f,
+       0.905406237f,    0.909884453f,    0.914268076f,    0.918555737f,    0.922746122f,    0.926837802f,
+       0.930829585f,    0.934720159f,    0.938508332f,    0.942192793f,    0.945772469f,    0.949246228f,
+       0.952612877f,    0.955871403f,    0.959020674f,    0.962059796f,    0.964987755f,    0.967803538f,
+        0.97050631f,    0.973095179f,    0.975569308f,    0.977927923f,     0.98017019f,    0.982295454f,
+       0.984302998f,    0.986192167f,    0.987962365f,    0.989612937f,    0.991143465f,    0.992553413f,
+       0.993842244f,    0.995009661f,    0.996055186f,    0.996978521f,    0.997779369f,    0.998457432f,
+        0.99901253f,    0.999444425f,    0.999753058f,     0.99993825f,             1.f,     0.99993825f,
+       0.999753058f,    0.999444425f,     0.99901253f,    0.998457432f,    0.997779369f,    0.996978521f,
+       0.996055186f,    0.995009661f,    0.993842244f,    0.992553413f,    0.991143465f,    0.989612937f,
+       0.987962365f,    0.986192167f,    0.984302998f,    0.982295454f,     0.98017019f,    0.977927923f,
+       0.975569308f,    0.973095179f,     0.97050631f,    0.967803538f,    0.964987755f,    0.962059796f,
+       0.959020674f,    0.955871403f,    0.952612877f,    0.949246228f,    0.945772469f,    0.942192793f,
+       0.938508332f,    0.934720159f,    0.930829585f,    0.926837802f,    0.922746122f,    0.918555737f,
+       0.914268076f,    0.909884453f,    0.905406237f,    0.900834858f,    0.896171689f,    0.891418278f,
+       0.886576056f,    0.881646514f,      0.8766312f,    0.871531665f,    0.866349459f,    0.861086249f,
+       0.855743587f,    0.850323141f,    0.844826519f,    0.839255452f,    0.833611608f,    0.827896714f,
+       0.822112441f,    0.816260576f,    0.810342848f,    0.804361045f,    0.798316956f,    0.792212307f,
+       0.786048949f,    0.779828727f,    0.773553371f,    0.767224848f,    0.760844886f,    0.754415333f,
+       0.747938097f,    0.741415024f,    0.734847963f,    0.728238821f,    0.721589446f,    0.714901626f,
+       0.708177388f,    0.701418519f,    0.694626868f,    0.687804401f,    0.680952907f,    0.674074292f,
+       0.667170465f,    0.660243213f,    0.653294384f,    0.646325946f,    0.639339626f,    0.632337332f,
+       0.625320852f,    0.618292093f,    0.611252725f,    0.604204714f,     0.59714973f,    0.590089619f,
+       0.583026111f,    0.575960934f,    0.568895936f,    0.561832786f,    0.554773152f,    0.547718823f,
+       0.540671408f,    0.533632636f,    0.526604116f,    0.519587457f,    0.512584269f,    0.505596161f,
+       0.498624772f,    0.491671562f,    0.484738082f,     0.47782588f,    0.470936388f,    0.464071125f,
+       0.457231462f,    0.450418919f,    0.443634808f,    0.436880529f,    0.430157423f,    0.423466831f,
+       0.416810006f,    0.410188258f,    0.403602839f,     0.39705494f,    0.390545756f,    0.384076446f,
+       0.377648175f,    0.371262014f,    0.364919066f,    0.358620375f,    0.352366984f,    0.346159875f,
+       0.340000004f,    0.333888322f,    0.327825755f,    0.321813166f,     0.31585139f,    0.309941262f,
+       0.304083586f,    0.298279136f,      0.2925286f,     0.28683272f,    0.281192154f,    0.275607556f,
+       0.270079523f,    0.264608681f,    0.259195536f,    0.253840625f,    0.248544469f,    0.243307531f,
+       0.238130242f,    0.233013004f,    0.227956206f,    0.222960204f,    0.218025327f,    0.213151872f,
+       0.208340093f,    0.203590244f,    0.198902532f,    0.194277138f,    0.189714238f,    0.185213953f,
+       0.180776387f,     0.17640163f,    0.172089741f,    0.167840734f,    0.163654625f,      0.1595314f,
+       0.155470997f,    0.151473358f,    0.147538394f,    0.143665984f,    0.139856011f,    0.136108309f,
+       0.132422686f,    0.128798947f,    0.125236884f,    0.121736251f,     0.11829678f,    0.114918202f,
+       0.111600205f,    0.108342491f,    0.105144717f,    0.102006532f,   0.0989275724f,   0.0959074572f,
+      0.0929457918f,    0.090042159f,    0.087196134f,   0.0844072774f,    0.081675142f,   0.0789992586f,
+      0.0763791502f,   0.0738143325f,   0.0713043138f,   0.0688485801f,   0.0664466098f,   0.0640978888f,
+      0.0618018731f,   0.0595580302f,   0.0573658086f,   0.0552246571f,    0.053134013f,   0.0510933176f,
+      0.0491020009f,   0.0471594855f,   0.0452652015f,   0.0434185676f,   0.0416190103f,   0.0398659408f,
+      0.0381587818f,   0.0364969522f,    0.034879867f,   0.0333069526f,    0.031777624f,   0.0302913096f,
+      0.0288474336f,   0.0274454281f,   0.0260847248f,   0.0247647632f,   0.0234849863f,   0.0222448446f,
+      0.0210437942f,    0.019881295f,   0.0187568162f,   0.0176698361f,   0.0166198388f,   0.0156063177f,
+      0.0146287763f,   0.0136867268f,   0.0127796903f,   0.0119072022f,   0.0110688033f,   0.0102640511f,
+     0.00949251186f,  0.00875376444f,  0.00804740097f,  0.00737302564f,  0.00673025567f,  0.00611872366f,
+     0.00553807477f,  0.00498796813f,  0.00446807826f,  0.00397809502f,  0.00351772248f,  0.00308668008f,
+     0.00268470403f,  0.00231154542f,   0.0019669719f,  0.00165076752f,  0.00136273296f,  0.00110268535f,
+    0.000870459073f, 0.000665905303f,  0.00048889243f, 0.000339306309f, 0.000217050037f, 0.000122044243f,
+    5.42271482e-05f, 1.35545761e-05f
+};
+
+/*Mel滤波器组：40带，20-8000Hz，512点FFT，各带权重依次存放于DT_Mel_Weight*/
+const DT_MelBandTypeDef DT_Mel_Band[40] =
+{
+    {  1,  3,   0},
+    {  3,  3,   3},
+    {  4,  3,   6},
+    {  6,  3,   9},
+    {  7,  4,  12},
+    {  9,  4,  16},
+    { 11,  5,  20},
+    { 13,  5,  25},
+    { 16,  4,  30},
+    { 18,  5,  34},
+    { 20,  6,  39},
+    { 23,  6,  45},
+    { 26,  6,  51},
+    { 29,  6,  57},
+    { 32,  7,  63},
+    { 35,  8,  70},
+    { 39,  8,  78},
+    { 43,  8,  86},
+    { 47,  9,  94},
+    { 51, 10, 103},
+    { 56, 10, 113},
+    { 61, 10, 123},
+    { 66, 11, 133},
+    { 71, 12, 144},
+    { 77, 13, 156},
+    { 83, 14, 169},
+    { 90, 14, 183},
+    { 97, 15, 197},
+    {104, 17, 212},
+    {112, 18, 229},
+    {121, 18, 247},
+    {130, 19, 265},
+    {139, 21, 284},
+    {149, 22, 305},
+    {160, 24, 327},
+    {171, 25, 351},
+    {184, 26, 376},
+    {196, 29, 402},
+    {210, 30, 431},
+    {225, 32, 461}
+};
+
+const q15_t DT_Mel_Weight_q15[493] =
+{
+      8171,  30868,  13197,  19571,  25088,   4989,   7680,  27779,  18548,  14220,  32424,  14625,
+       344,  18143,  29782,  13032,   2986,  19736,  29270,  13509,   3498,  19259,  30648,  15816,
+       983,   2120,  16952,  31785,  19736,   5778,  13032,  26990,  25071,  11936,   7697,  20832,
+     31640,  19280,   6920,   1128,  13488,  25848,  27649,  16018,   4386,   5119,  16750,  28382,
+     25950,  15005,   4060,   6818,  17763,  28708,  26288,  15988,   5688,   6480,  16780,  27080,
+     28428,  18736,   9043,   4340,  14032,  23725,  32157,  23036,  13914,   4793,    611,   9732,
+     18854,  27975,  28695,  20112,  11529,   2946,   4073,  12656,  21239,  29822,  27463,  19386,
+     11309,   3231,   5305,  13382,  21459,  29537,  28208,  20607,  13006,   5405,   4560,  12161,
+     19762,  27363,  30702,  23549,  16397,   9244,   2091,   2066,   9219,  16371,  23524,  30677,
+     28005,  21274,  14543,   7812,   1082,   4763,  11494,  18225,  24956,  31686,  27452,  21118,
+     14784,   8450,   2116,   5316,  11650,  17984,  24318,  30652,  28798,  22838,  16877,  10917,
+      4956,   3970,   9930,  15891,  21851,  27812,  31823,  26214,  20605,  14996,   9387,   3778,
+       945,   6554,  12163,  17772,  23381,  28990,  31045,  25767,  20488,  15210,   9932,   4653,
+      1723,   7001,  12280,  17558,  22836,  28115,  32180,  27213,  22246,  17279,  12312,   7345,
+      2378,    588,   5555,  10522,  15489,  20456,  25423,  30390,  30331,  25657,  20983,  16309,
+     11634,   6960,   2286,   2437,   7111,  11785,  16459,  21134,  25808,  30482,  30521,  26122,
+     21724,  17325,  12927,   8528,   4129,   2247,   6646,  11044,  15443,  19841,  24240,  28639,
+     32515,  28376,  24236,  20097,  15958,  11819,   7680,   3541,    253,   4392,   8532,  12671,
+     16810,  20949,  25088,  29227,  32205,  28310,  24414,  20519,  16624,  12729,   8834,   4939,
+      1044,    563,   4458,   8354,  12249,  16144,  20039,  23934,  27829,  31724,  30085,  26419,
+     22754,  19088,  15423,  11758,   8092,   4427,    761,   2683,   6349,  10014,  13680,  17345,
+     21010,  24676,  28341,  32007,  30035,  26586,  23137,  19687,  16238,  12789,   9339,   5890,
+      2441,   2733,   6182,   9631,  13081,  16530,  19979,  23429,  26878,  30327,  31819,  28573,
+     25327,  22081,  18835,  15589,  12343,   9098,   5852,   2606,    949,   4195,   7441,  10687,
+     13933,  17179,  20425,  23670,  26916,  30162,  32166,  29111,  26057,  23002,  19948,  16893,
+     13839,  10784,   7730,   4675,   1621,    602,   3657,   6711,   9766,  12820,  15875,  18929,
+     21984,  25038,  28093,  31147,  31419,  28544,  25670,  22795,  19921,  17047,  14172,  11298,
+      8423,   5549,   2675,   1349,   4224,   7098,   9973,  12847,  15721,  18596,  21470,  24345,
+     27219,  30093,  32580,  29875,  27170,  24465,  21760,  19056,  16351,  13646,  10941,   8236,
+      5531,   2826,    121,    188,   2893,   5598,   8303,  11008,  13712,  16417,  19122,  21827,
+     24532,  27237,  29942,  32647,  30337,  27791,  25246,  22701,  20155,  17610,  15064,  12519,
+      9974,   7428,   4883,   2337,   2431,   4977,   7522,  10067,  12613,  15158,  17704,  20249,
+     22794,  25340,  27885,  30431,  32572,  30177,  27782,  25386,  22991,  20596,  18200,  15805,
+     13410,  11014,   8619,   6224,   3828,   1433,    196,   2591,   4986,   7382,   9777,  12172,
+     14568,  16963,  19358,  21754,  24149,  26544,  28940,  31335,  31863,  29609,  27354,  25100,
+     22846,  20592,  18338,  16084,  13830,  11576,   9322,   7068,   4814,   2560,    306,    905,
+      3159,   5414,   7668,   9922,  12176,  14430,  16684,  18938,  21192,  23446,  25700,  27954,
+     30208,  32462,  30934,  28813,  26692,  24571,  22450,  20329,  18208,  16086,  13965,  11844,
+      9723,   7602,   5481,   3359,   1238,   1834,   3955,   6076,   8197,  10318,  12439,  14560,
+     16682,  18803,  20924,  23045,  25166,  27287,  29409,  31530,  31937,  29941,  27945,  25949,
+     23953,  21957,  19961,  17965,  15969,  13973,  11976,   9980,   7984,   5988,   3992,   1996,
+         0
+};
+
+const float32_t DT_Mel_Weight_f32[493] =
+{
+       0.249357104f,    0.942015707f,    0.402750045f,    0.597249985f,    0.765621305f,     0.15224129f,
+       0.234378666f,     0.84775871f,    0.566052854f,    0.433947146f,    0.989499509f,     0.44632417f,
+      0.0105004907f,     0.55367583f,    0.908859789f,    0.397713453f,   0.0911402181f,    0.602286577f,
+        0.89325583f,    0.412249893f,    0.106744163f,    0.587750137f,    0.935298204f,    0.482655406f,
+      0.0300125591f,   0.0647017732f,    0.517344594f,    0.969987452f,     0.60229063f,    0.176338464f,
+        0.39770934f,    0.823661506f,    0.765105069f,    0.364269674f,    0.234894931f,    0.635730326f,
+       0.965590417f,    0.588390827f,    0.211191192f,   0.0344095565f,    0.411609173f,    0.788808823f,
+       0.843780458f,    0.488822877f,    0.133865312f,    0.156219542f,    0.511177123f,    0.866134703f,
+       0.791944742f,     0.45791766f,    0.123890586f,    0.208055288f,    0.542082369f,    0.876109421f,
+       0.802254498f,    0.487923741f,    0.173593014f,    0.197745517f,    0.512076259f,    0.826407015f,
+       0.867561042f,    0.571765184f,    0.275969386f,    0.132438958f,    0.428234786f,    0.724030614f,
+       0.981342614f,    0.702988744f,    0.424634904f,    0.146281034f,   0.0186573695f,    0.297011226f,
+       0.575365126f,    0.853718936f,    0.875715017f,    0.613774598f,    0.351834238f,   0.0898938626f,
+        0.12428499f,    0.386225373f,    0.648165762f,    0.910106122f,    0.838098407f,    0.591603696f,
+       0.345108926f,   0.0986141935f,    0.161901578f,    0.408396333f,    0.654891074f,    0.901385784f,
+       0.860839427f,    0.628879547f,    0.396919668f,    0.164959803f,    0.139160588f,    0.371120453f,
+       0.603080332f,    0.835040212f,    0.936950684f,     0.71866858f,    0.500386536f,    0.282104462f,
+      0.0638223961f,   0.0630493313f,     0.28133139f,    0.499613464f,    0.717895567f,    0.936177611f,
+       0.854648232f,    0.649237454f,    0.443826646f,    0.238415852f,    0.033005055f,    0.145351768f,
+       0.350762576f,    0.556173384f,    0.761584163f,    0.966994941f,    0.837760389f,     0.64446187f,
+       0.451163411f,    0.257864922f,   0.0645664185f,    0.162239626f,      0.3555381f,    0.548836589f,
+       0.742135108f,    0.935433567f,    0.878858745f,    0.696958363f,    0.515057981f,    0.333157569f,
+       0.151257157f,    0.121141225f,    0.303041637f,    0.484942049f,    0.666842461f,    0.848742843f,
+        0.97116369f,    0.799989223f,    0.628814816f,    0.457640409f,    0.286466002f,    0.115291573f,
+      0.0288363285f,    0.200010747f,    0.371185184f,    0.542359591f,    0.713533998f,    0.884708405f,
+       0.947412372f,    0.786331475f,    0.625250518f,    0.464169621f,    0.303088725f,    0.142007813f,
+       0.052587647f,    0.213668555f,    0.374749452f,    0.535830379f,    0.696911275f,    0.857992172f,
+       0.982051551f,    0.830469012f,    0.678886414f,    0.527303874f,    0.375721306f,    0.224138722f,
+      0.0725561604f,   0.0179484207f,    0.169530988f,    0.321113557f,    0.472696126f,    0.624278724f,
+       0.775861263f,    0.927443862f,     0.92563349f,    0.782989144f,    0.640344858f,    0.497700542f,
+       0.355056226f,    0.212411895f,   0.0697675869f,   0.0743665248f,    0.217010841f,    0.359655142f,
+       0.502299488f,    0.644943774f,     0.78758812f,    0.930232406f,    0.931420565f,    0.797187448f,
+        0.66295433f,    0.528721213f,    0.394488066f,    0.260254949f,    0.126021847f,   0.0685794577f,
+       0.202812582f,    0.337045699f,    0.471278816f,    0.605511904f,    0.739745021f,    0.873978138f,
+       0.992272913f,    0.865955055f,    0.739637136f,    0.613319218f,    0.487001359f,    0.360683471f,
+       0.234365568f,    0.108047672f,  0.00772707956f,    0.134044975f,    0.260362864f,    0.386680752f,
+       0.512998641f,    0.639316559f,    0.765634418f,    0.891952336f,      0.9828071f,    0.863937736f,
+       0.745068312f,    0.626198888f,    0.507329524f,      0.3884601f,    0.269590706f,    0.150721312f,
+      0.0318519063f,   0.0171928909f,    0.136062294f,    0.254931688f,    0.373801082f,    0.492670506f,
+         0.6115399f,    0.730409265f,    0.849278688f,    0.968148112f,    0.918113589f,    0.806253493f,
+       0.694393337f,     0.58253324f,    0.470673144f,    0.358813018f,    0.246952891f,     0.13509278f,
+      0.0232326593f,   0.0818863958f,    0.193746522f,    0.305606633f,     0.41746676f,    0.529326856f,
+       0.641187012f,    0.753047109f,    0.864907205f,    0.976767361f,    0.916598558f,    0.811334431f,
+       0.706070304f,    0.600806117f,     0.49554199f,    0.390277833f,    0.285013705f,    0.179749548f,
+      0.0744853988f,   0.0834014267f,    0.188665584f,    0.293929726f,    0.399193883f,     0.50445801f,
+       0.609722137f,    0.714986324f,    0.820250452f,    0.925514579f,    0.971036136f,    0.871979058f,
+        0.77292192f,    0.673864841f,    0.574807703f,    0.475750595f,    0.376693457f,    0.277636349f,
+       0.178579241f,   0.0795221254f,   0.0289638415f,    0.128020957f,    0.227078065f,    0.326135188f,
+       0.425192297f,    0.524249434f,    0.623306513f,    0.722363651f,    0.821420789f,    0.920477867f,
+       0.981616914f,    0.888400853f,    0.795184731f,     0.70196867f,    0.608752549f,    0.515536487f,
+       0.422320396f,    0.329104304f,    0.235888213f,    0.142672122f,   0.0494560301f,   0.0183830857f,
+       0.111599177f,    0.204815269f,     0.29803136f,    0.391247451f,    0.484463543f,    0.577679634f,
+       0.670895696f,    0.764111817f,    0.857327878f,       0.950544f,    0.958820283f,    0.871100843f,
+       0.783381343f,    0.695661843f,    0.607942343f,    0.520222902f,    0.432503402f,    0.344783902f,
+       0.257064432f,    0.169344932f,   0.0816254467f,   0.0411796942f,    0.128899172f,    0.216618657f,
+       0.304338157f,    0.392057627f,    0.479777128f,    0.567496598f,    0.655216098f,    0.742935598f,
+       0.830655038f,    0.918374538f,    0.994265318f,    0.911718309f,      0.8291713f,    0.746624291f,
+       0.664077342f,    0.581530333f,    0.498983324f,    0.416436315f,    0.333889335f,    0.251342326f,
+       0.168795332f,   0.0862483382f,  0.00370134437f,  0.00573469326f,   0.0882816911f,    0.170828685f,
+       0.253375679f,    0.335922688f,    0.418469667f,    0.501016676f,    0.583563685f,    0.666110694f,
+       0.748657644f,    0.831204653f,    0.913751662f,    0.996298671f,    0.925803602f,    0.848124087f,
+       0.770444572f,    0.692765057f,    0.615085542f,    0.537406027f,    0.459726512f,    0.382046998f,
+       0.304367512f,    0.226687983f,    0.149008483f,   0.0713289678f,   0.0741964206f,    0.151875928f,
+       0.229555443f,    0.307234943f,    0.384914458f,    0.462593973f,    0.540273488f,    0.617953002f,
+       0.695632517f,    0.773312032f,    0.850991547f,    0.928671062f,    0.994023919f,    0.920924902f,
+       0.847825825f,    0.774726808f,    0.701627731f,    0.628528714f,    0.555429697f,     0.48233065f,
+       0.409231603f,    0.336132556f,    0.263033509f,    0.189934477f,     0.11683543f,   0.0437363908f,
+     0.00597607577f,   0.0790751204f,     0.15217416f,    0.225273192f,    0.298372239f,    0.371471286f,
+       0.444570333f,     0.51766938f,    0.590768397f,    0.663867474f,    0.736966491f,    0.810065508f,
+       0.883164585f,    0.956263602f,    0.972368777f,     0.90358007f,    0.834791422f,    0.766002774f,
+       0.697214067f,    0.628425419f,    0.559636772f,    0.490848094f,    0.422059447f,    0.353270769f,
+       0.284482092f,    0.215693444f,    0.146904781f,   0.0781161115f,  0.00932744425f,   0.0276312456f,
+      0.0964199081f,    0.165208578f,    0.233997241f,    0.302785903f,    0.371574581f,    0.440363228f,
+       0.509151876f,    0.577940583f,    0.646729231f,    0.715517879f,    0.784306586f,    0.853095233f,
+       0.921883881f,    0.990672529f,    0.944045007f,    0.879312515f,    0.814580083f,    0.749847591f,
+       0.685115159f,    0.620382726f,    0.555650234f,    0.490917802f,     0.42618534f,    0.361452878f,
+       0.296720415f,    0.231987968f,    0.167255521f,    0.102523059f,   0.0377906077f,   0.0559550151f,
+        0.12068747f,    0.185419932f,    0.250152379f,    0.314884841f,    0.379617304f,    0.444349736f,
+       0.509082198f,     0.57381469f,    0.638547122f,    0.703279555f,    0.768012047f,    0.832744479f,
+       0.897476912f,    0.962209404f,    0.974646807f,    0.913731396f,    0.852815986f,    0.791900516f,
+       0.730985105f,    0.670069695f,    0.609154284f,    0.548238814f,    0.487323403f,    0.426407993f,
+       0.365492553f,    0.304577142f,    0.243661702f,    0.182746276f,    0.121830851f,   0.0609154254f,
+     3.5457445e-15f
+};
+
+/*隔直高通：20Hz二阶Butterworth*/
+const float32_t DT_Biquad_Hpf_f32[5] =
+{
+       0.994461775f,    -1.98892355f,    0.994461775f,     1.98889291f,   -0.988954246f
+};
+
+const q31_t DT_Biquad_Hpf_q31[5] =
+{
+     1067795215, -2135590430,  1067795215,  2135557497, -1061881540
+};
+
+/*A计权：3级，1kHz为0dB，31.5-7000Hz与IEC 61672偏差不超过0.15dB*/
+const float32_t DT_Biquad_A_Weight_f32[15] =
+{
+       0.932499349f,    0.132414907f,             0.f,             0.f,             0.f,
+                1.f,            -2.f,             1.f,     1.98388672f,   -0.983951688f,
+                1.f,            -2.f,             1.f,     1.70550966f,   -0.715987563f
+};
+
+const q31_t DT_Biquad_A_Weight_q31[15] =
+{
+      500631785,    71089714,           0,           0,           0,
+      536870912, -1073741824,   536870912,  1065091093,  -528255029,
+      536870912, -1073741824,   536870912,   915638512,  -384392903
+};
+
+/*半带低通，Kaiser窗(beta 5.65)，直流增益1，中心抽头0.5*/
+const q15_t DT_Halfband_q15[47] =
+{
+        -9,      0,     29,      0,    -64,      0,    120,      0,   -206,      0,    331,      0,
+      -511,      0,    772,      0,  -1169,      0,   1846,      0,  -3328,      0,  10381,  16384,
+     10381,      0,  -3328,      0,   1846,      0,  -1169,      0,    772,      0,   -511,      0,
+       331,      0,   -206,      0,    120,      0,    -64,      0,     29,      0,     -9
+};
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
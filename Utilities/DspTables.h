@@ -0,0 +1,68 @@
+/**
+ *  @file DspTables.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 常量表：电平、窗函数、Mel滤波器组、双二阶滤波器及半带FIR系数
+ *
+ *  @details 由Tools/gen_tables.py生成，勿手工修改；正弦表使用CMSIS-DSP的sinTable_q15等
+ *
+ *  @version v1.0
+ */
+#ifndef DSPTABLES_H_
+#define DSPTABLES_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+/** Private includes ---------------------------------------------------------*/
+#include "arm_math.h"
+/** Private defines ----------------------------------------------------------*/
+#define DT_SAMPLE_RATE              16000U   /**< 滤波器组及滤波器设计采样率*/
+#define DT_FFT_SIZE                 512U     /**< 窗长及Mel滤波器组FFT点数*/
+#define DT_MEL_BANDS                40U
+#define DT_MEL_WEIGHT_NUM           493U
+#define DT_DB_GAIN_MIN              120U     /**< 电平表下限-dB*/
+#define DT_BIQUAD_HPF_STAGES        1U
+#define DT_BIQUAD_HPF_POST_SHIFT    1U       /**< q31系数右移位数，用于arm_biquad_cascade_df1_init_q31*/
+#define DT_BIQUAD_A_WEIGHT_STAGES   3U
+#define DT_BIQUAD_A_WEIGHT_POST_SHIFT 2U
+#define DT_HALFBAND_TAPS            47U
+/** Exported typedefines -----------------------------------------------------*/
+/** Mel带，权重为DT_Mel_Weight[offset]起num个，对应FFT频点first起*/
+typedef struct
+{
+	uint16_t first;             /**< 起始频点*/
+	uint16_t num;               /**< 频点数*/
+	uint16_t offset;            /**< 权重偏移*/
+}DT_MelBandTypeDef;
+/** Exported constants -------------------------------------------------------*/
+extern const q31_t DT_Db_Gain_q31[DT_DB_GAIN_MIN + 1U];
+extern const q31_t DT_Db_Gain_Frac_q31[10];
+extern const q15_t DT_Hann_q15[DT_FFT_SIZE];
+extern const q31_t DT_Hann_q31[DT_FFT_SIZE];
+extern const float32_t DT_Hann_f32[DT_FFT_SIZE];
+extern const q15_t DT_Blackman_q15[DT_FFT_SIZE];
+extern const q31_t DT_Blackman_q31[DT_FFT_SIZE];
+extern const float32_t DT_Blackman_f32[DT_FFT_SIZE];
+extern const DT_MelBandTypeDef DT_Mel_Band[DT_MEL_BANDS];
+extern const q15_t DT_Mel_Weight_q15[DT_MEL_WEIGHT_NUM];
+extern const float32_t DT_Mel_Weight_f32[DT_MEL_WEIGHT_NUM];
+/*双二阶系数按CMSIS DF1顺序{b0, b1, b2, -a1, -a2}*/
+extern const float32_t DT_Biquad_Hpf_f32[5U * DT_BIQUAD_HPF_STAGES];
+extern const q31_t DT_Biquad_Hpf_q31[5U * DT_BIQUAD_HPF_STAGES];
+extern const float32_t DT_Biquad_A_Weight_f32[5U * DT_BIQUAD_A_WEIGHT_STAGES];
+extern const q31_t DT_Biquad_A_Weight_q31[5U * DT_BIQUAD_A_WEIGHT_STAGES];
+extern const q15_t DT_Halfband_q15[DT_HALFBAND_TAPS];
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,221 @@
+/**
+ *  @file ImaAdpcm.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief IMA-ADPCM 4:1编解码
+ *
+ *  @details None
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "ImaAdpcm.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+static const int16_t IMA_Step_Table[IMA_INDEX_MAX + 1U] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t IMA_Index_Table[16] =
+{
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [IMA_Update 由4位码更新状态，编解码共用以保证一致]
+ * @param  state [状态]
+ * @param  code  [4位码]
+ * @return       [还原点]
+ */
+static inline int16_t IMA_Update(IMA_StateTypeDef *state, uint8_t code)
+{
+    int32_t step = IMA_Step_Table[state->index];
+    int32_t diff = step >> 3;
+    int32_t value = state->predictor;
+    int32_t index = (int32_t)state->index + IMA_Index_Table[code];
+
+    if(code & 4U)
+    {
+        diff += step;
+    }
+    if(code & 2U)
+    {
+        diff += step >> 1;
+    }
+    if(code & 1U)
+    {
+        diff += step >> 2;
+    }
+    value += (code & 8U)?-diff:diff;
+    value = (value > INT16_MAX)?INT16_MAX:((value < INT16_MIN)?INT16_MIN:value);
+    index = (index < 0)?0:((index > (int32_t)IMA_INDEX_MAX)?(int32_t)IMA_INDEX_MAX:index);
+
+    state->predictor = (int16_t)value;
+    state->index = (uint8_t)index;
+    return state->predictor;
+}
+
+/**
+ * [IMA_Encode_Sample 编码单点]
+ * @param  state  [状态]
+ * @param  sample [输入点]
+ * @return        [4位码]
+ */
+static inline uint8_t IMA_Encode_Sample(IMA_StateTypeDef *state, int16_t sample)
+{
+    int32_t step = IMA_Step_Table[state->index];
+    int32_t diff = (int32_t)sample - state->predictor;
+    uint8_t code = 0;
+
+    if(diff < 0)
+    {
+        code = 8U;
+        diff = -diff;
+    }
+    /*逐位逼近差值*/
+    if(diff >= step)
+    {
+        code |= 4U;
+        diff -= step;
+    }
+    step >>= 1;
+    if(diff >= step)
+    {
+        code |= 2U;
+        diff -= step;
+    }
+    step >>= 1;
+    if(diff >= step)
+    {
+        code |= 1U;
+    }
+    (void)IMA_Update(state, code);
+    return code;
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [IMA_init 状态初始化]
+ * @param state [状态]
+ */
+void IMA_init(IMA_StateTypeDef *state)
+{
+    state->predictor = 0;
+    state->index = 0;
+}
+
+/**
+ * [IMA_encode 编码]
+ * @param state   [状态]
+ * @param pcm     [输入数据]
+ * @param stride  [输入点间隔]
+ * @param samples [点数]
+ * @param out     [输出，IMA_DATA_SIZE(samples)字节]
+ */
+void IMA_encode(IMA_StateTypeDef *state, const int16_t *pcm, uint32_t stride, uint32_t samples, uint8_t *out)
+{
+    uint8_t low = 0;
+
+    for(uint32_t i = 0; i + 1U < samples; i += 2U)
+    {
+        low = IMA_Encode_Sample(state, pcm[i * stride]);
+        *out++ = (uint8_t)(low | (IMA_Encode_Sample(state, pcm[(i + 1U) * stride]) << 4));
+    }
+    if(samples & 1U)
+    {
+        *out = IMA_Encode_Sample(state, pcm[(samples - 1U) * stride]);
+    }
+}
+
+/**
+ * [IMA_decode 解码]
+ * @param state   [状态]
+ * @param in      [编码数据]
+ * @param samples [点数]
+ * @param pcm     [输出数据]
+ * @param stride  [输出点间隔]
+ */
+void IMA_decode(IMA_StateTypeDef *state, const uint8_t *in, uint32_t samples, int16_t *pcm, uint32_t stride)
+{
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        pcm[i * stride] = IMA_Update(state, (i & 1U)?(uint8_t)(in[i >> 1] >> 4):(uint8_t)(in[i >> 1] & 0x0FU));
+    }
+}
+
+/**
+ * [IMA_writeBlockHeader 写入块头，编码该块前调用]
+ * @param state [状态]
+ * @param out   [输出，IMA_BLOCK_HEADER_SIZE字节]
+ */
+void IMA_writeBlockHeader(const IMA_StateTypeDef *state, uint8_t *out)
+{
+    out[0] = (uint8_t)((uint16_t)state->predictor);
+    out[1] = (uint8_t)((uint16_t)state->predictor >> 8);
+    out[2] = state->index;
+    out[3] = 0;
+}
+
+/**
+ * [IMA_decodeBlock 解码含块头的块]
+ * @param  in      [块数据]
+ * @param  samples [点数]
+ * @param  pcm     [输出数据]
+ * @param  stride  [输出点间隔]
+ * @return         [true成功]
+ */
+bool IMA_decodeBlock(const uint8_t *in, uint32_t samples, int16_t *pcm, uint32_t stride)
+{
+    IMA_StateTypeDef state;
+
+    if(in[2] > IMA_INDEX_MAX)
+    {
+        return false;
+    }
+    state.predictor = (int16_t)(uint16_t)(in[0] | ((uint16_t)in[1] << 8));
+    state.index = in[2];
+    IMA_decode(&state, in + IMA_BLOCK_HEADER_SIZE, samples, pcm, stride);
+    return true;
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
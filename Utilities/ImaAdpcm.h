@@ -0,0 +1,61 @@
+/**
+ *  @file ImaAdpcm.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief IMA-ADPCM 4:1编解码
+ *
+ *  @details 1、每点编码为4位，每字节先低4位后高4位，与WAV IMA-ADPCM一致
+ *           2、块格式：[预测值int16小端][步长索引][保留0][数据]，块头为编码该块前的状态，
+ *              各块可独立解码，丢块后下一块自动恢复
+ *
+ *  @version v1.0
+ */
+#ifndef IMAADPCM_H_
+#define IMAADPCM_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define IMA_BLOCK_HEADER_SIZE   4U
+#define IMA_INDEX_MAX           88U
+/** Exported typedefines -----------------------------------------------------*/
+/** 编解码状态*/
+typedef struct
+{
+	int16_t predictor;          /**< 上一点预测值*/
+	uint8_t index;              /**< 步长索引0-88*/
+}IMA_StateTypeDef;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*samples点编码后字节数*/
+#define IMA_DATA_SIZE(samples)  (((uint32_t)(samples) + 1U) / 2U)
+/*含块头的块字节数*/
+#define IMA_BLOCK_SIZE(samples) (IMA_BLOCK_HEADER_SIZE + IMA_DATA_SIZE(samples))
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*状态初始化*/
+void IMA_init(IMA_StateTypeDef *state);
+/*编码，stride为输入点间隔，samples为奇数时末字节高4位为0*/
+void IMA_encode(IMA_StateTypeDef *state, const int16_t *pcm, uint32_t stride, uint32_t samples, uint8_t *out);
+/*解码，stride为输出点间隔*/
+void IMA_decode(IMA_StateTypeDef *state, const uint8_t *in, uint32_t samples, int16_t *pcm, uint32_t stride);
+/*写入块头*/
+void IMA_writeBlockHeader(const IMA_StateTypeDef *state, uint8_t *out);
+/*解码含块头的块，块头无效返回false*/
+bool IMA_decodeBlock(const uint8_t *in, uint32_t samples, int16_t *pcm, uint32_t stride);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,295 @@
+/**
+ *  @file MessageQueue.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 变长消息队列接口
+ *
+ *  @details 存储格式：[varint长度][消息数据][varint长度][消息数据]...
+ *           消息整条发布，可读区内必为若干条完整消息；帧头无法解析或消息超出可读区
+ *           视为数据损坏，读取端逐字节丢弃直至重新对齐到有效帧头
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "MessageQueue.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [MQ_Header_Encode 编码varint长度帧头]
+ * @param  len    [消息长度]
+ * @param  header [帧头输出，至少MQ_HEADER_MAX字节]
+ * @return        [帧头字节数]
+ */
+static uint32_t MQ_Header_Encode(uint32_t len, uint8_t *header)
+{
+    uint32_t size = 0;
+
+    while(len >= 0x80U)
+    {
+        header[size++] = (uint8_t)(len | 0x80U);
+        len >>= 7;
+    }
+    header[size++] = (uint8_t)len;
+    return size;
+}
+
+/**
+ * [MQ_Span_Copy 由可读内存段指定偏移处拷贝数据，可跨越回绕处]
+ * @param span      [可读内存段]
+ * @param offset    [偏移]
+ * @param targetBuf [目标地址]
+ * @param len       [拷贝长度]
+ */
+static void MQ_Span_Copy(const CQ_SpanTypeDef *span, uint32_t offset, uint8_t *targetBuf, uint32_t len)
+{
+    uint32_t size = 0;
+
+    if(offset < span->first_len)
+    {
+        size = GET_MIN(len, span->first_len - offset);
+        memcpy(targetBuf, (const uint8_t *)span->first + offset, size);
+        offset = span->first_len;
+    }
+    memcpy(targetBuf + size, (const uint8_t *)span->second + (offset - span->first_len), len - size);
+}
+
+/**
+ * [MQ_Header_Decode 解析可读内存段指定偏移处的varint帧头并校验消息完整]
+ * @param  span   [可读内存段]
+ * @param  offset [帧头偏移]
+ * @param  avail  [可读总长度]
+ * @param  len    [消息长度输出]
+ * @return        [帧头字节数，帧头无效或消息不完整返回0]
+ */
+static uint32_t MQ_Header_Decode(const CQ_SpanTypeDef *span, uint32_t offset, uint32_t avail, uint32_t *len)
+{
+    uint32_t value = 0;
+    uint8_t data = 0;
+
+    for(uint32_t i = 0; i < MQ_HEADER_MAX && offset + i < avail; i++)
+    {
+        data = (offset + i < span->first_len)?((const uint8_t *)span->first)[offset + i]
+                                             :((const uint8_t *)span->second)[offset + i - span->first_len];
+        /*第5字节仅低4位有效*/
+        if(i == MQ_HEADER_MAX - 1U && data > 0x0FU)
+        {
+            return 0;
+        }
+        value |= (uint32_t)(data & 0x7FU) << (7U * i);
+        if((data & 0x80U) != 0U)
+        {
+            continue;
+        }
+        /*不存在空消息，消息整条发布不会只有部分可读*/
+        if(value == 0U || value > avail - offset - (i + 1U))
+        {
+            return 0;
+        }
+        *len = value;
+        return i + 1U;
+    }
+    return 0;
+}
+
+/**
+ * [MQ_Resync 由指定偏移处查找下一个有效帧头，跳过损坏的数据]
+ * @param  span   [可读内存段]
+ * @param  offset [起始偏移，返回有效帧头偏移，无有效帧头时为可读总长度]
+ * @param  avail  [可读总长度]
+ * @param  len    [消息长度输出]
+ * @return        [帧头字节数，无有效帧头返回0]
+ */
+static uint32_t MQ_Resync(const CQ_SpanTypeDef *span, uint32_t *offset, uint32_t avail, uint32_t *len)
+{
+    uint32_t header = 0;
+
+    for(; *offset < avail; (*offset)++)
+    {
+        header = MQ_Header_Decode(span, *offset, avail, len);
+        if(header > 0U)
+        {
+            return header;
+        }
+    }
+    return 0;
+}
+
+/**
+ * [MQ_Get_Msgs 依次取出消息，一次更新出口]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  targetBuf [目标区]
+ * @param  size      [目标区大小]
+ * @param  msgs      [消息描述输出]
+ * @param  max_msgs  [最多取出条数]
+ * @return           [取出的消息条数]
+ */
+static uint32_t MQ_Get_Msgs(CQ_handleTypeDef *cb, uint8_t *targetBuf, uint32_t size, MQ_MsgTypeDef *msgs, uint32_t max_msgs)
+{
+    CQ_SpanTypeDef Span;
+    uint32_t avail = CQ_peekRead(cb, CQ_getLength(cb), &Span);
+    uint32_t offset = 0;
+    uint32_t used = 0;
+    uint32_t count = 0;
+    uint32_t header = 0;
+    uint32_t len = 0;
+
+    while(count < max_msgs)
+    {
+        header = MQ_Resync(&Span, &offset, avail, &len);
+        /*无消息或目标区不足*/
+        if(header == 0U || len > size - used)
+        {
+            break;
+        }
+        MQ_Span_Copy(&Span, offset + header, targetBuf + used, len);
+        msgs[count].data = targetBuf + used;
+        msgs[count].len = len;
+        count++;
+        used += len;
+        offset += header + len;
+    }
+
+    if(offset > 0U)
+    {
+        CQ_consumeRead(cb, offset);
+    }
+    return count;
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [MQ_msgSpace 获取消息占用的缓冲区空间]
+ * @param  len [消息长度]
+ * @return     [帧头与消息总长度]
+ */
+uint32_t MQ_msgSpace(uint32_t len)
+{
+    uint8_t header[MQ_HEADER_MAX];
+    return MQ_Header_Encode(len, header) + len;
+}
+
+/**
+ * [MQ_putMsg 加入一条消息，帧头与数据整体发布]
+ * @param  cb  [环形缓冲区句柄]
+ * @param  msg [消息数据]
+ * @param  len [消息长度，不可为0]
+ * @return     [消息长度，空间不足或空消息返回0]
+ */
+uint32_t MQ_putMsg(CQ_handleTypeDef *cb, const uint8_t *msg, uint32_t len)
+{
+    CQ_SpanTypeDef Span;
+    uint8_t header[MQ_HEADER_MAX];
+    uint32_t header_len = MQ_Header_Encode(len, header);
+    uint32_t total = header_len + len;
+    uint32_t size = 0;
+
+    /*空消息不写入，取出返回0即表示无消息*/
+    if(len == 0U || total < len || CQ_reserveWrite(cb, total, &Span) < total)
+    {
+        return 0;
+    }
+
+    /*帧头可能跨越回绕处*/
+    size = GET_MIN(header_len, Span.first_len);
+    memcpy(Span.first, header, size);
+    memcpy(Span.second, header + size, header_len - size);
+
+    if(header_len < Span.first_len)
+    {
+        size = GET_MIN(len, Span.first_len - header_len);
+        memcpy((uint8_t *)Span.first + header_len, msg, size);
+        memcpy(Span.second, msg + size, len - size);
+    }
+    else
+    {
+        memcpy((uint8_t *)Span.second + (header_len - Span.first_len), msg, len);
+    }
+
+    CQ_commitWrite(cb, total);
+    return len;
+}
+
+/**
+ * [MQ_getMsg 取出一条消息]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  targetBuf [目标区]
+ * @param  size      [目标区大小，不足时不取出，可由MQ_peekMsgLen获取所需大小]
+ * @return           [消息长度，无消息或目标区不足返回0]
+ */
+uint32_t MQ_getMsg(CQ_handleTypeDef *cb, uint8_t *targetBuf, uint32_t size)
+{
+    MQ_MsgTypeDef Msg = {NULL, 0};
+    MQ_Get_Msgs(cb, targetBuf, size, &Msg, 1);
+    return Msg.len;
+}
+
+/**
+ * [MQ_getMsgBatch 批量取出消息，消息依次紧密存放于目标区]
+ * @param  cb        [环形缓冲区句柄]
+ * @param  targetBuf [目标区]
+ * @param  size      [目标区大小，放不下的消息留待下次取出]
+ * @param  msgs      [消息描述数组]
+ * @param  max_msgs  [数组大小]
+ * @return           [取出的消息条数]
+ */
+uint32_t MQ_getMsgBatch(CQ_handleTypeDef *cb, uint8_t *targetBuf, uint32_t size, MQ_MsgTypeDef *msgs, uint32_t max_msgs)
+{
+    return MQ_Get_Msgs(cb, targetBuf, size, msgs, max_msgs);
+}
+
+/**
+ * [MQ_peekMsgLen 获取下一条消息长度，消息本身不取出，其前的损坏数据会被丢弃]
+ * @param  cb [环形缓冲区句柄]
+ * @return    [消息长度，无消息返回-1]
+ */
+int32_t MQ_peekMsgLen(CQ_handleTypeDef *cb)
+{
+    CQ_SpanTypeDef Span;
+    uint32_t avail = CQ_peekRead(cb, CQ_getLength(cb), &Span);
+    uint32_t offset = 0;
+    uint32_t len = 0;
+    uint32_t header = MQ_Resync(&Span, &offset, avail, &len);
+
+    if(offset > 0U)
+    {
+        CQ_consumeRead(cb, offset);
+    }
+    if(header == 0U)
+    {
+        return -1;
+    }
+    return (int32_t)len;
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
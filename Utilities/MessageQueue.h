@@ -0,0 +1,60 @@
+/**
+ *  @file MessageQueue.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 基于环形缓冲区的变长消息队列
+ *
+ *  @details 1、每条消息以varint(LEB128)长度作为帧头，长度不受单字节限制
+ *           2、加入消息整条写入后才发布，空间不足时不写入任何数据
+ *           3、批量取出一次遍历多条消息，仅更新一次出口
+ *           4、单生产者单消费者，缓冲区需使用默认写入策略CQ_POLICY_DROP_NEWEST
+ *           5、不支持空消息；读取端遇到损坏的帧头时逐字节丢弃直至重新对齐
+ *
+ *  @version v1.0
+ */
+#ifndef MESSAGEQUEUE_H_
+#define MESSAGEQUEUE_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+#include "CircularQueue.h"
+/** Private defines ----------------------------------------------------------*/
+#define MQ_HEADER_MAX       5U  /**< 32位长度varint帧头最大字节数*/
+
+/** Exported typedefines -----------------------------------------------------*/
+/** 批量取出的消息描述*/
+typedef struct
+{
+	uint8_t *data;          /**< 消息在目标区内的起始地址*/
+	uint32_t len;           /**< 消息长度*/
+}MQ_MsgTypeDef;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*加入一条消息，空间不足时不写入，返回消息长度，失败或空消息返回0*/
+uint32_t MQ_putMsg(CQ_handleTypeDef *cb, const uint8_t *msg, uint32_t len);
+/*取出一条消息，目标区不足时不取出，返回消息长度，无消息返回0*/
+uint32_t MQ_getMsg(CQ_handleTypeDef *cb, uint8_t *targetBuf, uint32_t size);
+/*批量取出消息，依次存入目标区，返回取出的消息条数*/
+uint32_t MQ_getMsgBatch(CQ_handleTypeDef *cb, uint8_t *targetBuf, uint32_t size, MQ_MsgTypeDef *msgs, uint32_t max_msgs);
+/*获取下一条消息长度，不会取出，无消息返回-1*/
+int32_t MQ_peekMsgLen(CQ_handleTypeDef *cb);
+/*获取指定长度消息占用的缓冲区空间*/
+uint32_t MQ_msgSpace(uint32_t len);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
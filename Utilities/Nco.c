@@ -0,0 +1,194 @@
+/**
+ *  @file Nco.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 定点数控振荡器(NCO/DDS)
+ *
+ *  @details 每点一次查表、一次插值乘法及一次幅度乘法，无浮点运算；浮点仅用于设置参数
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "Nco.h"
+#include "DspTables.h"
+#include "arm_math.h"
+#include "arm_common_tables.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+#define NCO_INDEX_SHIFT         (32U - 9U)  /**< 高9位为表索引，512点*/
+#define NCO_FRACT_SHIFT         (NCO_INDEX_SHIFT - 16U)
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [NCO_Sine 由相位查表插值]
+ * @param  phase [相位]
+ * @return       [Q15正弦]
+ */
+static inline int32_t NCO_Sine(uint32_t phase)
+{
+    uint32_t index = phase >> NCO_INDEX_SHIFT;
+    int32_t fract = (int32_t)((phase >> NCO_FRACT_SHIFT) & 0xFFFFU);
+    int32_t a = sinTable_q15[index];
+    int32_t b = sinTable_q15[index + 1U];
+
+    return a + (((b - a) * fract + 0x8000) >> 16);
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [NCO_init 初始化]
+ * @param nco         [振荡器]
+ * @param sample_rate [采样率Hz]
+ */
+void NCO_init(NCO_StateTypeDef *nco, uint32_t sample_rate)
+{
+    nco->phase = 0;
+    nco->step = 0;
+    nco->gain = 0;
+    nco->sample_rate = sample_rate;
+}
+
+/**
+ * [NCO_setFrequency 设置频率，相位连续]
+ * @param  nco  [振荡器]
+ * @param  freq [频率Hz，0至采样率一半(不含)]
+ * @return      [true 成功]
+ */
+bool NCO_setFrequency(NCO_StateTypeDef *nco, float freq)
+{
+    if(!(freq >= 0.f) || freq >= (float)nco->sample_rate * 0.5f)
+    {
+        return false;
+    }
+    nco->step = NCO_freqToStep(freq, nco->sample_rate);
+    return true;
+}
+
+/**
+ * [NCO_getFrequency 获取当前频率]
+ * @param  nco [振荡器]
+ * @return     [频率Hz]
+ */
+float NCO_getFrequency(const NCO_StateTypeDef *nco)
+{
+    return (float)nco->step * (float)nco->sample_rate / 4294967296.f;
+}
+
+/**
+ * [NCO_setLevel 设置电平]
+ * @param nco  [振荡器]
+ * @param dbfs [电平dBFS]
+ */
+void NCO_setLevel(NCO_StateTypeDef *nco, float dbfs)
+{
+    nco->gain = NCO_dbfsToGain(dbfs);
+}
+
+/**
+ * [NCO_setPhase 设置瞬时相位]
+ * @param nco   [振荡器]
+ * @param phase [相位，2^32为一周，可由NCO_PHASE_DEGREE得出]
+ */
+void NCO_setPhase(NCO_StateTypeDef *nco, uint32_t phase)
+{
+    nco->phase = phase;
+}
+
+/**
+ * [NCO_sine 由相位得出正弦]
+ * @param  phase [相位，2^32为一周]
+ * @return       [Q15正弦]
+ */
+int32_t NCO_sine(uint32_t phase)
+{
+    return NCO_Sine(phase);
+}
+
+/**
+ * [NCO_dbfsToGain 电平转幅度，查表，分辨率0.1dB]
+ * @param  dbfs [电平dBFS，大于0按0处理]
+ * @return      [Q15幅度，低于NCO_LEVEL_MIN_DBFS为0]
+ */
+int32_t NCO_dbfsToGain(float dbfs)
+{
+    uint32_t tenth = 0;
+    int32_t gain = 0;
+
+    if(!(dbfs >= NCO_LEVEL_MIN_DBFS))
+    {
+        return 0;
+    }
+    dbfs = (dbfs > 0.f)?0.f:dbfs;
+    tenth = (uint32_t)(-dbfs * 10.f + 0.5f);
+    gain = (int32_t)(((int64_t)DT_Db_Gain_q31[tenth / 10U] * DT_Db_Gain_Frac_q31[tenth % 10U]) >> 31);
+    return (int32_t)(((int64_t)gain * 32767 + 0x40000000) >> 31);
+}
+
+/**
+ * [NCO_freqToStep 频率转相位增量]
+ * @param  freq        [频率Hz]
+ * @param  sample_rate [采样率Hz]
+ * @return             [相位增量，超出0至采样率一半时限幅]
+ */
+uint32_t NCO_freqToStep(float freq, uint32_t sample_rate)
+{
+    float ratio = freq / (float)sample_rate;
+
+    ratio = (ratio > 0.f)?ratio:0.f;
+    ratio = (ratio < 0.5f)?ratio:0.5f;
+    /*增量不超过2^31，单精度量化误差远小于频率分辨率要求*/
+    return (uint32_t)(ratio * 4294967296.f + 0.5f);
+}
+
+/**
+ * [NCO_render 生成一块数据]
+ * @param nco     [振荡器]
+ * @param out     [输出]
+ * @param stride  [输出点间隔]
+ * @param samples [点数]
+ */
+void NCO_render(NCO_StateTypeDef *nco, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t phase = nco->phase;
+    uint32_t step = nco->step;
+    int32_t gain = nco->gain;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        *out = (int16_t)((NCO_Sine(phase) * gain + 0x4000) >> 15);
+        out += stride;
+        phase += step;
+    }
+    nco->phase = phase;
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,68 @@
+/**
+ *  @file Nco.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 定点数控振荡器(NCO/DDS)
+ *
+ *  @details 1、32位相位累加器，2^32对应一周，频率分辨率为采样率/2^32
+ *           2、正弦由CMSIS-DSP sinTable_q15(512点整周期，位于flash)线性插值得出，高9位为表索引，其后16位为插值系数
+ *           3、改频仅修改相位增量，相位连续；各实例独立，可按通道各自运行
+ *
+ *  @version v1.0
+ */
+#ifndef NCO_H_
+#define NCO_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define NCO_LEVEL_MIN_DBFS      (-120.f)  /**< 低于此电平视为静音，与电平表下限DT_DB_GAIN_MIN一致*/
+/** Exported typedefines -----------------------------------------------------*/
+/** 振荡器状态*/
+typedef struct
+{
+	uint32_t phase;             /**< 相位累加器*/
+	uint32_t step;              /**< 每点相位增量*/
+	int32_t gain;               /**< Q15幅度，32767为满幅*/
+	uint32_t sample_rate;       /**< 采样率Hz*/
+}NCO_StateTypeDef;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*角度转相位，0至360(不含)*/
+#define NCO_PHASE_DEGREE(deg)   ((uint32_t)((float)(deg) / 360.f * 4294967296.f))
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*初始化，频率0相位0静音*/
+void NCO_init(NCO_StateTypeDef *nco, uint32_t sample_rate);
+/*设置频率Hz，相位连续，需小于采样率一半*/
+bool NCO_setFrequency(NCO_StateTypeDef *nco, float freq);
+/*获取当前频率Hz*/
+float NCO_getFrequency(const NCO_StateTypeDef *nco);
+/*设置电平dBFS，大于0按0处理，低于NCO_LEVEL_MIN_DBFS静音*/
+void NCO_setLevel(NCO_StateTypeDef *nco, float dbfs);
+/*设置瞬时相位*/
+void NCO_setPhase(NCO_StateTypeDef *nco, uint32_t phase);
+/*生成samples点，stride为输出点间隔*/
+void NCO_render(NCO_StateTypeDef *nco, int16_t *out, uint32_t stride, uint32_t samples);
+/*由相位得出Q15正弦*/
+int32_t NCO_sine(uint32_t phase);
+/*电平dBFS转Q15幅度*/
+int32_t NCO_dbfsToGain(float dbfs);
+/*频率Hz转相位增量，需小于采样率一半*/
+uint32_t NCO_freqToStep(float freq, uint32_t sample_rate);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,131 @@
+/**
+ *  @file PcmPack.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 24位PCM打包/解包
+ *
+ *  @details 每4点与3个字互换，单次遍历完成，不足4点的尾部逐字节处理
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <string.h>
+/* Private includes ----------------------------------------------------------*/
+#include "PcmPack.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [PCM_Store32 非对齐写入小端字，Cortex-M4上编译为单条STR]
+ * @param out   [输出]
+ * @param value [字]
+ */
+static inline void PCM_Store32(uint8_t *out, uint32_t value)
+{
+    memcpy(out, &value, sizeof(value));
+}
+
+/**
+ * [PCM_Load32 非对齐读取小端字]
+ * @param  in [输入]
+ * @return    [字]
+ */
+static inline uint32_t PCM_Load32(const uint8_t *in)
+{
+    uint32_t value;
+    memcpy(&value, in, sizeof(value));
+    return value;
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [PCM_pack24 24-in-32打包为3字节小端]
+ * @param in      [输入，左对齐int32]
+ * @param samples [点数]
+ * @param out     [输出，PCM_PACK24_SIZE(samples)字节]
+ */
+void PCM_pack24(const int32_t *in, uint32_t samples, uint8_t *out)
+{
+    uint32_t s0, s1, s2, s3;
+    uint32_t i = 0;
+
+    /*4点高24位拼接为3字：[s0 s1.0][s1.1 s1.2 s2.0 s2.1][s2.2 s3]*/
+    for(; i + 4U <= samples; i += 4U)
+    {
+        s0 = (uint32_t)in[i];
+        s1 = (uint32_t)in[i + 1U];
+        s2 = (uint32_t)in[i + 2U];
+        s3 = (uint32_t)in[i + 3U];
+        PCM_Store32(out, (s0 >> 8) | ((s1 & 0x0000FF00U) << 16));
+        PCM_Store32(out + 4, (s1 >> 16) | ((s2 << 8) & 0xFFFF0000U));
+        PCM_Store32(out + 8, (s2 >> 24) | (s3 & 0xFFFFFF00U));
+        out += 12;
+    }
+    for(; i < samples; i++)
+    {
+        s0 = (uint32_t)in[i];
+        *out++ = (uint8_t)(s0 >> 8);
+        *out++ = (uint8_t)(s0 >> 16);
+        *out++ = (uint8_t)(s0 >> 24);
+    }
+}
+
+/**
+ * [PCM_unpack24 3字节小端解包为24-in-32]
+ * @param in      [输入，PCM_PACK24_SIZE(samples)字节]
+ * @param samples [点数]
+ * @param out     [输出，左对齐int32，低8位为0]
+ */
+void PCM_unpack24(const uint8_t *in, uint32_t samples, int32_t *out)
+{
+    uint32_t w0, w1, w2;
+    uint32_t i = 0;
+
+    for(; i + 4U <= samples; i += 4U)
+    {
+        w0 = PCM_Load32(in);
+        w1 = PCM_Load32(in + 4);
+        w2 = PCM_Load32(in + 8);
+        out[i] = (int32_t)(w0 << 8);
+        out[i + 1U] = (int32_t)(((w0 >> 16) & 0x0000FF00U) | (w1 << 16));
+        out[i + 2U] = (int32_t)(((w1 >> 8) & 0x00FFFF00U) | (w2 << 24));
+        out[i + 3U] = (int32_t)(w2 & 0xFFFFFF00U);
+        in += 12;
+    }
+    for(; i < samples; i++)
+    {
+        out[i] = (int32_t)(((uint32_t)in[0] << 8) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 24));
+        in += 3;
+    }
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,45 @@
+/**
+ *  @file PcmPack.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 24位PCM打包/解包
+ *
+ *  @details 1、24-in-32为高24位有效、低8位忽略的左对齐int32，与I2S 24位数据帧及Q31一致
+ *           2、打包格式为每点3字节小端，与USB Audio bSubFrameSize=3一致
+ *
+ *  @version v1.0
+ */
+#ifndef PCMPACK_H_
+#define PCMPACK_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define PCM_PACK24_SAMPLE_SIZE  3U
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*samples点打包后字节数*/
+#define PCM_PACK24_SIZE(samples)  ((uint32_t)(samples) * PCM_PACK24_SAMPLE_SIZE)
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*24-in-32打包为3字节小端，输出地址无对齐要求*/
+void PCM_pack24(const int32_t *in, uint32_t samples, uint8_t *out);
+/*3字节小端解包为24-in-32，低8位为0，输入地址无对齐要求*/
+void PCM_unpack24(const uint8_t *in, uint32_t samples, int32_t *out);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
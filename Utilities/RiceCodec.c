@@ -0,0 +1,462 @@
+/**
+ *  @file RiceCodec.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 音频帧无损压缩：定阶线性预测+Rice编码
+ *
+ *  @details None
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+/* Private includes ----------------------------------------------------------*/
+#include "RiceCodec.h"
+/** Private typedef ----------------------------------------------------------*/
+/** 位写入器，高位先行*/
+typedef struct
+{
+	uint8_t *buf;
+	uint32_t cap;
+	uint32_t pos;               /**< 已写字节数，超出cap时继续计数*/
+	uint32_t acc;               /**< 未满8位的数据*/
+	uint32_t bits;              /**< acc内位数*/
+}RC_WriterTypeDef;
+
+/** 位读取器*/
+typedef struct
+{
+	const uint8_t *buf;
+	uint32_t len;
+	uint32_t pos;
+	uint32_t acc;
+	uint32_t bits;
+	bool error;                 /**< 读取越界*/
+}RC_ReaderTypeDef;
+/** Private macros -----------------------------------------------------------*/
+#define RC_PUT_BITS_MAX     24U /**< 单次写入最大位数*/
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [RC_Put 写入n位数据]
+ * @param w     [写入器]
+ * @param value [数据，高位须为0]
+ * @param n     [位数，不超过RC_PUT_BITS_MAX]
+ */
+static inline void RC_Put(RC_WriterTypeDef *w, uint32_t value, uint32_t n)
+{
+    w->acc = (w->acc << n) | value;
+    w->bits += n;
+    while(w->bits >= 8U)
+    {
+        w->bits -= 8U;
+        if(w->pos < w->cap)
+        {
+            w->buf[w->pos] = (uint8_t)(w->acc >> w->bits);
+        }
+        w->pos++;
+    }
+    w->acc &= (1UL << w->bits) - 1U;
+}
+
+/**
+ * [RC_Put_Rice Rice编码写入映射后的残差]
+ * @param w [写入器]
+ * @param u [映射后的残差]
+ * @param k [Rice参数]
+ */
+static inline void RC_Put_Rice(RC_WriterTypeDef *w, uint32_t u, uint32_t k)
+{
+    uint32_t q = u >> k;
+    uint32_t low = (1UL << k) | (u & ((1UL << k) - 1U));
+
+    if(q >= RC_ESCAPE_Q)
+    {
+        RC_Put(w, 0, RC_ESCAPE_Q);
+        RC_Put(w, u, RC_ESCAPE_BITS);
+        return;
+    }
+    /*商的0与结束位1、余数合并写入*/
+    if(q + k + 1U <= RC_PUT_BITS_MAX)
+    {
+        RC_Put(w, low, q + k + 1U);
+        return;
+    }
+    RC_Put(w, 0, q);
+    RC_Put(w, low, k + 1U);
+}
+
+/**
+ * [RC_Zigzag 有符号残差映射为非负数]
+ */
+static inline uint32_t RC_Zigzag(int32_t e)
+{
+    return ((uint32_t)e << 1) ^ (uint32_t)(e >> 31);
+}
+
+/**
+ * [RC_Residual 计算p阶定阶预测残差]
+ * @param x [当前点地址，之前至少p个点有效]
+ * @param p [阶数]
+ */
+static inline int32_t RC_Residual(const int16_t *x, uint32_t p)
+{
+    switch(p)
+    {
+        case 0:
+            return (int32_t)x[0];
+        case 1:
+            return (int32_t)x[0] - (int32_t)x[-1];
+        case 2:
+            return (int32_t)x[0] - 2 * (int32_t)x[-1] + (int32_t)x[-2];
+        default:
+            return (int32_t)x[0] - 3 * (int32_t)x[-1] + 3 * (int32_t)x[-2] - (int32_t)x[-3];
+    }
+}
+
+/**
+ * [RC_Analyse 估计各阶残差编码位数，选出最优阶数及Rice参数]
+ * @param x       [通道数据]
+ * @param samples [点数]
+ * @param order   [输出阶数]
+ * @param k       [输出Rice参数]
+ * @return        [估计位数，不含头部]
+ */
+static uint32_t RC_Analyse(const int16_t *x, uint32_t samples, uint32_t *order, uint32_t *k)
+{
+    uint32_t sum[RC_ORDER_MAX + 1U] = {0};
+    uint32_t best = UINT32_MAX;
+    uint32_t bits = 0;
+    int32_t e1_prev = 0;
+    int32_t e2_prev = 0;
+    int32_t e0, e1, e2, e3;
+
+    /*一次遍历得到0-3阶残差*/
+    for(uint32_t i = 1; i < samples; i++)
+    {
+        e0 = (int32_t)x[i];
+        e1 = e0 - (int32_t)x[i - 1U];
+        e2 = e1 - e1_prev;
+        e3 = e2 - e2_prev;
+        e1_prev = e1;
+        e2_prev = e2;
+        if(i > RC_ORDER_MAX)
+        {
+            sum[0] += RC_Zigzag(e0);
+            sum[1] += RC_Zigzag(e1);
+            sum[2] += RC_Zigzag(e2);
+            sum[3] += RC_Zigzag(e3);
+        }
+    }
+
+    for(uint32_t p = 0; p <= RC_ORDER_MAX && p < samples; p++)
+    {
+        for(uint32_t kk = 0; kk < RC_ESCAPE_BITS; kk++)
+        {
+            bits = (samples - p) * (kk + 1U) + (sum[p] >> kk) + 16U * p;
+            if(bits < best)
+            {
+                best = bits;
+                *order = p;
+                *k = kk;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * [RC_Encode_Channel 编码单通道，超过原始数据长度时改写原始数据]
+ * @param w       [写入器]
+ * @param x       [通道数据]
+ * @param samples [点数]
+ */
+static void RC_Encode_Channel(RC_WriterTypeDef *w, const int16_t *x, uint32_t samples)
+{
+    RC_WriterTypeDef Start = *w;
+    uint32_t order = 0;
+    uint32_t k = 0;
+    uint32_t verbatim_bits = 8U + 16U * samples;
+
+    if(RC_Analyse(x, samples, &order, &k) + 8U < verbatim_bits)
+    {
+        RC_Put(w, (order << 5) | k, 8);
+        for(uint32_t i = 0; i < order; i++)
+        {
+            RC_Put(w, (uint16_t)x[i], 16);
+        }
+        for(uint32_t i = order; i < samples; i++)
+        {
+            RC_Put_Rice(w, RC_Zigzag(RC_Residual(&x[i], order)), k);
+        }
+        if((w->pos - Start.pos) * 8U + w->bits - Start.bits < verbatim_bits)
+        {
+            return;
+        }
+        /*估计偏差导致实际更长，回退*/
+        *w = Start;
+    }
+
+    RC_Put(w, RC_ORDER_VERBATIM << 5, 8);
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        RC_Put(w, (uint16_t)x[i], 16);
+    }
+}
+
+/**
+ * [RC_Get 读取n位数据]
+ * @param r [读取器]
+ * @param n [位数，不超过RC_PUT_BITS_MAX]
+ */
+static inline uint32_t RC_Get(RC_ReaderTypeDef *r, uint32_t n)
+{
+    uint32_t value = 0;
+
+    while(r->bits < n)
+    {
+        if(r->pos < r->len)
+        {
+            r->acc = (r->acc << 8) | r->buf[r->pos++];
+        }
+        else
+        {
+            r->acc <<= 8;
+            r->error = true;
+        }
+        r->bits += 8U;
+    }
+    r->bits -= n;
+    value = (r->acc >> r->bits) & ((1UL << n) - 1U);
+    r->acc &= (1UL << r->bits) - 1U;
+    return value;
+}
+
+/**
+ * [RC_Decode_Channel 解码单通道]
+ * @param r       [读取器]
+ * @param x       [输出地址]
+ * @param stride  [输出间隔点数]
+ * @param samples [点数]
+ * @return        [true成功]
+ */
+static bool RC_Decode_Channel(RC_ReaderTypeDef *r, int16_t *x, uint32_t stride, uint32_t samples)
+{
+    uint32_t head = RC_Get(r, 8);
+    uint32_t order = head >> 5;
+    uint32_t k = head & 0x1FU;
+    uint32_t q = 0;
+    uint32_t u = 0;
+    int32_t e = 0;
+    int32_t value = 0;
+
+    if(order == RC_ORDER_VERBATIM)
+    {
+        for(uint32_t i = 0; i < samples; i++)
+        {
+            x[i * stride] = (int16_t)RC_Get(r, 16);
+        }
+        return (r->error == false);
+    }
+    if(order > RC_ORDER_MAX || order > samples || k >= RC_ESCAPE_BITS)
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0; i < order; i++)
+    {
+        x[i * stride] = (int16_t)RC_Get(r, 16);
+    }
+    for(uint32_t i = order; i < samples && r->error == false; i++)
+    {
+        q = 0;
+        while(q < RC_ESCAPE_Q && RC_Get(r, 1) == 0U && r->error == false)
+        {
+            q++;
+        }
+        u = (q == RC_ESCAPE_Q)?RC_Get(r, RC_ESCAPE_BITS):((q << k) | RC_Get(r, k));
+        e = (int32_t)(u >> 1) ^ -(int32_t)(u & 1U);
+
+        /*按预测公式还原*/
+        switch(order)
+        {
+            case 0:
+                value = e;
+                break;
+            case 1:
+                value = e + x[(i - 1U) * stride];
+                break;
+            case 2:
+                value = e + 2 * x[(i - 1U) * stride] - x[(i - 2U) * stride];
+                break;
+            default:
+                value = e + 3 * x[(i - 1U) * stride] - 3 * x[(i - 2U) * stride] + x[(i - 3U) * stride];
+                break;
+        }
+        if(value < INT16_MIN || value > INT16_MAX)
+        {
+            return false;
+        }
+        x[i * stride] = (int16_t)value;
+    }
+    return (r->error == false);
+}
+
+/**
+ * [RC_Finish 补齐字节及4字节]
+ * @param  w [写入器]
+ * @return   [编码字节数，空间不足返回0]
+ */
+static uint32_t RC_Finish(RC_WriterTypeDef *w)
+{
+    if(w->bits > 0U)
+    {
+        RC_Put(w, 0, 8U - w->bits);
+    }
+    while((w->pos & 3U) != 0U)
+    {
+        RC_Put(w, 0, 8);
+    }
+    return (w->pos <= w->cap)?w->pos:0U;
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [RC_encodeFrame 编码一帧]
+ * @param  channels [各通道数据地址，每通道samples点]
+ * @param  ch_num   [通道数]
+ * @param  samples  [每通道点数]
+ * @param  out      [输出区]
+ * @param  cap      [输出区字节数，不小于RC_FRAME_SIZE_MAX时必定成功]
+ * @return          [编码字节数，4的整数倍，空间不足返回0]
+ */
+uint32_t RC_encodeFrame(const int16_t * const *channels, uint32_t ch_num, uint32_t samples, uint8_t *out, uint32_t cap)
+{
+    RC_WriterTypeDef w = {out, cap, 0, 0, 0};
+
+    if(channels == NULL || out == NULL || ch_num == 0U || ch_num > RC_CHANNEL_MAX || samples == 0U)
+    {
+        return 0;
+    }
+
+    for(uint32_t ch = 0; ch < ch_num; ch++)
+    {
+        RC_Encode_Channel(&w, channels[ch], samples);
+    }
+    return RC_Finish(&w);
+}
+
+/**
+ * [RC_encodeChannels 编码各通道点数不同的一帧]
+ * @param  channels [各通道数据地址]
+ * @param  samples  [各通道点数]
+ * @param  ch_num   [通道数]
+ * @param  out      [输出区]
+ * @param  cap      [输出区字节数，不小于RC_FRAME_SIZE_MAX(ch_num, 最大点数)时必定成功]
+ * @return          [编码字节数，4的整数倍，空间不足返回0]
+ */
+uint32_t RC_encodeChannels(const int16_t * const *channels, const uint16_t *samples, uint32_t ch_num, uint8_t *out, uint32_t cap)
+{
+    RC_WriterTypeDef w = {out, cap, 0, 0, 0};
+
+    if(channels == NULL || samples == NULL || out == NULL || ch_num == 0U || ch_num > RC_CHANNEL_MAX)
+    {
+        return 0;
+    }
+
+    for(uint32_t ch = 0; ch < ch_num; ch++)
+    {
+        if(samples[ch] == 0U)
+        {
+            return 0;
+        }
+        RC_Encode_Channel(&w, channels[ch], samples[ch]);
+    }
+    return RC_Finish(&w);
+}
+
+/**
+ * [RC_decodeFrame 解码一帧]
+ * @param  in      [编码数据]
+ * @param  len     [编码字节数]
+ * @param  ch_num  [通道数]
+ * @param  samples [每通道点数]
+ * @param  out     [输出交织数据，ch_num*samples点]
+ * @return         [true成功]
+ */
+bool RC_decodeFrame(const uint8_t *in, uint32_t len, uint32_t ch_num, uint32_t samples, int16_t *out)
+{
+    RC_ReaderTypeDef r = {in, len, 0, 0, 0, false};
+
+    if(in == NULL || out == NULL || ch_num == 0U || ch_num > RC_CHANNEL_MAX)
+    {
+        return false;
+    }
+
+    for(uint32_t ch = 0; ch < ch_num; ch++)
+    {
+        if(RC_Decode_Channel(&r, out + ch, ch_num, samples) == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * [RC_decodeChannels 解码各通道点数不同的一帧]
+ * @param  in      [编码数据]
+ * @param  len     [编码字节数]
+ * @param  samples [各通道点数]
+ * @param  ch_num  [通道数]
+ * @param  out     [输出，各通道数据依次存放]
+ * @return         [true成功]
+ */
+bool RC_decodeChannels(const uint8_t *in, uint32_t len, const uint16_t *samples, uint32_t ch_num, int16_t *out)
+{
+    RC_ReaderTypeDef r = {in, len, 0, 0, 0, false};
+
+    if(in == NULL || samples == NULL || out == NULL || ch_num == 0U || ch_num > RC_CHANNEL_MAX)
+    {
+        return false;
+    }
+
+    for(uint32_t ch = 0; ch < ch_num; ch++)
+    {
+        if(RC_Decode_Channel(&r, out, 1, samples[ch]) == false)
+        {
+            return false;
+        }
+        out += samples[ch];
+    }
+    return true;
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
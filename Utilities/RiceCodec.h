@@ -0,0 +1,56 @@
+/**
+ *  @file RiceCodec.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 音频帧无损压缩：定阶线性预测+Rice编码
+ *
+ *  @details 1、每通道独立编码，头部8位：高3位预测阶数(0-3，7为原始数据)，低5位Rice参数k
+ *           2、预测阶数p时先写p个16位起始点，其余点写预测残差，残差映射为非负数后Rice编码
+ *           3、商不小于RC_ESCAPE_Q时写RC_ESCAPE_Q个0后直接写RC_ESCAPE_BITS位映射值
+ *           4、编码结果超过原始数据时该通道改写原始数据，故帧长不超过RC_FRAME_SIZE_MAX
+ *           5、全部定点运算，位流高位先行，帧尾补0至4字节整数倍
+ *
+ *  @version v1.0
+ */
+#ifndef RICECODEC_H_
+#define RICECODEC_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+#define RC_ORDER_MAX            3U      /**< 最高预测阶数*/
+#define RC_ORDER_VERBATIM       7U      /**< 原始数据*/
+#define RC_ESCAPE_Q             20U     /**< 商达到该值时转义*/
+#define RC_ESCAPE_BITS          20U     /**< 3阶残差映射后最大20位*/
+#define RC_CHANNEL_MAX          8U
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/*一帧编码后最大字节数：每通道1字节头部加原始数据，补齐4字节*/
+#define RC_FRAME_SIZE_MAX(ch, samples)  ((((uint32_t)(ch) * ((uint32_t)(samples) * 2U + 1U)) + 3U) & ~3U)
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*编码一帧，channels为各通道数据地址，返回编码字节数(4的整数倍)，空间不足返回0*/
+uint32_t RC_encodeFrame(const int16_t * const *channels, uint32_t ch_num, uint32_t samples, uint8_t *out, uint32_t cap);
+/*解码一帧，输出交织数据，位流错误返回false*/
+bool RC_decodeFrame(const uint8_t *in, uint32_t len, uint32_t ch_num, uint32_t samples, int16_t *out);
+/*编码各通道点数不同的一帧，用于分通道抽取，返回编码字节数(4的整数倍)，空间不足返回0*/
+uint32_t RC_encodeChannels(const int16_t * const *channels, const uint16_t *samples, uint32_t ch_num, uint8_t *out, uint32_t cap);
+/*解码各通道点数不同的一帧，各通道数据依次输出，位流错误返回false*/
+bool RC_decodeChannels(const uint8_t *in, uint32_t len, const uint16_t *samples, uint32_t ch_num, int16_t *out);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,540 @@
+/**
+ *  @file SignalGen.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 按块生成的测试信号
+ *
+ *  @details 正弦查表及插值由Nco提供；扫频每点更新相位增量，线性为加法，对数为Q30乘法
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+/* Private includes ----------------------------------------------------------*/
+#include "SignalGen.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+#define SG_Q30_ONE              1073741824.f
+/** Private constants --------------------------------------------------------*/
+/*Galois LFSR最大长度反馈掩码，下标为阶数*/
+static const uint32_t SG_Mls_Taps[SG_MLS_ORDER_MAX + 1U] =
+{
+    0, 0, 0x3U, 0x6U, 0xCU, 0x14U, 0x30U, 0x60U, 0xB8U, 0x110U, 0x240U,
+    0x500U, 0xE08U, 0x1C80U, 0x3802U, 0x6000U, 0xD008U, 0x12000U, 0x20400U, 0x72000U, 0x90000U
+};
+
+/*DTMF行频及列频*/
+static const float SG_Dtmf_Freq[8] = {697.f, 770.f, 852.f, 941.f, 1209.f, 1336.f, 1477.f, 1633.f};
+/*按键布局，行列位置对应行频及列频*/
+static const char SG_Dtmf_Keys[] = "123A456B789C*0#D";
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/**
+ * [SG_Saturate 饱和至int16]
+ * @param  value [输入]
+ * @return       [输出]
+ */
+static inline int16_t SG_Saturate(int32_t value)
+{
+    value = (value > INT16_MAX)?INT16_MAX:value;
+    value = (value < INT16_MIN)?INT16_MIN:value;
+    return (int16_t)value;
+}
+
+/**
+ * [SG_Dtmf_Key 查找按键位置]
+ * @param  key [按键字符]
+ * @return     [位置0-15，无效返回-1]
+ */
+static int32_t SG_Dtmf_Key(char key)
+{
+    const char *pos = (key != '\0')?strchr(SG_Dtmf_Keys, key):NULL;
+
+    return (pos != NULL)?(int32_t)(pos - SG_Dtmf_Keys):-1;
+}
+
+/**
+ * [SG_Render_White 白噪声，每个随机数生成两点]
+ */
+static void SG_Render_White(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t value = 0;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        value = ((i & 1U) == 0U)?sg->rand():(value >> 16);
+        *out = (int16_t)(((int32_t)(int16_t)value * sg->gain) >> 15);
+        out += stride;
+    }
+}
+
+/**
+ * [SG_Render_Pink 粉红噪声，每点更新计数末尾0个数对应的一行并叠加白噪声，每点一个随机数]
+ */
+static void SG_Render_Pink(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t value = 0;
+    uint32_t counter = sg->u.pink.counter;
+    uint32_t row = 0;
+    int32_t sum = sg->u.pink.sum;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        value = sg->rand();
+        counter++;
+        for(row = 0; row < SG_PINK_ROWS && ((counter >> row) & 1U) == 0U; row++)
+        {
+        }
+        if(row < SG_PINK_ROWS)
+        {
+            sum -= sg->u.pink.row[row];
+            sg->u.pink.row[row] = (int32_t)(int16_t)value >> 4;
+            sum += sg->u.pink.row[row];
+        }
+        /*各行及白噪声均为±2^11，16项之和不超过满幅*/
+        *out = SG_Saturate(((sum + ((int32_t)(int16_t)(value >> 16) >> 4)) * sg->gain) >> 15);
+        out += stride;
+    }
+    sg->u.pink.counter = counter;
+    sg->u.pink.sum = sum;
+}
+
+/**
+ * [SG_Render_Chirp 扫频]
+ */
+static void SG_Render_Chirp(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t phase = sg->u.chirp.phase;
+    uint32_t step = sg->u.chirp.step;
+    uint32_t count = sg->u.chirp.count;
+    bool log = (sg->type == SG_TYPE_CHIRP_LOG);
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        *out = (int16_t)((NCO_sine(phase) * sg->gain + 0x4000) >> 15);
+        out += stride;
+        phase += step;
+        if(++count >= sg->u.chirp.length)
+        {
+            count = 0;
+            step = sg->u.chirp.step_start;
+        }
+        else if(log == true)
+        {
+            step = (uint32_t)(((uint64_t)step * sg->u.chirp.ratio + (1U << 29)) >> 30);
+        }
+        else
+        {
+            step = (uint32_t)((int32_t)step + sg->u.chirp.delta);
+        }
+    }
+    sg->u.chirp.phase = phase;
+    sg->u.chirp.step = step;
+    sg->u.chirp.count = count;
+}
+
+/**
+ * [SG_Render_Mls MLS，输出位为1时正幅度]
+ */
+static void SG_Render_Mls(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t state = sg->u.mls.state;
+    uint32_t lsb = 0;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        lsb = state & 1U;
+        state >>= 1;
+        if(lsb != 0U)
+        {
+            state ^= sg->u.mls.taps;
+        }
+        *out = (int16_t)((lsb != 0U)?sg->gain:-sg->gain);
+        out += stride;
+    }
+    sg->u.mls.state = state;
+}
+
+/**
+ * [SG_Render_Multitone 多音叠加]
+ */
+static void SG_Render_Multitone(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t num = sg->u.multitone.num;
+    int32_t sum = 0;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        sum = 0;
+        for(uint32_t k = 0; k < num; k++)
+        {
+            sum += NCO_sine(sg->u.multitone.phase[k]);
+            sg->u.multitone.phase[k] += sg->u.multitone.step[k];
+        }
+        *out = SG_Saturate((int32_t)(((int64_t)sum * sg->gain + 0x4000) >> 15));
+        out += stride;
+    }
+}
+
+/**
+ * [SG_Render_Dtmf DTMF，每个号码起始相位清零]
+ */
+static void SG_Render_Dtmf(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    int32_t key = SG_Dtmf_Key(sg->u.dtmf.digits[sg->u.dtmf.index]);
+    uint32_t row_step = sg->u.dtmf.step[(uint32_t)key / 4U];
+    uint32_t col_step = sg->u.dtmf.step[4U + (uint32_t)key % 4U];
+    int32_t sum = 0;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        sum = 0;
+        if(sg->u.dtmf.count < sg->u.dtmf.on_len)
+        {
+            sum = NCO_sine(sg->u.dtmf.phase[0]) + NCO_sine(sg->u.dtmf.phase[1]);
+            sg->u.dtmf.phase[0] += row_step;
+            sg->u.dtmf.phase[1] += col_step;
+        }
+        *out = SG_Saturate((sum * sg->gain + 0x4000) >> 15);
+        out += stride;
+
+        if(++sg->u.dtmf.count >= sg->u.dtmf.period)
+        {
+            sg->u.dtmf.count = 0;
+            sg->u.dtmf.phase[0] = 0;
+            sg->u.dtmf.phase[1] = 0;
+            sg->u.dtmf.index++;
+            if(sg->u.dtmf.digits[sg->u.dtmf.index] == '\0')
+            {
+                sg->u.dtmf.index = 0;
+            }
+            key = SG_Dtmf_Key(sg->u.dtmf.digits[sg->u.dtmf.index]);
+            row_step = sg->u.dtmf.step[(uint32_t)key / 4U];
+            col_step = sg->u.dtmf.step[4U + (uint32_t)key % 4U];
+        }
+    }
+}
+
+/**
+ * [SG_Render_Impulse 脉冲串]
+ */
+static void SG_Render_Impulse(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    uint32_t count = sg->u.impulse.count;
+
+    for(uint32_t i = 0; i < samples; i++)
+    {
+        *out = (int16_t)((count == 0U)?sg->gain:0);
+        out += stride;
+        if(++count >= sg->u.impulse.period)
+        {
+            count = 0;
+        }
+    }
+    sg->u.impulse.count = count;
+}
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [SG_init 初始化为静音]
+ * @param sg          [生成器]
+ * @param sample_rate [采样率Hz]
+ * @param rand        [随机数接口，可为NULL]
+ */
+void SG_init(SG_HandleTypeDef *sg, uint32_t sample_rate, SG_RandFunc_t rand)
+{
+    memset(sg, 0, sizeof(SG_HandleTypeDef));
+    sg->type = SG_TYPE_OFF;
+    sg->sample_rate = sample_rate;
+    sg->rand = rand;
+}
+
+/**
+ * [SG_setOff 静音]
+ * @param sg [生成器]
+ */
+void SG_setOff(SG_HandleTypeDef *sg)
+{
+    sg->type = SG_TYPE_OFF;
+}
+
+/**
+ * [SG_setSine 正弦]
+ * @param  sg   [生成器]
+ * @param  freq [频率Hz]
+ * @param  dbfs [峰值电平]
+ * @return      [true 成功]
+ */
+bool SG_setSine(SG_HandleTypeDef *sg, float freq, float dbfs)
+{
+    NCO_StateTypeDef nco;
+
+    NCO_init(&nco, sg->sample_rate);
+    if(NCO_setFrequency(&nco, freq) == false)
+    {
+        return false;
+    }
+    /*已为正弦时保持相位连续*/
+    nco.phase = (sg->type == SG_TYPE_SINE)?sg->u.sine.phase:0U;
+    NCO_setLevel(&nco, dbfs);
+    sg->u.sine = nco;
+    sg->gain = nco.gain;
+    sg->type = SG_TYPE_SINE;
+    return true;
+}
+
+/**
+ * [SG_setWhite 白噪声]
+ * @param  sg   [生成器]
+ * @param  dbfs [峰值电平]
+ * @return      [true 成功]
+ */
+bool SG_setWhite(SG_HandleTypeDef *sg, float dbfs)
+{
+    if(sg->rand == NULL)
+    {
+        return false;
+    }
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = SG_TYPE_WHITE;
+    return true;
+}
+
+/**
+ * [SG_setPink 粉红噪声]
+ * @param  sg   [生成器]
+ * @param  dbfs [峰值电平]
+ * @return      [true 成功]
+ */
+bool SG_setPink(SG_HandleTypeDef *sg, float dbfs)
+{
+    if(sg->rand == NULL)
+    {
+        return false;
+    }
+    memset(&sg->u.pink, 0, sizeof(sg->u.pink));
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = SG_TYPE_PINK;
+    return true;
+}
+
+/**
+ * [SG_setChirp 扫频]
+ * @param  sg         [生成器]
+ * @param  freq_start [起始频率Hz]
+ * @param  freq_end   [终止频率Hz]
+ * @param  length     [单次扫频点数，不小于2]
+ * @param  log        [true 对数扫频]
+ * @param  dbfs       [峰值电平]
+ * @return            [true 成功]
+ */
+bool SG_setChirp(SG_HandleTypeDef *sg, float freq_start, float freq_end, uint32_t length, bool log, float dbfs)
+{
+    float nyquist = (float)sg->sample_rate * 0.5f;
+    uint32_t step_end = 0;
+
+    if(length < 2U || !(freq_start > 0.f) || !(freq_end > 0.f) || freq_start >= nyquist || freq_end >= nyquist)
+    {
+        return false;
+    }
+    sg->u.chirp.phase = 0;
+    sg->u.chirp.step_start = NCO_freqToStep(freq_start, sg->sample_rate);
+    sg->u.chirp.step = sg->u.chirp.step_start;
+    step_end = NCO_freqToStep(freq_end, sg->sample_rate);
+    sg->u.chirp.delta = (int32_t)(((int64_t)step_end - (int64_t)sg->u.chirp.step_start) / (int64_t)(length - 1U));
+    sg->u.chirp.ratio = (uint32_t)(expf(logf(freq_end / freq_start) / (float)(length - 1U)) * SG_Q30_ONE + 0.5f);
+    sg->u.chirp.length = length;
+    sg->u.chirp.count = 0;
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = (log == true)?SG_TYPE_CHIRP_LOG:SG_TYPE_CHIRP_LIN;
+    return true;
+}
+
+/**
+ * [SG_setMls 最大长度序列]
+ * @param  sg    [生成器]
+ * @param  order [阶数SG_MLS_ORDER_MIN-SG_MLS_ORDER_MAX]
+ * @param  dbfs  [幅度电平]
+ * @return       [true 成功]
+ */
+bool SG_setMls(SG_HandleTypeDef *sg, uint8_t order, float dbfs)
+{
+    if(order < SG_MLS_ORDER_MIN || order > SG_MLS_ORDER_MAX)
+    {
+        return false;
+    }
+    sg->u.mls.state = 1U;
+    sg->u.mls.taps = SG_Mls_Taps[order];
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = SG_TYPE_MLS;
+    return true;
+}
+
+/**
+ * [SG_setMultitone 多音]
+ * @param  sg        [生成器]
+ * @param  freq_low  [最低频率Hz]
+ * @param  freq_high [最高频率Hz]
+ * @param  num       [音数1-SG_MULTITONE_MAX]
+ * @param  dbfs      [总有效值对应的正弦峰值电平]
+ * @return           [true 成功]
+ */
+bool SG_setMultitone(SG_HandleTypeDef *sg, float freq_low, float freq_high, uint8_t num, float dbfs)
+{
+    float nyquist = (float)sg->sample_rate * 0.5f;
+    float ratio = 1.f;
+    uint64_t k = 0;
+
+    if(num == 0U || num > SG_MULTITONE_MAX || !(freq_low > 0.f) || freq_high < freq_low || freq_high >= nyquist)
+    {
+        return false;
+    }
+    ratio = (num > 1U)?powf(freq_high / freq_low, 1.f / (float)(num - 1U)):1.f;
+    for(uint32_t i = 0; i < num; i++)
+    {
+        sg->u.multitone.step[i] = NCO_freqToStep(freq_low * powf(ratio, (float)i), sg->sample_rate);
+        /*Schroeder相位pi*k*(k-1)/N，k由1起*/
+        k = (uint64_t)(i + 1U) * i % (2U * num);
+        sg->u.multitone.phase[i] = (uint32_t)((k << 32) / (2U * num));
+    }
+    sg->u.multitone.num = num;
+    sg->gain = (int32_t)((float)NCO_dbfsToGain(dbfs) / sqrtf((float)num) + 0.5f);
+    sg->type = SG_TYPE_MULTITONE;
+    return true;
+}
+
+/**
+ * [SG_setDtmf 双音多频]
+ * @param  sg      [生成器]
+ * @param  digits  [号码，0-9*#A-D，不超过SG_DTMF_DIGITS_MAX]
+ * @param  on_len  [单音点数，不为0]
+ * @param  off_len [间隔点数]
+ * @param  dbfs    [单音峰值电平]
+ * @return         [true 成功]
+ */
+bool SG_setDtmf(SG_HandleTypeDef *sg, const char *digits, uint32_t on_len, uint32_t off_len, float dbfs)
+{
+    size_t len = (digits != NULL)?strlen(digits):0U;
+
+    if(len == 0U || len > SG_DTMF_DIGITS_MAX || on_len == 0U)
+    {
+        return false;
+    }
+    for(size_t i = 0; i < len; i++)
+    {
+        if(SG_Dtmf_Key(digits[i]) < 0)
+        {
+            return false;
+        }
+    }
+    for(uint32_t i = 0; i < 8U; i++)
+    {
+        sg->u.dtmf.step[i] = NCO_freqToStep(SG_Dtmf_Freq[i], sg->sample_rate);
+    }
+    memcpy(sg->u.dtmf.digits, digits, len + 1U);
+    sg->u.dtmf.phase[0] = 0;
+    sg->u.dtmf.phase[1] = 0;
+    sg->u.dtmf.index = 0;
+    sg->u.dtmf.on_len = on_len;
+    sg->u.dtmf.period = on_len + off_len;
+    sg->u.dtmf.count = 0;
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = SG_TYPE_DTMF;
+    return true;
+}
+
+/**
+ * [SG_setImpulse 脉冲串]
+ * @param  sg     [生成器]
+ * @param  period [脉冲间隔点数，不为0]
+ * @param  dbfs   [脉冲幅度电平]
+ * @return        [true 成功]
+ */
+bool SG_setImpulse(SG_HandleTypeDef *sg, uint32_t period, float dbfs)
+{
+    if(period == 0U)
+    {
+        return false;
+    }
+    sg->u.impulse.period = period;
+    sg->u.impulse.count = 0;
+    sg->gain = NCO_dbfsToGain(dbfs);
+    sg->type = SG_TYPE_IMPULSE;
+    return true;
+}
+
+/**
+ * [SG_render 生成一块数据]
+ * @param sg      [生成器]
+ * @param out     [输出]
+ * @param stride  [输出点间隔]
+ * @param samples [点数]
+ */
+void SG_render(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples)
+{
+    switch(sg->type)
+    {
+        case SG_TYPE_SINE:
+            NCO_render(&sg->u.sine, out, stride, samples);
+            break;
+        case SG_TYPE_WHITE:
+            SG_Render_White(sg, out, stride, samples);
+            break;
+        case SG_TYPE_PINK:
+            SG_Render_Pink(sg, out, stride, samples);
+            break;
+        case SG_TYPE_CHIRP_LIN:
+        case SG_TYPE_CHIRP_LOG:
+            SG_Render_Chirp(sg, out, stride, samples);
+            break;
+        case SG_TYPE_MLS:
+            SG_Render_Mls(sg, out, stride, samples);
+            break;
+        case SG_TYPE_MULTITONE:
+            SG_Render_Multitone(sg, out, stride, samples);
+            break;
+        case SG_TYPE_DTMF:
+            SG_Render_Dtmf(sg, out, stride, samples);
+            break;
+        case SG_TYPE_IMPULSE:
+            SG_Render_Impulse(sg, out, stride, samples);
+            break;
+        case SG_TYPE_OFF:
+        default:
+            for(uint32_t i = 0; i < samples; i++)
+            {
+                out[i * stride] = 0;
+            }
+            break;
+    }
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,141 @@
+/**
+ *  @file SignalGen.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 按块生成的测试信号：正弦、白噪声、粉红噪声、线性/对数扫频、MLS、多音、DTMF、脉冲串
+ *
+ *  @details 1、设置接口使用浮点计算参数，生成接口每点仅定点运算，一次生成一块
+ *           2、噪声随机数由初始化时传入的接口提供，可接硬件RNG，每次提供32位
+ *           3、电平均为dBFS：单频信号为峰值；噪声为峰值(均匀分布)；MLS为±幅度；
+ *              多音为总有效值与同电平正弦一致，各音相位按Schroeder公式降低峰值因数；
+ *              DTMF为每个单音电平；叠加超出满幅时饱和
+ *
+ *  @version v1.0
+ */
+#ifndef SIGNALGEN_H_
+#define SIGNALGEN_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+#include "Nco.h"
+/** Private defines ----------------------------------------------------------*/
+#define SG_PINK_ROWS            15U   /**< Voss-McCartney行数，低频至fs/2^15*/
+#define SG_MLS_ORDER_MIN        2U
+#define SG_MLS_ORDER_MAX        20U
+#define SG_MULTITONE_MAX        16U   /**< 多音最大音数*/
+#define SG_DTMF_DIGITS_MAX      16U   /**< DTMF最大号码长度*/
+/** Exported typedefines -----------------------------------------------------*/
+/** 信号类型*/
+typedef enum
+{
+	SG_TYPE_OFF = 0,            /**< 静音*/
+	SG_TYPE_SINE,               /**< 正弦*/
+	SG_TYPE_WHITE,              /**< 白噪声*/
+	SG_TYPE_PINK,               /**< 粉红噪声*/
+	SG_TYPE_CHIRP_LIN,          /**< 线性扫频*/
+	SG_TYPE_CHIRP_LOG,          /**< 对数扫频*/
+	SG_TYPE_MLS,                /**< 最大长度序列*/
+	SG_TYPE_MULTITONE,          /**< 多音*/
+	SG_TYPE_DTMF,               /**< 双音多频*/
+	SG_TYPE_IMPULSE,            /**< 脉冲串*/
+}SG_TYPE_ENUM_TypeDef;
+
+/** 随机数接口，返回32位均匀分布随机数*/
+typedef uint32_t (*SG_RandFunc_t)(void);
+
+/** 生成器*/
+typedef struct
+{
+	SG_TYPE_ENUM_TypeDef type;  /**< 信号类型*/
+	uint32_t sample_rate;       /**< 采样率Hz*/
+	int32_t gain;               /**< Q15幅度*/
+	SG_RandFunc_t rand;         /**< 随机数接口*/
+	union
+	{
+		NCO_StateTypeDef sine;
+		struct
+		{
+			int32_t row[SG_PINK_ROWS];  /**< 各行当前随机值*/
+			int32_t sum;                /**< 各行之和*/
+			uint32_t counter;           /**< 行更新计数*/
+		}pink;
+		struct
+		{
+			uint32_t phase;
+			uint32_t step;              /**< 当前相位增量*/
+			uint32_t step_start;        /**< 起始频率相位增量*/
+			int32_t delta;              /**< 线性扫频每点增量变化*/
+			uint32_t ratio;             /**< 对数扫频每点增量倍率Q30*/
+			uint32_t length;            /**< 单次扫频点数*/
+			uint32_t count;
+		}chirp;
+		struct
+		{
+			uint32_t state;             /**< Galois LFSR状态*/
+			uint32_t taps;              /**< 反馈掩码*/
+		}mls;
+		struct
+		{
+			uint32_t phase[SG_MULTITONE_MAX];
+			uint32_t step[SG_MULTITONE_MAX];
+			uint8_t num;
+		}multitone;
+		struct
+		{
+			uint32_t phase[2];
+			uint32_t step[8];           /**< 行频697/770/852/941Hz及列频1209/1336/1477/1633Hz*/
+			char digits[SG_DTMF_DIGITS_MAX + 1U];
+			uint8_t index;              /**< 当前号码*/
+			uint32_t on_len;            /**< 单音点数*/
+			uint32_t period;            /**< 单音加间隔点数*/
+			uint32_t count;
+		}dtmf;
+		struct
+		{
+			uint32_t period;            /**< 脉冲间隔点数*/
+			uint32_t count;
+		}impulse;
+	}u;
+}SG_HandleTypeDef;
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*初始化为静音，rand可为NULL(噪声类信号不可用)*/
+void SG_init(SG_HandleTypeDef *sg, uint32_t sample_rate, SG_RandFunc_t rand);
+/*静音*/
+void SG_setOff(SG_HandleTypeDef *sg);
+/*正弦*/
+bool SG_setSine(SG_HandleTypeDef *sg, float freq, float dbfs);
+/*白噪声，均匀分布*/
+bool SG_setWhite(SG_HandleTypeDef *sg, float dbfs);
+/*粉红噪声，Voss-McCartney*/
+bool SG_setPink(SG_HandleTypeDef *sg, float dbfs);
+/*扫频，log为true时对数扫频(频率需大于0)，到达终止频率后相位连续地重新开始*/
+bool SG_setChirp(SG_HandleTypeDef *sg, float freq_start, float freq_end, uint32_t length, bool log, float dbfs);
+/*MLS，周期2^order-1点*/
+bool SG_setMls(SG_HandleTypeDef *sg, uint8_t order, float dbfs);
+/*多音，频率按对数间隔分布于freq_low至freq_high*/
+bool SG_setMultitone(SG_HandleTypeDef *sg, float freq_low, float freq_high, uint8_t num, float dbfs);
+/*DTMF，号码由0-9*#A-D组成，循环发送*/
+bool SG_setDtmf(SG_HandleTypeDef *sg, const char *digits, uint32_t on_len, uint32_t off_len, float dbfs);
+/*脉冲串，每period点一个脉冲*/
+bool SG_setImpulse(SG_HandleTypeDef *sg, uint32_t period, float dbfs);
+/*生成samples点，stride为输出点间隔*/
+void SG_render(SG_HandleTypeDef *sg, int16_t *out, uint32_t stride, uint32_t samples);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/
@@ -0,0 +1,120 @@
+/**
+ *  @file StaticArena.c
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @copyright None
+ *
+ *  @brief 静态内存池接口
+ *
+ *  @details None
+ *
+ *  @version v1.0
+ */
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdio.h>  /**< if need printf             */
+/* Private includes ----------------------------------------------------------*/
+#include "StaticArena.h"
+/** Private typedef ----------------------------------------------------------*/
+/** Private macros -----------------------------------------------------------*/
+#define IS_POWER_OF_2(x) ((x) != 0 && (((x) & ((x) - 1)) == 0))
+/** Private constants --------------------------------------------------------*/
+/** Public variables ---------------------------------------------------------*/
+/** Private variables --------------------------------------------------------*/
+/*以64位为单位保证起始地址8字节对齐*/
+static uint64_t SA_Pool[(SA_POOL_SIZE + 7U) / 8U] SA_PLACEMENT;
+static uint32_t SA_Offset = 0;
+static uint32_t SA_Fail_Cnt = 0;
+static uint32_t SA_Fail_Size = 0;
+/** Private function prototypes ----------------------------------------------*/
+/** Private user code --------------------------------------------------------*/
+
+/** Private application code -------------------------------------------------*/
+/*******************************************************************************
+*
+*       Static code
+*
+********************************************************************************
+*/
+/** Public application code --------------------------------------------------*/
+/*******************************************************************************
+*
+*       Public code
+*
+********************************************************************************
+*/
+
+/**
+ * [SA_alloc 由内存池顺序分配内存]
+ * @param  size  [字节数]
+ * @param  align [对齐字节数，2的n次方]
+ * @return       [内存地址，空间不足返回NULL]
+ */
+void *SA_alloc(uint32_t size, uint32_t align)
+{
+    uintptr_t base = (uintptr_t)SA_Pool;
+    uintptr_t addr = 0;
+
+    if(!IS_POWER_OF_2(align))
+    {
+        return NULL;
+    }
+
+    /*按绝对地址对齐，支持大于8字节的对齐要求*/
+    addr = (base + SA_Offset + (align - 1U)) & ~((uintptr_t)align - 1U);
+    if(size > sizeof(SA_Pool) || addr - base > sizeof(SA_Pool) - size)
+    {
+        SA_Fail_Cnt++;
+        SA_Fail_Size += size;
+        return NULL;
+    }
+    SA_Offset = (uint32_t)(addr - base) + size;
+    return (void *)addr;
+}
+
+/**
+ * [SA_getUsed 获取已使用字节数]
+ * @return [已使用字节数，含对齐填充]
+ */
+uint32_t SA_getUsed(void)
+{
+    return SA_Offset;
+}
+
+/**
+ * [SA_getFree 获取剩余字节数]
+ * @return [剩余字节数]
+ */
+uint32_t SA_getFree(void)
+{
+    return (uint32_t)sizeof(SA_Pool) - SA_Offset;
+}
+
+/**
+ * [SA_getFailCount 获取分配失败次数]
+ * @return [失败次数]
+ */
+uint32_t SA_getFailCount(void)
+{
+    return SA_Fail_Cnt;
+}
+
+/**
+ * [SA_report 打印内存池使用情况，用于调整SA_POOL_SIZE]
+ */
+void SA_report(void)
+{
+    printf("static arena: used %u/%u bytes, fail %u (%u bytes)\r\n",
+           (unsigned)SA_Offset, (unsigned)sizeof(SA_Pool),
+           (unsigned)SA_Fail_Cnt, (unsigned)SA_Fail_Size);
+}
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+/******************************** End of file *********************************/
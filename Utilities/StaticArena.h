@@ -0,0 +1,65 @@
+/**
+ *  @file StaticArena.h
+ *
+ *  @date 2026-10-17
+ *
+ *  @author aron566
+ *
+ *  @brief 编译期定长静态内存池
+ *
+ *  @details 1、顺序分配不释放，分配耗时固定且无碎片，替代初始化阶段的malloc
+ *           2、内存池位于.bss，上电清零，分配所得内存初始为0
+ *           3、仅在初始化阶段调用，不可在中断中使用
+ *           4、默认链接至SRAM(DMA可访问)，需指定段时定义SA_PLACEMENT，如IAR：@ ".dma_ram"
+ *
+ *  @version v1.0
+ */
+#ifndef STATICARENA_H_
+#define STATICARENA_H_
+#ifdef __cplusplus ///<use C compiler
+extern "C" {
+#endif
+/** Includes -----------------------------------------------------------------*/
+#include <stdint.h> /**< need definition of uint8_t */
+#include <stddef.h> /**< need definition of NULL    */
+#include <stdbool.h>/**< need definition of BOOL    */
+/** Private includes ---------------------------------------------------------*/
+/** Private defines ----------------------------------------------------------*/
+/*内存池大小(字节)*/
+#ifndef SA_POOL_SIZE
+  #define SA_POOL_SIZE        1024U
+#endif
+
+/*内存池放置属性，默认由链接器放置于SRAM*/
+#ifndef SA_PLACEMENT
+  #define SA_PLACEMENT
+#endif
+
+/*默认对齐字节数*/
+#define SA_ALIGN_DEFAULT      4U
+/*DMA传输缓冲区建议对齐字节数*/
+#define SA_ALIGN_DMA          8U
+
+/** Exported typedefines -----------------------------------------------------*/
+/** Exported constants -------------------------------------------------------*/
+
+/** Exported macros-----------------------------------------------------------*/
+/** Exported variables -------------------------------------------------------*/
+/** Exported functions prototypes --------------------------------------------*/
+
+/*分配内存，align为2的n次方，空间不足返回NULL*/
+void *SA_alloc(uint32_t size, uint32_t align);
+/*获取已使用字节数，含对齐填充*/
+uint32_t SA_getUsed(void);
+/*获取剩余字节数*/
+uint32_t SA_getFree(void);
+/*获取分配失败次数*/
+uint32_t SA_getFailCount(void);
+/*打印内存池使用情况*/
+void SA_report(void);
+
+#ifdef __cplusplus ///<end extern c
+}
+#endif
+#endif
+/******************************** End of file *********************************/